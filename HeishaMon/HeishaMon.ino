@@ -15,11 +15,15 @@
 #include "src/common/timerqueue.h"
 #include "src/common/stricmp.h"
 #include "src/common/log.h"
+#include "src/common/outbox.h"
+#include "src/common/spool.h"
 #include "src/common/progmem.h"
+#include "src/common/inflate.h"
 #include "src/rules/rules.h"
 
 #include "webfunctions.h"
 #include "decode.h"
+#include "mqtttopics.h"
 #include "commands.h"
 #include "rules.h"
 #include "version.h"
@@ -67,8 +71,12 @@ unsigned long badheaderread = 0;
 unsigned long tooshortread = 0;
 unsigned long toolongread = 0;
 unsigned long timeoutread = 0;
+loopStatsStruct loopStats;
 float readpercentage = 0;
 static int uploadpercentage = 0;
+static unsigned long uploadstart = 0;
+static struct inflate_t *rulesInflate = NULL;
+static int8_t rulesInflateState = 0;
 
 // instead of passing array pointers between functions we just define this in the global scope
 #define MAXDATASIZE 255
@@ -205,7 +213,7 @@ void mqtt_reconnect()
   unsigned long now = millis();
   if ((lastMqttReconnectAttempt == 0) || ((unsigned long)(now - lastMqttReconnectAttempt) > MQTTRECONNECTTIMER)) { //only try reconnect each MQTTRECONNECTTIMER seconds or on boot when lastMqttReconnectAttempt is still 0
     lastMqttReconnectAttempt = now;
-    log_message(_F("Reconnecting to mqtt server ..."));
+    logcatln_P(LOG_MQTT, LOG_INFO, "Reconnecting to mqtt server ...");
     char topic[256];
     sprintf(topic, "%s/%s", heishamonSettings.mqtt_topic_base, mqtt_willtopic);
     if (mqtt_client.connect(heishamonSettings.wifi_hostname, heishamonSettings.mqtt_username, heishamonSettings.mqtt_password, topic, 1, true, "Offline"))
@@ -246,38 +254,6 @@ void mqtt_reconnect()
   }
 }
 
-void log_message(char* string)
-{
-  time_t rawtime;
-  rawtime = time(NULL);
-  struct tm *timeinfo = localtime(&rawtime);
-  char timestring[32];
-  strftime(timestring, 32, "%c", timeinfo);
-  size_t len = strlen(string) + strlen(timestring) + 20; //+20 long enough to contain millis()
-  char* log_line = (char *) malloc(len);
-  snprintf(log_line, len, "%s (%lu): %s", timestring, millis(), string);
-
-  if (heishamonSettings.logSerial1) {
-    Serial1.println(log_line);
-  }
-  if (heishamonSettings.logMqtt && mqtt_client.connected())
-  {
-    char log_topic[256];
-    sprintf(log_topic, "%s/%s", heishamonSettings.mqtt_topic_base, mqtt_logtopic);
-
-    if (!mqtt_client.publish(log_topic, log_line)) {
-      if (heishamonSettings.logSerial1) {
-        Serial1.print(millis());
-        Serial1.print(F(": "));
-        Serial1.println(F("MQTT publish log message failed!"));
-      }
-      mqtt_client.disconnect();
-    }
-  }
-  websocket_write_all(log_line, strlen(log_line));
-  free(log_line);
-}
-
 void logHex(char *hex, byte hex_len) {
 #define LOGHEXBYTESPERLINE 32  // please be aware of max mqtt message size
   for (int i = 0; i < hex_len; i += LOGHEXBYTESPERLINE) {
@@ -286,14 +262,14 @@ void logHex(char *hex, byte hex_len) {
     for (int j = 0; ((j < LOGHEXBYTESPERLINE) && ((i + j) < hex_len)); j++) {
       sprintf(&buffer[3 * j], "%02X ", hex[i + j]);
     }
-    sprintf_P(log_msg, PSTR("data: %s"), buffer ); log_message(log_msg);
+    logcat_P(LOG_SERIAL, LOG_DEBUG, "data: %s", buffer );
   }
 }
 
 void mqttPublish(char* topic, char* subtopic, char* value) {
   char mqtt_topic[256];
   sprintf_P(mqtt_topic, PSTR("%s/%s/%s"), heishamonSettings.mqtt_topic_base, topic, subtopic);
-  mqtt_client.publish(mqtt_topic, value, MQTT_RETAIN_VALUES);
+  outbox_publish_topic(mqtt_topic, value, strlen(value), MQTT_RETAIN_VALUES);
 }
 
 
@@ -322,7 +298,7 @@ bool readSerial()
     data[data_length + len] = Serial.read(); //read available data and place it after the last received data
     len++;
     if (data[0] != 113) { //wrong header received!
-      log_message(_F("Received bad header. Ignoring this data!"));
+      logcatln_P(LOG_SERIAL, LOG_WARN, "Received bad header. Ignoring this data!");
       if (heishamonSettings.logHexdump) logHex(data, len);
       badheaderread++;
       data_length = 0;
@@ -336,7 +312,7 @@ bool readSerial()
   if (data_length > 1) { //should have received length part of header now
 
     if ((data_length > (data[1] + 3)) || (data_length >= MAXDATASIZE) ) {
-      log_message(_F("Received more data than header suggests! Ignoring this as this is bad data."));
+      logcatln_P(LOG_SERIAL, LOG_WARN, "Received more data than header suggests! Ignoring this as this is bad data.");
       if (heishamonSettings.logHexdump) logHex(data, data_length);
       data_length = 0;
       toolongread++;
@@ -344,26 +320,27 @@ bool readSerial()
     }
 
     if (data_length == (data[1] + 3)) { //we received all data (data[1] is header length field)
-      sprintf_P(log_msg, PSTR("Received %d bytes data"), data_length); log_message(log_msg);
+      logcat_P(LOG_SERIAL, LOG_DEBUG, "Received %d bytes data", data_length);
       sending = false; //we received an answer after our last command so from now on we can start a new send request again
       if (heishamonSettings.logHexdump) logHex(data, data_length);
       if (! isValidReceiveChecksum() ) {
-        log_message(_F("Checksum received false!"));
+        logcatln_P(LOG_SERIAL, LOG_WARN, "Checksum received false!");
         data_length = 0; //for next attempt
         badcrcread++;
         return false;
       }
-      log_message(_F("Checksum and header received ok!"));
+      logcatln_P(LOG_SERIAL, LOG_DEBUG, "Checksum and header received ok!");
       goodreads++;
 
       if (data_length == DATASIZE)  {  //receive a full data block
         if  (data[3] == 0x10) { //decode the normal data block
           decode_heatpump_data(data, actData, mqtt_client, log_message, heishamonSettings.mqtt_topic_base, heishamonSettings.updateAllTime);
           memcpy(actData, data, DATASIZE);
+          jsonFrameReceived();
           {
             char mqtt_topic[256];
             sprintf(mqtt_topic, "%s/raw/data", heishamonSettings.mqtt_topic_base);
-            mqtt_client.publish(mqtt_topic, (const uint8_t *)actData, DATASIZE, false); //do not retain this raw data
+            outbox_publish_topic(mqtt_topic, actData, DATASIZE, false); //do not retain this raw data
           }
           data_length = 0;
           return true;
@@ -371,28 +348,29 @@ bool readSerial()
           extraDataBlockAvailable = true; //set the flag to true so we know we can request this data always
           decode_heatpump_data_extra(data, actDataExtra, mqtt_client, log_message, heishamonSettings.mqtt_topic_base, heishamonSettings.updateAllTime);
           memcpy(actDataExtra, data, DATASIZE);
+          jsonFrameReceived();
           {
             char mqtt_topic[256];
             sprintf(mqtt_topic, "%s/raw/dataextra", heishamonSettings.mqtt_topic_base);
-            mqtt_client.publish(mqtt_topic, (const uint8_t *)actDataExtra, DATASIZE, false); //do not retain this raw data
+            outbox_publish_topic(mqtt_topic, actDataExtra, DATASIZE, false); //do not retain this raw data
           }
           data_length = 0;
           return true;        
         } else {
-          log_message(_F("Received an unknown full size datagram. Can't decode this yet."));
+          logcatln_P(LOG_SERIAL, LOG_WARN, "Received an unknown full size datagram. Can't decode this yet.");
           data_length = 0;
           return false;       
         }
       }
       else if (data_length == OPTDATASIZE ) { //optional pcb acknowledge answer
-        log_message(_F("Received optional PCB ack answer. Decoding this in OPT topics."));
+        logcatln_P(LOG_SERIAL, LOG_DEBUG, "Received optional PCB ack answer. Decoding this in OPT topics.");
         decode_optional_heatpump_data(data, actOptData, mqtt_client, log_message, heishamonSettings.mqtt_topic_base, heishamonSettings.updateAllTime);
         memcpy(actOptData, data, OPTDATASIZE);
         data_length = 0;
         return true;
       }
       else {
-        log_message(_F("Received a shorter datagram. Can't decode this yet."));
+        logcatln_P(LOG_SERIAL, LOG_WARN, "Received a shorter datagram. Can't decode this yet.");
         data_length = 0;
         return false;
       }
@@ -412,7 +390,7 @@ void popCommandBuffer() {
 
 void pushCommandBuffer(byte* command, int length) {
   if (cmdnrel + 1 > MAXCOMMANDSINBUFFER) {
-    log_message(_F("Too much commands already in buffer. Ignoring this commands.\n"));
+    logcatln_P(LOG_SERIAL, LOG_WARN, "Too much commands already in buffer. Ignoring this commands.\n");
     return;
   }
   cmdbuffer[cmdend].length = length;
@@ -423,11 +401,11 @@ void pushCommandBuffer(byte* command, int length) {
 
 bool send_command(byte* command, int length) {
   if ( heishamonSettings.listenonly ) {
-    log_message(_F("Not sending this command. Heishamon in listen only mode!"));
+    logcatln_P(LOG_SERIAL, LOG_WARN, "Not sending this command. Heishamon in listen only mode!");
     return false;
   }
   if ( sending ) {
-    log_message(_F("Already sending data. Buffering this send request"));
+    logcatln_P(LOG_SERIAL, LOG_DEBUG, "Already sending data. Buffering this send request");
     pushCommandBuffer(command, length);
     return false;
   }
@@ -436,18 +414,42 @@ bool send_command(byte* command, int length) {
   byte chk = calcChecksum(command, length);
   int bytesSent = Serial.write(command, length); //first send command
   bytesSent += Serial.write(chk); //then calculcated checksum byte afterwards
-  sprintf_P(log_msg, PSTR("sent bytes: %d including checksum value: %d "), bytesSent, int(chk));
-  log_message(log_msg);
+  logcat_P(LOG_SERIAL, LOG_DEBUG, "sent bytes: %d including checksum value: %d ", bytesSent, int(chk));
 
   if (heishamonSettings.logHexdump) logHex((char*)command, length);
   sendCommandReadTime = millis(); //set sendCommandReadTime when to timeout the answer of this command
   return true;
 }
 
+// runtime log switches, these are not stored in the settings
+static bool mqttLogCommand(char *topic, char *msg) {
+  if (strcmp_P(topic, PSTR("SetLogCategories")) == 0) {
+    int16_t mask = log_categories_parse(msg);
+    if (mask < 0) {
+      logcat_P(LOG_MQTT, LOG_WARN, "Unknown log categories: %s", msg);
+    } else {
+      log_categories = mask;
+      logcat_P(LOG_MQTT, LOG_INFO, "Log categories set to 0x%02x", log_categories);
+    }
+    return true;
+  }
+  if (strcmp_P(topic, PSTR("SetLogLevel")) == 0) {
+    int8_t level = log_level_parse(msg);
+    if (level < 0) {
+      logcat_P(LOG_MQTT, LOG_WARN, "Unknown log level: %s", msg);
+    } else {
+      log_level = level;
+      logcat_P(LOG_MQTT, LOG_INFO, "Log level set to %d", log_level);
+    }
+    return true;
+  }
+  return false;
+}
+
 // Callback function that is called when a message has been pushed to one of your topics.
 void mqtt_callback(char* topic, byte* payload, unsigned int length) {
   if (mqttcallbackinprogress) {
-    log_message(_F("Already processing another mqtt callback. Ignoring this one"));
+    logcatln_P(LOG_MQTT, LOG_WARN, "Already processing another mqtt callback. Ignoring this one");
   }
   else {
     mqttcallbackinprogress = true; //simple semaphore to make sure we don't have two callbacks at the same time
@@ -463,8 +465,7 @@ void mqtt_callback(char* topic, byte* payload, unsigned int length) {
       rawcommand = (byte *) malloc(length);
       memcpy(rawcommand, msg, length);
 
-      sprintf_P(log_msg, PSTR("sending raw value"));
-      log_message(log_msg);
+      logcatln_P(LOG_MQTT, LOG_INFO, "sending raw value");
       send_command(rawcommand, length);
       free(rawcommand);
     } else if (strncmp(topic_command, mqtt_topic_s0, strlen(mqtt_topic_s0)) == 0)  // this is a s0 topic, check for watthour topic and restore it
@@ -477,20 +478,22 @@ void mqtt_callback(char* topic, byte* payload, unsigned int length) {
       char mqtt_topic[256];
       sprintf(mqtt_topic, "%s", topic);
       if (mqtt_client.unsubscribe(mqtt_topic)) {
-        log_message(_F("Unsubscribed from S0 watthour restore topic"));
+        logcatln_P(LOG_MQTT, LOG_INFO, "Unsubscribed from S0 watthour restore topic");
       }
     } else if (strncmp(topic_command, mqtt_topic_commands, strlen(mqtt_topic_commands)) == 0)  // check for commands to heishamon
     {
       char* topic_sendcommand = topic_command + strlen(mqtt_topic_commands) + 1; //strip the first 9 "commands/" from the topic to get what we need
-      send_heatpump_command(topic_sendcommand, msg, send_command, log_message, heishamonSettings.optionalPCB);
+      if (!mqttLogCommand(topic_sendcommand, msg)) {
+        send_heatpump_command(topic_sendcommand, msg, send_command, log_message, heishamonSettings.optionalPCB);
+      }
     }
     //use this to receive valid heishamon raw data from other heishamon to debug this OT code
 #ifdef OTDEBUG
     else if (strcmp((char*)"panasonic_heat_pump/data", topic) == 0) {  // check for raw heatpump input
-      sprintf_P(log_msg, PSTR("Received raw heatpump data from MQTT"));
-      log_message(log_msg);
+      logcatln_P(LOG_MQTT, LOG_DEBUG, "Received raw heatpump data from MQTT");
       decode_heatpump_data(msg, actData, mqtt_client, log_message, heishamonSettings.mqtt_topic_base, heishamonSettings.updateAllTime);
       memcpy(actData, msg, DATASIZE);
+      jsonFrameReceived();
 #endif
     } else if (strncmp(topic_command, mqtt_topic_opentherm, strlen(mqtt_topic_opentherm)) == 0)  {
       char* topic_otcommand = topic_command + strlen(mqtt_topic_opentherm) + 1; //strip the opentherm subtopic from the topic
@@ -523,90 +526,84 @@ void setupOTA() {
   ArduinoOTA.begin();
 }
 
+void logUploadSpeed(const char *what, struct webserver_t *client) {
+  unsigned long elapsed = millis() - uploadstart;
+  if (elapsed == 0) {
+    elapsed = 1;
+  }
+  // bytes per millisecond is kB/s, report in hundredths of MB/s
+  unsigned long rate = client->readlen / (elapsed * 10);
+  sprintf_P(log_msg, PSTR("%s upload: %lu bytes in %lu ms (%lu.%02lu MB/s)"), what, (unsigned long)client->readlen, elapsed, rate / 100, rate % 100);
+  log_message(log_msg);
+}
+
+static int8_t rulesInflateWrite(void *userdata, unsigned char *buf, uint16_t len) {
+  File *f = (File *)userdata;
+  return (f->write(buf, len) == len) ? 0 : -1;
+}
+
+static int8_t rulesInflateHistory(void *userdata, uint32_t offset, unsigned char *buf, uint16_t len) {
+  File *f = (File *)userdata;
+  if (!f->seek(offset, SeekSet)) {
+    return -1;
+  }
+  return (f->read(buf, len) == len) ? 0 : -1;
+}
+
+static void rulesInflateFree() {
+  inflate_free(rulesInflate);
+  rulesInflate = NULL;
+  rulesInflateState = 0;
+}
+
 int8_t webserver_cb(struct webserver_t *client, void *dat) {
   switch (client->step) {
-    case WEBSERVER_CLIENT_REQUEST_METHOD: {
-        if (strcmp_P((char *)dat, PSTR("POST")) == 0) {
-          client->route = 110;
-        }
-        return 0;
-      } break;
     case WEBSERVER_CLIENT_REQUEST_URI: {
-        if (strcmp_P((char *)dat, PSTR("/")) == 0) {
-          client->route = 1;
-        } else if (strcmp_P((char *)dat, PSTR("/tablerefresh")) == 0) {
-          client->route = 10;
-        } else if (strcmp_P((char *)dat, PSTR("/json")) == 0) {
-          client->route = 20;
-        } else if (strcmp_P((char *)dat, PSTR("/reboot")) == 0) {
-          client->route = 30;
-        } else if (strcmp_P((char *)dat, PSTR("/debug")) == 0) {
-          client->route = 40;
-          log_message(_F("Debug URL requested"));
-        } else if (strcmp_P((char *)dat, PSTR("/wifiscan")) == 0) {
-          client->route = 50;
-        } else if (strcmp_P((char *)dat, PSTR("/togglelog")) == 0) {
-          client->route = 1;
-          log_message(_F("Toggled mqtt log flag"));
-          heishamonSettings.logMqtt ^= true;
-        } else if (strcmp_P((char *)dat, PSTR("/togglehexdump")) == 0) {
-          client->route = 1;
-          log_message(_F("Toggled hexdump log flag"));
-          heishamonSettings.logHexdump ^= true;
-        } else if (strcmp_P((char *)dat, PSTR("/hotspot-detect.html")) == 0 ||
-                   strcmp_P((char *)dat, PSTR("/fwlink")) == 0 ||
-                   strcmp_P((char *)dat, PSTR("/generate_204")) == 0 ||
-                   strcmp_P((char *)dat, PSTR("/gen_204")) == 0 ||
-                   strcmp_P((char *)dat, PSTR("/popup")) == 0) {
-          client->route = 80;
-        } else if (strcmp_P((char *)dat, PSTR("/factoryreset")) == 0) {
-          client->route = 90;
-        } else if (strcmp_P((char *)dat, PSTR("/command")) == 0) {
-          if ((client->userdata = malloc(1)) == NULL) {
-            Serial1.printf(PSTR("Out of memory %s:#%d\n"), __FUNCTION__, __LINE__);
-            ESP.restart();
-            exit(-1);
-          }
-          ((char *)client->userdata)[0] = 0;
-          client->route = 100;
-        } else if (client->route == 110) {
-          // Only accept settings POST requests
-          if (strcmp_P((char *)dat, PSTR("/savesettings")) == 0) {
-            client->route = 110;
-          } else if (strcmp_P((char *)dat, PSTR("/saverules")) == 0) {
-            client->route = 170;
-
-            if (LittleFS.begin()) {
-              LittleFS.remove("/rules.new");
-              client->userdata = new File(LittleFS.open("/rules.new", "a+"));
-            }
-          } else if (strcmp_P((char *)dat, PSTR("/firmware")) == 0) {
-            if (!Update.isRunning()) {
-              Update.runAsync(true);
-              if (!Update.begin((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000)) {
-                Update.printError(Serial1);
-                return -1;
+        client->route = webRouteLookup(client, (char *)dat);
+        switch (client->route) {
+          case 2: {
+              client->route = 1;
+              log_message(_F("Toggled mqtt log flag"));
+              heishamonSettings.logMqtt ^= true;
+            } break;
+          case 3: {
+              client->route = 1;
+              log_message(_F("Toggled hexdump log flag"));
+              heishamonSettings.logHexdump ^= true;
+            } break;
+          case 40: {
+              log_message(_F("Debug URL requested"));
+            } break;
+          case 100: {
+              if ((client->userdata = malloc(1)) == NULL) {
+                Serial1.printf(PSTR("Out of memory %s:#%d\n"), __FUNCTION__, __LINE__);
+                ESP.restart();
+                exit(-1);
+              }
+              ((char *)client->userdata)[0] = 0;
+            } break;
+          case 150: {
+              uploadstart = millis();
+              if (!Update.isRunning()) {
+                Update.runAsync(true);
+                if (!Update.begin((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000)) {
+                  Update.printError(Serial1);
+                  return -1;
+                }
               } else {
-                client->route = 150;
+                Serial1.println(PSTR("New firmware update client, while previous isn't finished yet! Assume broken connection, abort!"));
+                Update.end();
+                return -1;
               }
-            } else {
-              Serial1.println(PSTR("New firmware update client, while previous isn't finished yet! Assume broken connection, abort!"));
-              Update.end();
-              return -1;
-            }
-          } else {
-            return -1;
-          }
-        } else if (strcmp_P((char *)dat, PSTR("/settings")) == 0) {
-          client->route = 120;
-        } else if (strcmp_P((char *)dat, PSTR("/getsettings")) == 0) {
-          client->route = 130;
-        } else if (strcmp_P((char *)dat, PSTR("/firmware")) == 0) {
-          client->route = 140;
-        } else if (strcmp_P((char *)dat, PSTR("/rules")) == 0) {
-          client->route = 160;
-        } else {
-          client->route = 0;
+            } break;
+          case 170: {
+              uploadstart = millis();
+              rulesInflateFree();
+              if (LittleFS.begin()) {
+                LittleFS.remove("/rules.new");
+                client->userdata = new File(LittleFS.open("/rules.new", "a+"));
+              }
+            } break;
         }
 
         return 0;
@@ -674,6 +671,17 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
           case 110: {
               return cacheSettings(client, args);
             } break;
+          case 200: {
+              if (strcmp_P((char *)args->name, PSTR("values")) == 0) {
+                client->events |= EVENTS_VALUES;
+              } else if (strcmp_P((char *)args->name, PSTR("stats")) == 0) {
+                client->events |= EVENTS_STATS;
+              } else if (strcmp_P((char *)args->name, PSTR("rules")) == 0) {
+                client->events |= EVENTS_RULES;
+              } else if (strcmp_P((char *)args->name, PSTR("log")) == 0) {
+                client->events |= EVENTS_LOG;
+              }
+            } break;
           case 150: {
               if (Update.isRunning() && (!Update.hasError())) {
                 if ((strcmp((char *)args->name, "md5") == 0) && (args->len > 0)) {
@@ -687,14 +695,17 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
                     Update.end(false);
                   }
                 } else if (strcmp((char *)args->name, "firmware") == 0) {
+                  if (Update.progress() == 0 && INFLATE_IS_GZIP(args->value, args->len)) {
+                    // the bootloader inflates the image when it gets installed
+                    log_message(_F("Uploading gzip compressed firmware"));
+                  }
                   if (Update.write((uint8_t *)args->value, args->len) != args->len) {
                     Update.printError(Serial1);
                     Update.end(false);
                   } else {
                     if (uploadpercentage != (unsigned int)(((float)client->readlen / (float)client->totallen) * 20)) {
                       uploadpercentage = (unsigned int)(((float)client->readlen / (float)client->totallen) * 20);
-                      sprintf_P(log_msg, PSTR("Uploading new firmware: %d%%"), uploadpercentage * 5);
-                      log_message(log_msg);
+                      logcat_P(LOG_WEB, LOG_INFO, "Uploading new firmware: %d%%", uploadpercentage * 5);
                     }
                   }
                 }
@@ -707,13 +718,39 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
               if (!f || !*f) {
                 client->route = 160;
               } else {
-                f->write(args->value, args->len);
+                if (rulesInflate == NULL && args->len > 0 && f->size() == 0 && INFLATE_IS_GZIP(args->value, args->len)) {
+                  if ((rulesInflate = inflate_init(rulesInflateWrite, rulesInflateHistory, f)) == NULL) {
+                    log_message(_F("Not enough memory to inflate the rules upload"));
+                    client->route = 160;
+                    break;
+                  }
+                }
+                if (rulesInflate != NULL) {
+                  rulesInflateState = inflate_feed(rulesInflate, args->value, args->len);
+                  if (rulesInflateState == -1) {
+                    log_message(_F("Compressed rules upload is corrupt, rules not saved"));
+                    rulesInflateFree();
+                    client->route = 160;
+                  }
+                } else {
+                  f->write(args->value, args->len);
+                }
               }
             } break;
         }
       } break;
     case WEBSERVER_CLIENT_HEADER: {
         struct arguments_t *args = (struct arguments_t *)dat;
+        if (client->route == 20 && strcasecmp_P((char *)args->name, PSTR("If-None-Match")) == 0) {
+          if (jsonNotModified(&heishamonSettings, (char *)args->value, args->len)) {
+            client->route = 21;
+          }
+        }
+        if (client->route == 180 && strcasecmp_P((char *)args->name, PSTR("If-None-Match")) == 0) {
+          if (webAssetNotModified(client, (char *)args->value, args->len)) {
+            client->route = 181;
+          }
+        }
         return 0;
       } break;
     case WEBSERVER_CLIENT_WRITE: {
@@ -728,6 +765,14 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
           case 1: {
               return handleRoot(client, readpercentage, mqttReconnects, &heishamonSettings);
             } break;
+          case 4:
+          case 5: {
+              if (client->content == 0) {
+                webserver_send(client, 405, (char *)"text/plain", 22);
+                webserver_send_content_P(client, PSTR("405 Method not allowed"), 22);
+              }
+              return 0;
+            } break;
           case 10:
           case 11:
           case 12:
@@ -737,6 +782,12 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
           case 20: {
               return handleJsonOutput(client, actData, actDataExtra, &heishamonSettings, extraDataBlockAvailable);
             } break;
+          case 21: {
+              if (client->content == 0) {
+                webserver_send(client, 304, (char *)"application/json", 0);
+              }
+              return 0;
+            } break;
           case 30: {
               return handleReboot(client);
             } break;
@@ -810,6 +861,7 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
             } break;
           case 150: {
               log_message((char*)"In /firmware client write part");
+              logUploadSpeed("Firmware", client);
               if (Update.isRunning()) {
                 if (Update.end(true)) {
                   log_message((char*)"Firmware update success");
@@ -825,6 +877,23 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
           case 160: {
               return showRules(client);
             } break;
+          case 180:
+          case 181: {
+              return handleWebAsset(client);
+            } break;
+          case 190: {
+              return handleRouteStats(client);
+            } break;
+          case 210: {
+              return handleMetrics(client, actData, actDataExtra, &heishamonSettings, extraDataBlockAvailable, mqttReconnects);
+            } break;
+          case 200: {
+              if (client->content == 0) {
+                webserver_events_start(client);
+                webserver_send(client, 200, (char *)"text/event-stream", 0);
+              }
+              return 0;
+            } break;
           case 170: {
               File *f = (File *)client->userdata;
               if (f) {
@@ -834,7 +903,19 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
                 delete f;
               }
               client->userdata = NULL;
-              timerqueue_insert(0, 1, -4);
+              logUploadSpeed("Rules", client);
+              if (rulesInflate != NULL) {
+                if (rulesInflateState == 1) {
+                  sprintf_P(log_msg, PSTR("Rules upload inflated to %lu bytes"), (unsigned long)rulesInflate->total);
+                  log_message(log_msg);
+                  timerqueue_insert(0, 1, -4);
+                } else {
+                  log_message(_F("Compressed rules upload is incomplete, rules not saved"));
+                }
+                rulesInflateFree();
+              } else {
+                timerqueue_insert(0, 1, -4);
+              }
               webserver_send(client, 301, (char *)"text/plain", 0);
             } break;
           default: {
@@ -846,6 +927,12 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
     case WEBSERVER_CLIENT_CREATE_HEADER: {
         struct header_t *header = (struct header_t *)dat;
         switch (client->route) {
+          case 4: {
+              header->ptr += sprintf_P((char *)header->buffer, PSTR("Allow: GET"));
+            } break;
+          case 5: {
+              header->ptr += sprintf_P((char *)header->buffer, PSTR("Allow: POST"));
+            } break;
           case 113: {
               header->ptr += sprintf_P((char *)header->buffer, PSTR("Location: /settings"));
               return -1;
@@ -859,6 +946,25 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
               header->ptr += sprintf_P((char *)header->buffer, PSTR("Location: /rules"));
               return -1;
             } break;
+          case 20:
+          case 21: {
+              uint16_t len = sprintf_P((char *)header->buffer, PSTR("Access-Control-Allow-Origin: *\r\n"));
+              len += jsonETagHeader(&heishamonSettings, (char *)&header->buffer[len], 64, client->route == 21);
+              header->ptr += len;
+              if (client->route == 21) {
+                return -1;
+              }
+            } break;
+          case 200: {
+              header->ptr += sprintf_P((char *)header->buffer, PSTR("Cache-Control: no-cache\r\nAccess-Control-Allow-Origin: *"));
+            } break;
+          case 180:
+          case 181: {
+              header->ptr += webAssetHeader(client, (char *)header->buffer);
+              if (client->route == 181) {
+                return -1;
+              }
+            } break;
           default: {
               if (client->route != 0) {
                 header->ptr += sprintf_P((char *)header->buffer, PSTR("Access-Control-Allow-Origin: *"));
@@ -868,7 +974,12 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
         return 0;
       } break;
     case WEBSERVER_CLIENT_CLOSE: {
+        webRouteDone(client);
         switch (client->route) {
+          case 20:
+          case 210: {
+              handleJsonClose(client);
+            } break;
           case 100: {
               if (client->userdata != NULL) {
                 free(client->userdata);
@@ -884,6 +995,7 @@ int8_t webserver_cb(struct webserver_t *client, void *dat) {
             } break;
           case 160:
           case 170: {
+              rulesInflateFree();
               if (client->userdata != NULL) {
                 File *f = (File *)client->userdata;
                 if (f) {
@@ -989,6 +1101,13 @@ void setupMqtt() {
   mqtt_client.setSocketTimeout(10); mqtt_client.setKeepAlive(5); //fast timeout, any slower will block the main loop too long
   mqtt_client.setServer(heishamonSettings.mqtt_server, atoi(heishamonSettings.mqtt_port));
   mqtt_client.setCallback(mqtt_callback);
+  mqttTopicsInit(heishamonSettings.mqtt_topic_base, heishamonSettings.mqttShortTopics);
+  outbox_init(mqttTopic);
+  if (heishamonSettings.mqttSpool) {
+    if (spool_init() < 0) {
+      logcatln_P(LOG_MQTT, LOG_ERROR, "Could not open the mqtt spool on flash");
+    }
+  }
 }
 
 void setupConditionals() {
@@ -1029,6 +1148,7 @@ void timer_cb(int nr) {
           timerqueue_insert(1, 0, -2);
         } break;
       case -2: {
+          log_flush();
           ESP.restart();
         } break;
       case -3: {
@@ -1046,6 +1166,9 @@ void timer_cb(int nr) {
           }
           rules_boot();
         } break;
+      case RULES_TIME_TIMER: {
+          rules_time_cb();
+        } break;
     }
   }
 
@@ -1139,17 +1262,17 @@ void setup() {
 }
 
 void send_initial_query() {
-  log_message(_F("Requesting initial start query"));
+  logcatln_P(LOG_SERIAL, LOG_INFO, "Requesting initial start query");
   send_command(initialQuery, INITIALQUERYSIZE);
 
 }
 
 void send_panasonic_query() {
-  log_message(_F("Requesting new panasonic data"));
+  logcatln_P(LOG_SERIAL, LOG_DEBUG, "Requesting new panasonic data");
   send_command(panasonicQuery, PANASONICQUERYSIZE);
   // rest is for the new data block on new models
   if (extraDataBlockAvailable) {
-    log_message(_F("Requesting new panasonic extra data"));
+    logcatln_P(LOG_SERIAL, LOG_DEBUG, "Requesting new panasonic extra data");
     panasonicQuery[3] = 0x21; //setting 4th byte to 0x21 is a request for extra block
     send_command(panasonicQuery, PANASONICQUERYSIZE);
     panasonicQuery[3] = 0x10; //setting 4th back to 0x10 for normal data request next time
@@ -1163,16 +1286,15 @@ void send_panasonic_query() {
 }
 
 void send_optionalpcb_query() {
-  log_message(_F("Sending optional PCB data"));
+  logcatln_P(LOG_SERIAL, LOG_DEBUG, "Sending optional PCB data");
   send_command(optionalPCBQuery, OPTIONALPCBQUERYSIZE);
 }
 
 
 void read_panasonic_data() {
   if (sending && ((unsigned long)(millis() - sendCommandReadTime) > SERIALTIMEOUT)) {
-    log_message(_F("Previous read data attempt failed due to timeout!"));
-    sprintf_P(log_msg, PSTR("Received %d bytes data"), data_length);
-    log_message(log_msg);
+    logcatln_P(LOG_SERIAL, LOG_WARN, "Previous read data attempt failed due to timeout!");
+    logcat_P(LOG_SERIAL, LOG_WARN, "Received %d bytes data", data_length);
     if (heishamonSettings.logHexdump) logHex(data, data_length);
     if (data_length == 0) {
       timeoutread++;
@@ -1187,6 +1309,8 @@ void read_panasonic_data() {
 }
 
 void loop() {
+  unsigned long loopStart = micros();
+
   webserver_loop();
 
   // check wifi
@@ -1195,6 +1319,7 @@ void loop() {
   ArduinoOTA.handle();
 
   mqtt_client.loop();
+  outbox_loop();
 
   if (heishamonSettings.opentherm) {
     HeishaOTLoop(actData, mqtt_client, heishamonSettings.mqtt_topic_base);
@@ -1203,7 +1328,7 @@ void loop() {
   read_panasonic_data();
 
   if ((!sending) && (cmdnrel > 0)) { //check if there is a send command in the buffer
-    log_message(_F("Sending command from buffer"));
+    logcatln_P(LOG_SERIAL, LOG_DEBUG, "Sending command from buffer");
     popCommandBuffer();
   }
 
@@ -1230,7 +1355,7 @@ void loop() {
     //check mqtt
     if ( (WiFi.isConnected()) && (!mqtt_client.connected()) )
     {
-      log_message(_F("Lost MQTT connection!"));
+      logcatln_P(LOG_MQTT, LOG_WARN, "Lost MQTT connection!");
       mqtt_reconnect();
     }
 
@@ -1258,11 +1383,15 @@ void loop() {
     message += mqttReconnects;
     message += F(" ## Correct data: ");
     message += readpercentage;
-    message += F("%");
+    message += F("% ## Rule aborts: ");
+    message += rule_stats.aborted_steps + rule_stats.aborted_time + rule_stats.aborted_depth;
     log_message((char*)message.c_str());
 
+    struct outbox_stats_t outbox;
+    outbox_stats(&outbox);
+
     String stats;
-    stats.reserve(384);
+    stats.reserve(512);
     stats += F("{\"uptime\":");
     stats += String(millis());
     stats += F(",\"voltage\":");
@@ -1289,18 +1418,29 @@ void loop() {
     stats += toolongread;
     stats += F(",\"timeout reads\":");
     stats += timeoutread;
+    stats += F(",\"rule runs\":");
+    stats += rule_stats.runs;
+    stats += F(",\"rule aborts\":");
+    stats += rule_stats.aborted_steps + rule_stats.aborted_time + rule_stats.aborted_depth;
+    stats += F(",\"mqtt queue depth\":");
+    stats += outbox.depth;
+    stats += F(",\"mqtt queue dropped\":");
+    stats += outbox.dropped;
+    stats += F(",\"mqtt queue latency\":");
+    stats += outbox.latency_avg;
     stats += F(",\"version\":\"");
     stats += heishamon_version;
     stats += F("\"}");
     sprintf_P(mqtt_topic, PSTR("%s/stats"), heishamonSettings.mqtt_topic_base);
-    mqtt_client.publish(mqtt_topic, stats.c_str(), MQTT_RETAIN_VALUES);
+    outbox_publish_topic(mqtt_topic, stats.c_str(), stats.length(), MQTT_RETAIN_VALUES);
+    webserver_events_all(EVENTS_STATS, PSTR("stats"), (char *)stats.c_str(), stats.length());
 
     //get new data
     if (!heishamonSettings.listenonly) send_panasonic_query();
 
     //Make sure the LWT is set to Online, even if the broker have marked it dead.
     sprintf_P(mqtt_topic, PSTR("%s/%s"), heishamonSettings.mqtt_topic_base, mqtt_willtopic);
-    mqtt_client.publish(mqtt_topic, "Online");
+    outbox_publish_topic(mqtt_topic, "Online", 6, false);
 
     if (WiFi.isConnected()) {
       MDNS.announce();
@@ -1308,4 +1448,13 @@ void loop() {
   }
 
   timerqueue_update();
+
+  log_loop();
+
+  unsigned long loopTime = micros() - loopStart;
+  loopStats.count++;
+  loopStats.total += loopTime;
+  if (loopTime > loopStats.max) {
+    loopStats.max = loopTime;
+  }
 }
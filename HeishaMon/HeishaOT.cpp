@@ -5,6 +5,7 @@
 #include "webfunctions.h"
 #include "src/common/stricmp.h"
 #include "src/common/progmem.h"
+#include "src/common/log.h"
 
 OpenTherm ot(inOTPin, outOTPin, true);
 
@@ -49,9 +50,8 @@ struct heishaOTDataStruct_t *getOTStructMember(const char *name) {
 
 void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
  if (status != OpenThermResponseStatus::SUCCESS) {
-    log_message(_F("OpenTherm: Request invalid!"));
+    logcatln_P(LOG_OT, LOG_WARN, "OpenTherm: Request invalid!");
  } else {
-  char log_msg[512];
   {
     char str[200];
     sprintf_P(str, PSTR("%#010x"), request);
@@ -71,11 +71,10 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         getOTStructMember(_F("chEnable"))->value.b = (bool)CHEnable;
         getOTStructMember(_F("dhwEnable"))->value.b = (bool)DHWEnable;
 
-        sprintf_P(log_msg, PSTR(
-                "OpenTherm: Received status check: %d, CH: %d, DHW: %d, Cooling, %d, OTC: %d, CH2: %d, SWMode: %d, DHWBlock: %d"),
+        logcat_P(LOG_OT, LOG_DEBUG,
+                "OpenTherm: Received status check: %d, CH: %d, DHW: %d, Cooling, %d, OTC: %d, CH2: %d, SWMode: %d, DHWBlock: %d",
                 data >> 8, CHEnable, DHWEnable, Cooling, OTCEnable, CH2Enable, SWMode, DHWBlock
                );
-        log_message(log_msg);
         //clean slave bits from 2-byte data
         data = ((data >> 8) << 8);
 
@@ -86,11 +85,10 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         unsigned int CoolingStatus = false;
         unsigned int CH2 = false;
         unsigned int DiagInd = false;
-        sprintf_P(log_msg,
-                PSTR("OpenTherm: Send status: CH: %d, Flame:%d, DHW: %d"),
+        logcat_P(LOG_OT, LOG_DEBUG,
+                "OpenTherm: Send status: CH: %d, Flame:%d, DHW: %d",
                 CHMode, FlameStatus, DHWMode
                );
-        log_message(log_msg);
         unsigned int responsedata = FaultInd | (CHMode << 1) | (DHWMode << 2) | (FlameStatus << 3) | (CoolingStatus << 4) | (CH2 << 5) | (DiagInd << 6);
         otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::Status, (data |= responsedata));
         rules_event_cb(_F("?"), _F("chEnable"));
@@ -100,8 +98,7 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         getOTStructMember(_F("chSetpoint"))->value.f = ot.getFloat(request);
         char str[200];
         sprintf_P((char *)&str, PSTR("%.*f"), 4, getOTStructMember(_F("chSetpoint"))->value.f);
-        sprintf_P(log_msg, PSTR("OpenTherm: control setpoint TSet: %s"), str);
-        log_message(log_msg);
+        logcat_P(LOG_OT, LOG_DEBUG, "OpenTherm: control setpoint TSet: %s", str);
         mqttPublish((char*)mqtt_topic_opentherm, _F("chSetpoint"), str);
         otResponse = ot.buildResponse(OpenThermMessageType::WRITE_ACK, OpenThermMessageID::TSet, request & 0xffff);
         rules_event_cb(_F("?"), _F("chsetpoint"));
@@ -109,17 +106,16 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
     case OpenThermMessageID::MConfigMMemberIDcode: {
       unsigned long data = ot.getUInt(request);
       unsigned int SmartPower = (data >> 8) & (1 << 0);
-      sprintf_P(log_msg,
-			  PSTR("OpenTherm: Received master config: %d, Smartpower: %d"),
+      logcat_P(LOG_OT, LOG_DEBUG,
+			  "OpenTherm: Received master config: %d, Smartpower: %d",
               data >> 8, SmartPower
              );
-      log_message(log_msg);
       otResponse = ot.buildResponse(OpenThermMessageType::WRITE_ACK, OpenThermMessageID::MConfigMMemberIDcode, data);
 
       //ot.setSmartPower((bool)SmartPower); not working correctly yet
       } break;      
     case OpenThermMessageID::SConfigSMemberIDcode: { //mandatory
-        log_message(_F("OpenTherm: Received read slave config"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read slave config");
         unsigned int DHW = true;
         unsigned int Modulation = false;
         unsigned int Cool = false;
@@ -134,17 +130,16 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
       } break;
     case OpenThermMessageID::MaxRelModLevelSetting: { //mandatory
         float data = ot.getFloat(request);
-        sprintf_P(log_msg, PSTR("OpenTherm: Max relative modulation level: %f"), data);
-        log_message(log_msg);
+        logcat_P(LOG_OT, LOG_DEBUG, "OpenTherm: Max relative modulation level: %f", data);
         otResponse = ot.buildResponse(OpenThermMessageType::WRITE_ACK, OpenThermMessageID::MaxRelModLevelSetting, request & 0xffff); //ACK for mandatory fields
 
       } break;
     case OpenThermMessageID::RelModLevel: { //mandatory
-        log_message(_F("OpenTherm: Received read relative modulation level"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read relative modulation level");
         otResponse = ot.buildResponse(OpenThermMessageType::DATA_INVALID, OpenThermMessageID::RelModLevel, request & 0xffff); //invalid for now to fill mandatory fields
       } break;
     case OpenThermMessageID::Tboiler: { //mandatory
-        log_message(_F("OpenTherm: Received read boiler flow temp (outlet)"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read boiler flow temp (outlet)");
         if (getOTStructMember(_F("outletTemp"))->value.f > -99) {
           unsigned long data = ot.temperatureToData(getOTStructMember(_F("outletTemp"))->value.f);
           otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::Tboiler, data);
@@ -155,7 +150,7 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
       } break;
     // now adding some more useful, not mandatory, types
     case OpenThermMessageID::RBPflags: { //Pre-Defined Remote Boiler Parameters
-        log_message(_F("OpenTherm: Received Remote Boiler parameters request"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received Remote Boiler parameters request");
         //fixed settings for now - allow read and write DHWset and maxTset remote params
         const unsigned int DHWsetTransfer = true;
         const unsigned int maxCHsetTransfer = true;
@@ -165,7 +160,7 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::RBPflags, responsedata);
       } break;
     case OpenThermMessageID::TdhwSetUBTdhwSetLB : { //DHW boundaries
-        log_message(_F("OpenTherm: Received DHW set boundaries remote parameters request"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received DHW set boundaries remote parameters request");
         //fixed settings for now
         const unsigned int DHWsetUppBound = 75;
         const unsigned int DHWsetLowBound = 40;
@@ -173,7 +168,7 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::TdhwSetUBTdhwSetLB, responsedata);
       } break;
     case OpenThermMessageID::MaxTSetUBMaxTSetLB  : { //CHset boundaries
-        log_message(_F("OpenTherm: Received CH set boundaries remote parameters request"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received CH set boundaries remote parameters request");
         //fixed settings for now, seems valid for most heatpump types
         const unsigned int CHsetUppBound = 65;
         const unsigned int CHsetLowBound = 20;
@@ -184,8 +179,7 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         getOTStructMember(_F("roomTemp"))->value.f = ot.getFloat(request);
         char str[200];
         sprintf_P((char *)&str, PSTR("%.*f"), 4, getOTStructMember(_F("roomTemp"))->value.f);
-        sprintf_P(log_msg, PSTR("OpenTherm: Room temp: %s"), str);
-        log_message(log_msg);
+        logcat_P(LOG_OT, LOG_DEBUG, "OpenTherm: Room temp: %s", str);
         mqttPublish((char*)mqtt_topic_opentherm, _F("roomTemp"), str);
         otResponse = ot.buildResponse(OpenThermMessageType::WRITE_ACK, OpenThermMessageID::Tr, request & 0xffff);
         rules_event_cb(_F("?"), _F("roomtemp"));
@@ -194,8 +188,7 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         getOTStructMember(_F("roomTempSet"))->value.f = ot.getFloat(request);
         char str[200];
         sprintf_P((char *)&str, PSTR("%.*f"), 4, getOTStructMember(_F("roomTempSet"))->value.f);
-        sprintf_P(log_msg, PSTR("OpenTherm: Room setpoint: %s"), str);
-        log_message(log_msg);
+        logcat_P(LOG_OT, LOG_DEBUG, "OpenTherm: Room setpoint: %s", str);
         mqttPublish((char*)mqtt_topic_opentherm, _F("roomTempSet"), str);
         otResponse = ot.buildResponse(OpenThermMessageType::WRITE_ACK, OpenThermMessageID::TrSet, request & 0xffff);
         rules_event_cb(_F("?"), _F("roomtempset"));
@@ -205,13 +198,11 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
           getOTStructMember(_F("dhwSetpoint"))->value.f = ot.getFloat(request);
           char str[200];
           sprintf_P((char *)&str, PSTR("%.*f"), 4, getOTStructMember(_F("dhwSetpoint"))->value.f);
-          sprintf_P(log_msg, PSTR("OpenTherm: Write request DHW setpoint: %s"), str);
-          log_message(log_msg);
+          logcat_P(LOG_OT, LOG_DEBUG, "OpenTherm: Write request DHW setpoint: %s", str);
           mqttPublish((char*)mqtt_topic_opentherm, _F("dhwSetpoint"), str);
           otResponse = ot.buildResponse(OpenThermMessageType::WRITE_ACK, OpenThermMessageID::TdhwSet, ot.temperatureToData(getOTStructMember(_F("dhwSetpoint"))->value.f));
         } else { //READ_DATA
-          sprintf_P(log_msg, PSTR("OpenTherm: Read request DHW setpoint"));
-          log_message(log_msg);
+          logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Read request DHW setpoint");
           otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::TdhwSet, ot.temperatureToData(getOTStructMember(_F("dhwSetpoint"))->value.f));
           rules_event_cb(_F("?"), _F("dhwsetpoint"));
         }
@@ -221,19 +212,17 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
           getOTStructMember(_F("maxTSet"))->value.f = ot.getFloat(request);
           char str[200];
           sprintf_P((char *)&str, PSTR("%.*f"), 4, getOTStructMember(_F("maxTSet"))->value.f);
-          sprintf_P(log_msg, PSTR("OpenTherm: Write request Max Ta-set setpoint: %s"), str);
-          log_message(log_msg);
+          logcat_P(LOG_OT, LOG_DEBUG, "OpenTherm: Write request Max Ta-set setpoint: %s", str);
           mqttPublish((char*)mqtt_topic_opentherm, _F("maxTSet"), str);
           otResponse = ot.buildResponse(OpenThermMessageType::WRITE_ACK, OpenThermMessageID::MaxTSet, ot.temperatureToData(getOTStructMember(_F("maxTSet"))->value.f));
         } else { //READ_DATA
-          sprintf_P(log_msg, PSTR("OpenTherm: Read request Max Ta-set setpoint"));
-          log_message(log_msg);
+          logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Read request Max Ta-set setpoint");
           otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::MaxTSet, ot.temperatureToData(getOTStructMember(_F("maxTSet"))->value.f));
           rules_event_cb(_F("?"), _F("maxtset"));
         }
       } break;
     case OpenThermMessageID::Tret: {
-        log_message(_F("OpenTherm: Received read Tret"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read Tret");
         if (getOTStructMember(_F("inletTemp"))->value.f > -99) {
           unsigned long data = ot.temperatureToData(getOTStructMember(_F("inletTemp"))->value.f);
           otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::Tret, data);
@@ -242,7 +231,7 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         }
       } break;
     case OpenThermMessageID::Tdhw: {
-        log_message(_F("OpenTherm: Received read DHW temp"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read DHW temp");
         if (getOTStructMember(_F("dhwTemp"))->value.f > -99) {
           unsigned long data = ot.temperatureToData(getOTStructMember(_F("dhwTemp"))->value.f);
           otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::Tdhw, data);
@@ -251,7 +240,7 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         }
       } break;
     case OpenThermMessageID::Toutside: {
-        log_message(_F("OpenTherm: Received read outside temp"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read outside temp");
         if (getOTStructMember(_F("outsideTemp"))->value.f > -99) {
           unsigned long data = ot.temperatureToData(getOTStructMember(_F("outsideTemp"))->value.f);
           otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::Toutside, data);
@@ -261,7 +250,7 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
         }
       } break;
     case OpenThermMessageID::TrOverride: {
-        log_message(_F("OpenTherm: Received read room set override temp"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read room set override temp");
         if (getOTStructMember(_F("roomSetOverride"))->value.f > -99) {
           unsigned long data = ot.temperatureToData(getOTStructMember(_F("roomSetOverride"))->value.f);
           otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::TrOverride, data);
@@ -274,38 +263,38 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
       
     /*
       case OpenThermMessageID::ASFflags: {
-        log_message(_F("OpenTherm: Received read ASF flags"));
+        logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read ASF flags");
         otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::ASFflags, 0);
 
       } break;
       case OpenThermMessageID::MaxTSetUBMaxTSetLB: {
-      log_message(_F("OpenTherm: Received read Ta-set bounds"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read Ta-set bounds");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::MaxTSetUBMaxTSetLB, 0x5028);
 
       } break;
       case OpenThermMessageID::TdhwSetUBTdhwSetLB: {
-      log_message(_F("OpenTherm: Received read DHW-set bounds"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read DHW-set bounds");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::TdhwSetUBTdhwSetLB, 0x5028);
 
       } break;
       case OpenThermMessageID::NominalVentilationValue: {
-      log_message(_F("OpenTherm: Received read nominal ventilation value"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read nominal ventilation value");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::NominalVentilationValue, 0);
 
       } break;
       case OpenThermMessageID::RemoteParameterSettingsVH: {
-      log_message(_F("OpenTherm: Received read remote parameters settings"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read remote parameters settings");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::RemoteParameterSettingsVH, 0);
 
       } break;
       
       case OpenThermMessageID::TrOverride: {
-      log_message(_F("OpenTherm: Received read remote override setpoint"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read remote override setpoint");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::TrOverride, 0);
 
       } break;
       case OpenThermMessageID::CHPressure: {
-      log_message(_F("OpenTherm: Received read CH pressure"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read CH pressure");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::CHPressure, 0);
 
       } break;
@@ -313,13 +302,12 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
       float data = ot.getFloat(request);
       char str[200];
       sprintf_P((char *)&str, PSTR("%.*f"), 4, data);
-      sprintf_P(log_msg, PSTR("OpenTherm: OT Master version: %s"), str);
-      log_message(log_msg);
+      logcat_P(LOG_OT, LOG_DEBUG, "OpenTherm: OT Master version: %s", str);
       otResponse = ot.buildResponse(OpenThermMessageType::WRITE_ACK, OpenThermMessageID::OpenThermVersionMaster, request & 0xffff);
 
       } break;
       case OpenThermMessageID::OpenThermVersionSlave: {
-      log_message(_F("OpenTherm: Received read OT slave version"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read OT slave version");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::OpenThermVersionSlave, 0);
 
       } break;
@@ -327,38 +315,36 @@ void processOTRequest(unsigned long request, OpenThermResponseStatus status) {
       float data = ot.getFloat(request);
       char str[200];
       sprintf_P((char *)&str, PSTR("%.*f"), 4, data);
-      sprintf_P(log_msg, PSTR("OpenTherm: Master device version: %s"), str);
-      log_message(log_msg);
+      logcat_P(LOG_OT, LOG_DEBUG, "OpenTherm: Master device version: %s", str);
       otResponse = ot.buildResponse(OpenThermMessageType::WRITE_ACK, OpenThermMessageID::MasterVersion, request & 0xffff);
 
 
       } break;
       case OpenThermMessageID::SlaveVersion: {
-      log_message(_F("OpenTherm: Received read slave device version"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read slave device version");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::SlaveVersion, 0);
 
       } break;
 
       case OpenThermMessageID::TSP: {
-      log_message(_F("OpenTherm: Received read TSP"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read TSP");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::TSP, 0);
 
       } break;
       case OpenThermMessageID::FHBsize: {
-      log_message(_F("OpenTherm: Received read fault buffer size"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read fault buffer size");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::FHBsize, 0);
 
       } break;
 
       case OpenThermMessageID::RemoteOverrideFunction: {
-      log_message(_F("OpenTherm: Received read remote override function"));
+      logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: Received read remote override function");
       otResponse = ot.buildResponse(OpenThermMessageType::READ_ACK, OpenThermMessageID::RemoteOverrideFunction, 0);
 
       } break;
     */
     default: {
-        sprintf_P(log_msg, PSTR("OpenTherm: Unknown data ID: %d (%#010x)"), ot.getDataID(request), request);
-        log_message(log_msg);
+        logcat_P(LOG_OT, LOG_DEBUG, "OpenTherm: Unknown data ID: %d (%#010x)", ot.getDataID(request), request);
         otResponse = ot.buildResponse(OpenThermMessageType::UNKNOWN_DATA_ID, ot.getDataID(request), 0);
       } break;
 
@@ -392,49 +378,49 @@ void HeishaOTLoop(char * actData, PubSubClient &mqtt_client, char* mqtt_topic_ba
 
 void mqttOTCallback(char* topic, char* value) {
   //only READ values(strcmp_P(PSTR("dhwTem can be overwritten using received mqtt messages
-  //log_message(_F("OpenTherm: MQTT message received"));
+  //logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received");
   if (strcmp_P(PSTR("outsideTemp"), topic) == 0) {
-    log_message(_F("OpenTherm: MQTT message received 'outsideTemp'"));
+    logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received 'outsideTemp'");
     getOTStructMember(_F("outsideTemp"))->value.f = String(value).toFloat();
     rules_event_cb(_F("?"), topic);
   }
   else if (strcmp_P(PSTR("inletTemp"), topic) == 0) {
-    log_message(_F("OpenTherm: MQTT message received 'inletTemp'"));
+    logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received 'inletTemp'");
     getOTStructMember(_F("inletTemp"))->value.f = String(value).toFloat();
     rules_event_cb(_F("?"), topic);
   }
   else if (strcmp_P(PSTR("outletTemp"), topic) == 0) {
-    log_message(_F("OpenTherm: MQTT message received 'outletTemp'"));
+    logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received 'outletTemp'");
     getOTStructMember(_F("outletTemp"))->value.f = String(value).toFloat();
     rules_event_cb(_F("?"), topic);
   }
   else if (strcmp_P(PSTR("dhwTemp"), topic) == 0) {
-    log_message(_F("OpenTherm: MQTT message received 'dhwTemp'"));
+    logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received 'dhwTemp'");
     getOTStructMember(_F("dhwTemp"))->value.f = String(value).toFloat();
     rules_event_cb(_F("?"), topic);
   }
   else if (strcmp_P(PSTR("dhwSetpoint"), topic) == 0) {
-    log_message(_F("OpenTherm: MQTT message received 'dhwSetpoint'"));
+    logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received 'dhwSetpoint'");
     getOTStructMember(_F("dhwSetpoint"))->value.f = String(value).toFloat();
     rules_event_cb(_F("?"), topic);
   }
   else if (strcmp_P(PSTR("maxTSet"), topic) == 0) {
-    log_message(_F("OpenTherm: MQTT message received 'maxTSet'"));
+    logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received 'maxTSet'");
     getOTStructMember(_F("maxTSet"))->value.f = String(value).toFloat();
     rules_event_cb(_F("?"), topic);
   }
   else if (strcmp_P(PSTR("flameState"), topic) == 0) {
-    log_message(_F("OpenTherm: MQTT message received 'flameState'"));
+    logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received 'flameState'");
     getOTStructMember(_F("flameState"))->value.b = ((stricmp((char*)"true", value) == 0) || (String(value).toInt() == 1 ));
     rules_event_cb(_F("?"), topic);
   }
   else if (strcmp_P(PSTR("chState"), topic) == 0) {
-    log_message(_F("OpenTherm: MQTT message received 'chState'"));
+    logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received 'chState'");
     getOTStructMember(_F("chState"))->value.b = ((stricmp((char*)"true", value) == 0) || (String(value).toInt() == 1 ));
     rules_event_cb(_F("?"), topic);
   }
   else if (strcmp_P(PSTR("dhwState"), topic) == 0) {
-    log_message(_F("OpenTherm: MQTT message received 'dhwState'"));
+    logcatln_P(LOG_OT, LOG_DEBUG, "OpenTherm: MQTT message received 'dhwState'");
     getOTStructMember(_F("dhwState"))->value.b = ((stricmp((char*)"true", value) == 0) || (String(value).toInt() == 1 ));
     rules_event_cb(_F("?"), topic);
   }
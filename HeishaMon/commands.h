@@ -29,6 +29,18 @@ extern const char* mqtt_willtopic;
 extern const char* mqtt_iptopic;
 extern const char* mqtt_send_raw_value_topic;
 
+// compact ids for the mqtt outbox, see mqttTopic() for the topics they stand for
+#define MQTT_TOPIC_ID_GROUP  0xFC00
+#define MQTT_TOPIC_ID_MAIN   0x0000 // | topic number
+#define MQTT_TOPIC_ID_EXTRA  0x0400 // | topic number
+#define MQTT_TOPIC_ID_OPT    0x0800 // | topic number
+#define MQTT_TOPIC_ID_1WIRE  0x0C00 // | sensor number
+#define MQTT_TOPIC_ID_S0     0x1000 // | kind << 4 | port
+
+#define MQTT_S0_WATTHOUR       0
+#define MQTT_S0_WATTHOUR_TOTAL 1
+#define MQTT_S0_WATT           2
+
 unsigned int set_heatpump_state(char *msg, unsigned char *cmd, char *log_msg);
 unsigned int set_pump(char *msg, unsigned char *cmd, char *log_msg);
 unsigned int set_max_pump_duty(char *msg, unsigned char *cmd, char *log_msg);
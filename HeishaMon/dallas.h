@@ -17,9 +17,11 @@ struct dallasDataStruct {
 };
 
 void resetlastalldatatime_dallas();
+const char *dallasAddress(uint8_t sensor);
 void dallasLoop(PubSubClient &mqtt_client, void (*log_message)(char*), char* mqtt_topic_base);
 void initDallasSensors(void (*log_message)(char*), unsigned int updataAllDallasTimeSettings, unsigned int dallasTimerWaitSettings, unsigned int dallasResolution);
 void dallasJsonOutput(struct webserver_t *client);
 void dallasTableOutput(struct webserver_t *client);
+void dallasMetricsOutput(struct webserver_t *client);
 
 #endif
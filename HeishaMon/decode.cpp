@@ -2,11 +2,57 @@
 #include "commands.h"
 #include "rules.h"
 #include "src/common/progmem.h"
+#include "src/common/webserver.h"
+#include "src/common/log.h"
+#include "src/common/outbox.h"
+#include "webfunctions.h"
 
 unsigned long lastalldatatime = 0;
 unsigned long lastallextradatatime = 0;
 unsigned long lastalloptdatatime = 0;
 
+/*
+ * Changed topic values are batched into websocket
+ * messages of this size for the live web tables.
+ */
+#define WEBSOCKET_VALUES_SIZE 512
+
+static char websocketValues[WEBSOCKET_VALUES_SIZE];
+static uint16_t websocketValuesLen = 0;
+
+static void websocketValuesFlush() {
+  if (websocketValuesLen > 0) {
+    websocketValues[websocketValuesLen++] = ']';
+    websocketValues[websocketValuesLen++] = '}';
+    websocket_write_all(websocketValues, websocketValuesLen);
+    webserver_events_all(EVENTS_VALUES, PSTR("values"), websocketValues, websocketValuesLen);
+    websocketValuesLen = 0;
+  }
+}
+
+static void websocketValuesAdd(const char *prefix, unsigned int Topic_Number, String &Topic_Value, const char **description) {
+  char entry[128];
+  int maxvalue = atoi(description[0]);
+  int value = Topic_Value.toInt();
+  if (maxvalue == 0) { //this takes the special case where the description is a real value description instead of a mode, so value should take first index (= 0 + 1)
+    value = 0;
+  }
+  int len = snprintf_P(entry, sizeof(entry), PSTR("[\"%s%d\",\"%s\",\"%s\"]"), prefix, Topic_Number, Topic_Value.c_str(), ((value < 0) || (value > maxvalue)) ? _unknown : description[value + 1]);
+  if (len >= (int)sizeof(entry)) {
+    return;
+  }
+  if (websocketValuesLen + len + 3 > WEBSOCKET_VALUES_SIZE) {
+    websocketValuesFlush();
+  }
+  if (websocketValuesLen == 0) {
+    websocketValuesLen = snprintf_P(websocketValues, WEBSOCKET_VALUES_SIZE, PSTR("{\"values\":["));
+  } else {
+    websocketValues[websocketValuesLen++] = ',';
+  }
+  memcpy(&websocketValues[websocketValuesLen], entry, len);
+  websocketValuesLen += len;
+}
+
 String getBit1(byte input) {
   return String(input  >> 7);
 }
@@ -283,6 +329,17 @@ String getSecondByte(byte input) {
 
 
 
+// name of a main, extra or optional topic id as queued in the mqtt outbox, NULL if it has none
+PGM_P decode_topic_name(uint16_t id) {
+  uint16_t nr = id & ~MQTT_TOPIC_ID_GROUP;
+  switch (id & MQTT_TOPIC_ID_GROUP) {
+    case MQTT_TOPIC_ID_MAIN: return (nr < NUMBER_OF_TOPICS) ? topics[nr] : NULL;
+    case MQTT_TOPIC_ID_EXTRA: return (nr < NUMBER_OF_TOPICS_EXTRA) ? xtopics[nr] : NULL;
+    case MQTT_TOPIC_ID_OPT: return (nr < NUMBER_OF_OPT_TOPICS) ? optTopics[nr] : NULL;
+  }
+  return NULL;
+}
+
 // Decode ////////////////////////////////////////////////////////////////////////////
 void decode_heatpump_data(char* data, char* actData, PubSubClient &mqtt_client, void (*log_message)(char*), char* mqtt_topic_base, unsigned int updateAllTime) {
   bool updatenow = false;
@@ -293,17 +350,18 @@ void decode_heatpump_data(char* data, char* actData, PubSubClient &mqtt_client,
   for (unsigned int Topic_Number = 0 ; Topic_Number < NUMBER_OF_TOPICS ; Topic_Number++) {
     String Topic_Value;
     Topic_Value = getDataValue(data, Topic_Number);
+    bool changed = getDataValue(actData, Topic_Number) != Topic_Value;
 
-    if ((updatenow) || ( getDataValue(actData, Topic_Number) != Topic_Value )) {
-      char log_msg[256];
-      char mqtt_topic[256];
-      sprintf_P(log_msg, PSTR("received TOP%d %s: %s"), Topic_Number, topics[Topic_Number], Topic_Value.c_str());
-      log_message(log_msg);
-      sprintf_P(mqtt_topic, PSTR("%s/%s/%s"), mqtt_topic_base, mqtt_topic_values, topics[Topic_Number]);
-      mqtt_client.publish(mqtt_topic, Topic_Value.c_str(), MQTT_RETAIN_VALUES);
+    if (changed) {
+      websocketValuesAdd(PSTR("TOP"), Topic_Number, Topic_Value, topicDescription[Topic_Number]);
+    }
+    if ((updatenow) || (changed)) {
+      logcat_P(LOG_DECODE, LOG_DEBUG, "received TOP%d %s: %s", Topic_Number, topics[Topic_Number], Topic_Value.c_str());
+      outbox_publish(MQTT_TOPIC_ID_MAIN | Topic_Number, Topic_Value.c_str(), Topic_Value.length(), MQTT_RETAIN_VALUES);
       rules_event_cb(_F("@"), topics[Topic_Number]);
     }
   }
+  websocketValuesFlush();
 }
 
 void decode_heatpump_data_extra(char* data, char* actDataExtra, PubSubClient &mqtt_client, void (*log_message)(char*), char* mqtt_topic_base, unsigned int updateAllTime) {
@@ -315,17 +373,18 @@ void decode_heatpump_data_extra(char* data, char* actDataExtra, PubSubClient &mq
   for (unsigned int Topic_Number = 0 ; Topic_Number < NUMBER_OF_TOPICS_EXTRA ; Topic_Number++) {
     String Topic_Value;
     Topic_Value = getDataValueExtra(data, Topic_Number);
-    
-    if ((updatenow) || ( getDataValueExtra(actDataExtra, Topic_Number) != Topic_Value )) {
-      char log_msg[256];
-      char mqtt_topic[256];
-      sprintf_P(log_msg, PSTR("received XTOP%d %s: %s"), Topic_Number, xtopics[Topic_Number], Topic_Value.c_str());
-      log_message(log_msg);
-      sprintf_P(mqtt_topic, PSTR("%s/%s/%s"), mqtt_topic_base, mqtt_topic_xvalues, xtopics[Topic_Number]);
-      mqtt_client.publish(mqtt_topic, Topic_Value.c_str(), MQTT_RETAIN_VALUES);
+    bool changed = getDataValueExtra(actDataExtra, Topic_Number) != Topic_Value;
+
+    if (changed) {
+      websocketValuesAdd(PSTR("XTOP"), Topic_Number, Topic_Value, xtopicDescription[Topic_Number]);
+    }
+    if ((updatenow) || (changed)) {
+      logcat_P(LOG_DECODE, LOG_DEBUG, "received XTOP%d %s: %s", Topic_Number, xtopics[Topic_Number], Topic_Value.c_str());
+      outbox_publish(MQTT_TOPIC_ID_EXTRA | Topic_Number, Topic_Value.c_str(), Topic_Value.length(), MQTT_RETAIN_VALUES);
       rules_event_cb(_F("@"), xtopics[Topic_Number]);
     }
   }
+  websocketValuesFlush();
 }
 
 void decode_optional_heatpump_data(char* data, char* actOptData, PubSubClient & mqtt_client, void (*log_message)(char*), char* mqtt_topic_base, unsigned int updateAllTime) {
@@ -339,12 +398,8 @@ void decode_optional_heatpump_data(char* data, char* actOptData, PubSubClient &
     Topic_Value = getOptDataValue(data, Topic_Number);
 
     if ((updatenow) || ( getOptDataValue(actOptData, Topic_Number) != Topic_Value )) {
-      char log_msg[256];
-      char mqtt_topic[256];
-      sprintf_P(log_msg, PSTR("received OPT%d %s: %s"), Topic_Number, optTopics[Topic_Number], Topic_Value.c_str());
-      log_message(log_msg);
-      sprintf_P(mqtt_topic, PSTR("%s/%s/%s"), mqtt_topic_base, mqtt_topic_pcbvalues, optTopics[Topic_Number]);
-      mqtt_client.publish(mqtt_topic, Topic_Value.c_str(), MQTT_RETAIN_VALUES);
+      logcat_P(LOG_DECODE, LOG_DEBUG, "received OPT%d %s: %s", Topic_Number, optTopics[Topic_Number], Topic_Value.c_str());
+      outbox_publish(MQTT_TOPIC_ID_OPT | Topic_Number, Topic_Value.c_str(), Topic_Value.length(), MQTT_RETAIN_VALUES);
       rules_event_cb(_F("@"), optTopics[Topic_Number]);
     }
   }
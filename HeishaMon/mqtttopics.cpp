@@ -0,0 +1,119 @@
+#include "mqtttopics.h"
+#include "commands.h"
+#include "decode.h"
+#include "dallas.h"
+
+#define MQTT_TOPIC_GROUPS 5 // main, extra, optional, 1wire, s0
+#define MQTT_TOPIC_NAMES (NUMBER_OF_TOPICS + NUMBER_OF_TOPICS_EXTRA + NUMBER_OF_OPT_TOPICS)
+
+/*
+ * All topic prefixes and heatpump topic names after each other, zero terminated, so
+ * a topic is put together with two memcpy's instead of a sprintf_P per publish. With
+ * short topics the heatpump values are published as <base>/TOP<n>, <base>/XTOP<n> and
+ * <base>/OPT<n> and the names are not needed.
+ */
+static char* topicTable = NULL;
+static uint16_t topicOffsets[MQTT_TOPIC_GROUPS + MQTT_TOPIC_NAMES + 1];
+static bool topicShort = false;
+
+static const uint16_t topicGroupSize[3] = { NUMBER_OF_TOPICS, NUMBER_OF_TOPICS_EXTRA, NUMBER_OF_OPT_TOPICS };
+
+static uint16_t topicString(uint16_t nr, const char** str) {
+  *str = &topicTable[topicOffsets[nr]];
+  return topicOffsets[nr + 1] - topicOffsets[nr] - 1;
+}
+
+// name of the i-th heatpump topic, counting main, extra and optional topics after each other
+static PGM_P topicName(uint16_t i) {
+  if (i < NUMBER_OF_TOPICS) return decode_topic_name(MQTT_TOPIC_ID_MAIN | i);
+  i -= NUMBER_OF_TOPICS;
+  if (i < NUMBER_OF_TOPICS_EXTRA) return decode_topic_name(MQTT_TOPIC_ID_EXTRA | i);
+  return decode_topic_name(MQTT_TOPIC_ID_OPT | (i - NUMBER_OF_TOPICS_EXTRA));
+}
+
+void mqttTopicsInit(const char* base, bool shortTopics) {
+  const char* groups[MQTT_TOPIC_GROUPS] = { mqtt_topic_values, mqtt_topic_xvalues, mqtt_topic_pcbvalues, mqtt_topic_1wire, mqtt_topic_s0 };
+  const char* shortGroups[3] = { "TOP", "XTOP", "OPT" };
+  uint16_t nrNames = shortTopics ? 0 : MQTT_TOPIC_NAMES;
+  uint16_t size = 0;
+
+  topicShort = shortTopics;
+
+  for (uint8_t i = 0; i < MQTT_TOPIC_GROUPS; i++) {
+    size += strlen(base) + 1 + ((shortTopics && i < 3) ? strlen(shortGroups[i]) : strlen(groups[i]) + 1) + 1;
+  }
+  for (uint16_t i = 0; i < nrNames; i++) {
+    size += strlen_P(topicName(i)) + 1;
+  }
+
+  free(topicTable);
+  topicTable = (char*)malloc(size);
+  if (topicTable == NULL) {
+    return;
+  }
+
+  uint16_t pos = 0;
+  for (uint8_t i = 0; i < MQTT_TOPIC_GROUPS; i++) {
+    topicOffsets[i] = pos;
+    if (shortTopics && i < 3) {
+      pos += sprintf(&topicTable[pos], "%s/%s", base, shortGroups[i]) + 1;
+    } else {
+      pos += sprintf(&topicTable[pos], "%s/%s/", base, groups[i]) + 1;
+    }
+  }
+  for (uint16_t i = 0; i < nrNames; i++) {
+    topicOffsets[MQTT_TOPIC_GROUPS + i] = pos;
+    strcpy_P(&topicTable[pos], topicName(i));
+    pos += strlen(&topicTable[pos]) + 1;
+  }
+  topicOffsets[MQTT_TOPIC_GROUPS + nrNames] = pos;
+}
+
+uint16_t mqttTopic(uint16_t id, char* buf, uint16_t size) {
+  uint8_t group = (id & MQTT_TOPIC_ID_GROUP) >> 10;
+  uint16_t nr = id & ~MQTT_TOPIC_ID_GROUP;
+  const char* str = NULL;
+  char num[8];
+
+  if (topicTable == NULL || group >= MQTT_TOPIC_GROUPS) return 0;
+
+  uint16_t len = topicString(group, &str);
+  if (len >= size) return 0;
+  memcpy(buf, str, len);
+
+  uint16_t slen = 0;
+  if (group < 3) {
+    if (nr >= topicGroupSize[group]) return 0;
+    if (topicShort) {
+      utoa(nr, num, 10);
+      str = num;
+      slen = strlen(num);
+    } else {
+      uint16_t name = MQTT_TOPIC_GROUPS + nr;
+      for (uint8_t i = 0; i < group; i++) {
+        name += topicGroupSize[i];
+      }
+      slen = topicString(name, &str);
+    }
+  } else if ((id & MQTT_TOPIC_ID_GROUP) == MQTT_TOPIC_ID_1WIRE) {
+    str = dallasAddress(nr);
+    if (str == NULL) return 0;
+    slen = strlen(str);
+  } else {
+    uint8_t kind = (nr >> 4) & 0x0F;
+    if (kind > MQTT_S0_WATT) return 0;
+    PGM_P kindName = (kind == MQTT_S0_WATTHOUR) ? PSTR("Watthour/") : (kind == MQTT_S0_WATTHOUR_TOTAL) ? PSTR("WatthourTotal/") : PSTR("Watt/");
+    slen = strlen_P(kindName);
+    if (len + slen >= size) return 0;
+    memcpy_P(&buf[len], kindName, slen);
+    len += slen;
+    utoa(nr & 0x0F, num, 10);
+    str = num;
+    slen = strlen(num);
+  }
+  if (len + slen >= size) return 0;
+  memcpy(&buf[len], str, slen);
+  len += slen;
+  buf[len] = 0;
+  return len;
+}
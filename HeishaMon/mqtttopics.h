@@ -0,0 +1,11 @@
+#ifndef _MQTTTOPICS_H_
+#define _MQTTTOPICS_H_
+
+#include <Arduino.h>
+
+// builds the topic table for the mqtt outbox, call again after the topic base changed
+void mqttTopicsInit(const char* base, bool shortTopics);
+// turns the topic ids used in the mqtt outbox back into the full topic
+uint16_t mqttTopic(uint16_t id, char* buf, uint16_t size);
+
+#endif
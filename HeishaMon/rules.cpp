@@ -13,12 +13,15 @@
 #include <Arduino.h>
 #include <LittleFS.h>
 
+#include "rules.h"
+
 #include "src/common/mem.h"
 #include "src/common/stricmp.h"
 #include "src/common/strnicmp.h"
 #include "src/common/log.h"
 #include "src/common/timerqueue.h"
 #include "src/rules/rules.h"
+#include "src/rules/functions/window.h"
 
 #include "dallas.h"
 #include "webfunctions.h"
@@ -70,8 +73,23 @@ typedef struct varstack_t {
   unsigned int nrbytes;
   unsigned int bufsize;
   unsigned char *stack;
+  /*
+   * Hash of the rule block source,
+   * see rules_split.
+   */
+  uint32_t hash;
 } varstack_t;
 
+typedef struct rule_block_t {
+  unsigned int offset;
+  unsigned int len;
+  /*
+   * Of the minified text
+   */
+  unsigned int size;
+  uint32_t hash;
+} rule_block_t;
+
 static struct varstack_t global_varstack;
 
 static struct vm_vinteger_t vinteger;
@@ -341,33 +359,25 @@ static int event_cb(struct rules_t *obj, char *name) {
   struct rules_t *called = NULL;
   int i = 0, x = 0;
 
-  if(obj->caller > 0 && name == NULL) {
-    called = rules[obj->caller-1];
-
-    obj->caller = 0;
-
-    return rule_run(called, 0);
-  } else {
-    for(x=0;x<nrrules;x++) {
-      if(get_event(rules[x]) > -1) {
-        if(strnicmp(name, (char *)&rules[x]->ast.buffer[get_event(rules[x])+5], strlen((char *)&rules[x]->ast.buffer[get_event(rules[x])+5])) == 0) {
-          called = rules[x];
-          break;
-        }
-      }
-      if(called != NULL) {
+  for(x=0;x<nrrules;x++) {
+    if(get_event(rules[x]) > -1) {
+      if(strnicmp(name, (char *)&rules[x]->ast.buffer[get_event(rules[x])+5], strlen((char *)&rules[x]->ast.buffer[get_event(rules[x])+5])) == 0) {
+        called = rules[x];
         break;
       }
     }
-
     if(called != NULL) {
-      called->caller = obj->nr;
-
-      return rule_run(called, 0);
-    } else {
-      return rule_run(obj, 0);
+      break;
     }
   }
+
+  if(called != NULL) {
+    called->caller = obj->nr;
+
+    return rule_run(called, 0);
+  } else {
+    return rule_run(obj, 0);
+  }
 }
 
 static void vm_value_clr(struct rules_t *obj, uint16_t token) {
@@ -1394,6 +1404,18 @@ static void vm_clear_values(struct rules_t *obj) {
   }
 }
 
+/*
+ * Tell the /events listeners which rule ran and how long it took
+ */
+static void rules_event_notify(struct rules_t *rule, char *token) {
+  char msg[128];
+  int x = snprintf_P(msg, sizeof(msg), PSTR("{\"event\":\"%s\",\"rule\":%d,\"us\":%lu}"),
+                     token, rule->nr, (unsigned long)(rule->timestamp.second - rule->timestamp.first));
+  if(x > 0 && x < (int)sizeof(msg)) {
+    webserver_events_all(EVENTS_RULES, PSTR("rules"), msg, x);
+  }
+}
+
 void rules_timer_cb(int nr) {
   char *name = NULL;
   int x = 0, i = 0;
@@ -1409,17 +1431,28 @@ void rules_timer_cb(int nr) {
 
   for(x=0;x<nrrules;x++) {
     if(get_event(rules[x]) > -1 && stricmp((char *)&rules[x]->ast.buffer[get_event(rules[x])+5], name) == 0) {
+      struct vm_tevent_t *node = (struct vm_tevent_t *)&rules[x]->ast.buffer[get_event(rules[x])];
+
+      rules[x]->timestamp.first = micros();
+
       rule_run(rules[x], 0);
 
-      char out[512];
-      memset(&out, 0, 512);
-      logprintln_P(F("\n>>> local variables\n"));
-      vm_value_prt(rules[x], (char *)&out, 512);
-      logprintf_P(F("%s"), out);
-      logprintf_P(F("\n>>> global variables\n"));
-      memset(&out, 0, 512);
-      vm_global_value_prt((char *)&out, 512);
-      logprintf_P(F("%s"), out);
+      rules[x]->timestamp.second = micros();
+      rules_event_notify(rules[x], (char *)node->token);
+
+      if(log_enabled(LOG_RULES, LOG_DEBUG)) {
+        char out[512];
+        logprintf_P(F("%s%d %s %d %s"), F("rule #"), rules[x]->nr, F("was executed in"), rules[x]->timestamp.second - rules[x]->timestamp.first, F("microseconds"));
+
+        logprintln_P(F("\n>>> local variables"));
+        memset(&out, 0, sizeof(out));
+        vm_value_prt(rules[x], (char *)&out, sizeof(out));
+        logprintln(out);
+        logprintln_P(F(">>> global variables"));
+        memset(&out, 0, sizeof(out));
+        vm_global_value_prt((char *)&out, sizeof(out));
+        logprintln(out);
+      }
 
       break;
     }
@@ -1427,9 +1460,817 @@ void rules_timer_cb(int nr) {
   FREE(name);
 }
 
+/*
+ * Time#HH:MM events are served by a single timer
+ * that fires at the first upcoming event.
+ */
+static int time_last = -1;
+
+static int rules_time_event(struct rules_t *obj) {
+  int event = get_event(obj), hour = 0, minute = 0, len = 0;
+  if(event == -1) {
+    return -1;
+  }
+  char *token = (char *)&obj->ast.buffer[event+5];
+  if(strnicmp(token, "time#", 5) != 0) {
+    return -1;
+  }
+  token = &token[5];
+  len = strlen(token);
+  if(len < 4 || len > 5 || token[len-3] != ':' ||
+     !isdigit(token[0]) || !isdigit(token[len-4]) ||
+     !isdigit(token[len-2]) || !isdigit(token[len-1])) {
+    return -1;
+  }
+  hour = atoi(token);
+  minute = atoi(&token[len-2]);
+  if(hour > 23 || minute > 59) {
+    return -1;
+  }
+  return hour*60 + minute;
+}
+
+static void rules_time_schedule(void) {
+  time_t now = time(NULL);
+  struct tm *tm_struct = localtime(&now);
+  int minute = tm_struct->tm_hour*60 + tm_struct->tm_min;
+  int x = 0, event = 0, diff = 0, next = -1;
+
+  if(time_last == -1) {
+    time_last = minute;
+  }
+
+  for(x=0;x<nrrules;x++) {
+    if((event = rules_time_event(rules[x])) > -1) {
+      diff = (event - minute + 1440) % 1440;
+      if(diff == 0) {
+        diff = 1440;
+      }
+      if(next == -1 || diff < next) {
+        next = diff;
+      }
+    }
+  }
+
+  if(next == -1) {
+    /*
+     * Removes the timer if it is still pending
+     */
+    timerqueue_insert(0, 0, RULES_TIME_TIMER);
+  } else {
+    /*
+     * Wake up at least every hour, so changes
+     * to the system time are picked up.
+     */
+    timerqueue_insert(MIN(next*60 - tm_struct->tm_sec, 3600), 0, RULES_TIME_TIMER);
+  }
+}
+
+void rules_time_cb(void) {
+  time_t now = time(NULL);
+  struct tm *tm_struct = localtime(&now);
+  int minute = tm_struct->tm_hour*60 + tm_struct->tm_min;
+  int x = 0, event = 0, diff = (minute - time_last + 1440) % 1440;
+
+  /*
+   * Run all events since the last check. Skip them
+   * when the clock jumped, e.g. after the first sync.
+   */
+  if(diff > 0 && diff <= 60) {
+    for(x=0;x<nrrules;x++) {
+      if((event = rules_time_event(rules[x])) > -1) {
+        event = (event - time_last + 1440) % 1440;
+        if(event > 0 && event <= diff) {
+          struct vm_tevent_t *node = (struct vm_tevent_t *)&rules[x]->ast.buffer[get_event(rules[x])];
+          if(log_enabled(LOG_RULES, LOG_DEBUG)) {
+            logprintf_P(F("%s %s %s"), F("===="), node->token, F("===="));
+          }
+
+          rules[x]->timestamp.first = micros();
+
+          rule_run(rules[x], 0);
+
+          rules[x]->timestamp.second = micros();
+          rules_event_notify(rules[x], (char *)node->token);
+
+          if(log_enabled(LOG_RULES, LOG_DEBUG)) {
+            char out[512];
+            logprintf_P(F("%s%d %s %d %s"), F("rule #"), rules[x]->nr, F("was executed in"), rules[x]->timestamp.second - rules[x]->timestamp.first, F("microseconds"));
+
+            logprintln_P(F("\n>>> local variables"));
+            memset(&out, 0, sizeof(out));
+            vm_value_prt(rules[x], (char *)&out, sizeof(out));
+            logprintln(out);
+            logprintln_P(F(">>> global variables"));
+            memset(&out, 0, sizeof(out));
+            vm_global_value_prt((char *)&out, sizeof(out));
+            logprintln(out);
+          }
+        }
+      }
+    }
+  }
+  time_last = minute;
+
+  rules_time_schedule();
+}
+
+#define BUFFER_SIZE 128
+#define RULE_HASH_OFFSET 2166136261UL
+#define RULE_HASH_PRIME 16777619UL
+
+/*
+ * Rules are read from the filesystem through a small
+ * buffer. Comments are stripped and whitespace outside
+ * of quotes is folded into a single space, so only the
+ * text the parser actually needs ends up in the mempool.
+ */
+typedef struct rule_reader_t {
+  uint8_t quote;
+  uint8_t space;
+  uint8_t slash;
+  uint8_t comment;
+  uint8_t empty;
+} rule_reader_t;
+
+static void rules_reader_init(struct rule_reader_t *reader) {
+  memset(reader, 0, sizeof(struct rule_reader_t));
+  reader->empty = 1;
+}
+
+/*
+ * Returns the number of characters written to out,
+ * which is at most three.
+ */
+static uint8_t rules_minify(struct rule_reader_t *reader, char c, char *out) {
+  uint8_t n = 0;
+
+  if(reader->comment == 1) {
+    if(c == '\n') {
+      reader->comment = 0;
+      reader->space = 1;
+    }
+    return 0;
+  }
+
+  if(reader->quote > 0) {
+    if(c == reader->quote) {
+      reader->quote = 0;
+    }
+    out[n++] = c;
+    return n;
+  }
+
+  if(reader->slash == 1) {
+    reader->slash = 0;
+    /*
+     * Comments run from '//' to the end of the line
+     */
+    if(c == '/') {
+      reader->comment = 1;
+      return 0;
+    }
+    if(reader->space == 1 && reader->empty == 0) {
+      out[n++] = ' ';
+    }
+    out[n++] = '/';
+    reader->space = 0;
+    reader->empty = 0;
+  }
+
+  if(c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+    reader->space = 1;
+    return n;
+  }
+
+  if(c == '/' && (reader->space == 1 || reader->empty == 1)) {
+    reader->slash = 1;
+    return n;
+  }
+
+  if(reader->space == 1 && reader->empty == 0) {
+    out[n++] = ' ';
+  }
+  if(c == '"' || c == '\'') {
+    reader->quote = c;
+  }
+  out[n++] = c;
+  reader->space = 0;
+  reader->empty = 0;
+
+  return n;
+}
+
+static uint8_t rules_minify_flush(struct rule_reader_t *reader, char *out) {
+  uint8_t n = 0;
+  if(reader->slash == 1) {
+    reader->slash = 0;
+    if(reader->space == 1 && reader->empty == 0) {
+      out[n++] = ' ';
+    }
+    out[n++] = '/';
+  }
+  return n;
+}
+
+typedef struct rule_splitter_t {
+  struct rule_block_t *blocks;
+  int nrblocks;
+  unsigned int start;
+  char pending[2];
+  uint8_t match;
+  uint8_t quote;
+  uint8_t space;
+  uint8_t first;
+} rule_splitter_t;
+
+static void rules_split_put(struct rule_splitter_t *splitter, char c) {
+  struct rule_block_t *block = &splitter->blocks[splitter->nrblocks-1];
+  if(splitter->space == 1) {
+    block->hash = (block->hash ^ ' ') * RULE_HASH_PRIME;
+    block->size++;
+  }
+  splitter->space = 0;
+  block->hash = (block->hash ^ (uint8_t)c) * RULE_HASH_PRIME;
+  block->size++;
+}
+
+/*
+ * Feed the minified text. A new block starts at each
+ * 'on' keyword. Trailing spaces are only added to a
+ * block when more text follows.
+ */
+static void rules_split_char(struct rule_splitter_t *splitter, char c, unsigned int pos) {
+  if(splitter->quote > 0) {
+    rules_split_put(splitter, c);
+    if(c == splitter->quote) {
+      splitter->quote = 0;
+    }
+    return;
+  }
+
+  if(splitter->match == 2) {
+    struct rule_block_t *block = &splitter->blocks[splitter->nrblocks-1];
+    splitter->match = 0;
+    /*
+     * Any blocks beyond the maximum number of rules
+     * end up in the last one.
+     */
+    if(c == ' ' && (block->size == 0 || splitter->nrblocks < 64)) {
+      if(block->size > 0) {
+        block->len = splitter->start - block->offset;
+        block = &splitter->blocks[splitter->nrblocks++];
+      }
+      block->offset = splitter->start;
+      block->size = 0;
+      block->hash = RULE_HASH_OFFSET;
+      splitter->space = 0;
+      rules_split_put(splitter, splitter->pending[0]);
+      rules_split_put(splitter, splitter->pending[1]);
+      splitter->space = 1;
+      splitter->first = 1;
+      return;
+    }
+    rules_split_put(splitter, splitter->pending[0]);
+    rules_split_put(splitter, splitter->pending[1]);
+  } else if(splitter->match == 1) {
+    splitter->match = 0;
+    if(c == 'n' || c == 'N') {
+      splitter->pending[1] = c;
+      splitter->match = 2;
+      return;
+    }
+    rules_split_put(splitter, splitter->pending[0]);
+  }
+
+  if(c == ' ') {
+    splitter->space = 1;
+    splitter->first = 1;
+    return;
+  }
+
+  if(splitter->first == 1 && (c == 'o' || c == 'O')) {
+    splitter->pending[0] = c;
+    splitter->start = pos;
+    splitter->match = 1;
+    splitter->first = 0;
+    return;
+  }
+
+  if(c == '"' || c == '\'') {
+    splitter->quote = c;
+  }
+  splitter->first = 0;
+  rules_split_put(splitter, c);
+
+  return;
+}
+
+/*
+ * Split the rules file in its 'on ... end' blocks.
+ * Each block gets the hash and size of its minified
+ * text. Returns the number of blocks.
+ */
+static int rules_split(File &frules, struct rule_block_t *blocks) {
+  struct rule_splitter_t splitter;
+  struct rule_reader_t reader;
+  char content[BUFFER_SIZE], out[3];
+  unsigned int pos = 0;
+  int len = 0, i = 0, x = 0;
+  uint8_t n = 0;
+
+  memset(&splitter, 0, sizeof(struct rule_splitter_t));
+  splitter.blocks = blocks;
+  splitter.nrblocks = 1;
+  splitter.first = 1;
+
+  memset(&blocks[0], 0, sizeof(struct rule_block_t));
+  blocks[0].hash = RULE_HASH_OFFSET;
+
+  rules_reader_init(&reader);
+
+  frules.seek(0, SeekSet);
+  while((len = frules.readBytes(content, BUFFER_SIZE)) > 0) {
+    for(i=0;i<len;i++, pos++) {
+      n = rules_minify(&reader, content[i], out);
+      for(x=0;x<n;x++) {
+        rules_split_char(&splitter, out[x], pos);
+      }
+    }
+  }
+
+  n = rules_minify_flush(&reader, out);
+  for(x=0;x<n;x++) {
+    rules_split_char(&splitter, out[x], pos);
+  }
+  /*
+   * Flush an unfinished 'on'
+   */
+  if(splitter.match > 0) {
+    rules_split_put(&splitter, splitter.pending[0]);
+  }
+  if(splitter.match > 1) {
+    rules_split_put(&splitter, splitter.pending[1]);
+  }
+
+  blocks[splitter.nrblocks-1].len = pos - blocks[splitter.nrblocks-1].offset;
+  if(blocks[splitter.nrblocks-1].size == 0) {
+    splitter.nrblocks--;
+  }
+
+  return splitter.nrblocks;
+}
+
+/*
+ * Read the minified text of a block into the mempool.
+ * Blocks are separated by a newline.
+ */
+static unsigned int rules_load(File &frules, struct rule_block_t *block, unsigned int txtpos) {
+  struct rule_reader_t reader;
+  char content[BUFFER_SIZE], out[3];
+  int len = block->len, len1 = 0, i = 0;
+  uint8_t n = 0;
+
+  rules_reader_init(&reader);
+
+  frules.seek(block->offset, SeekSet);
+  while(len > 0) {
+    len1 = frules.readBytes(content, MIN(len, BUFFER_SIZE));
+    if(len1 <= 0) {
+      break;
+    }
+    for(i=0;i<len1;i++) {
+      n = rules_minify(&reader, content[i], out);
+      memcpy(&mempool[txtpos], out, n);
+      txtpos += n;
+    }
+    len -= len1;
+  }
+  n = rules_minify_flush(&reader, out);
+  memcpy(&mempool[txtpos], out, n);
+  txtpos += n;
+
+  mempool[txtpos++] = '\n';
+
+  return txtpos;
+}
+
+static int vm_find_var(struct rules_t *obj, const char *name) {
+  int i = 0;
+  for(i=0;alignedbytes(i)<obj->ast.nrbytes;i++) {
+    i = alignedbytes(i);
+    switch(obj->ast.buffer[i]) {
+      case TSTART: {
+        i+=sizeof(struct vm_tstart_t)-1;
+      } break;
+      case TEOF: {
+        i+=sizeof(struct vm_teof_t)-1;
+      } break;
+      case VNULL: {
+        i+=sizeof(struct vm_vnull_t)-1;
+      } break;
+      case TIF: {
+        i+=sizeof(struct vm_tif_t)-1;
+      } break;
+      case LPAREN: {
+        i+=sizeof(struct vm_lparen_t)-1;
+      } break;
+      case TFALSE:
+      case TTRUE: {
+        struct vm_ttrue_t *node = (struct vm_ttrue_t *)&obj->ast.buffer[i];
+        i+=sizeof(struct vm_ttrue_t)+(sizeof(node->go[0])*node->nrgo)-1;
+      } break;
+      case TFUNCTION: {
+        struct vm_tfunction_t *node = (struct vm_tfunction_t *)&obj->ast.buffer[i];
+        i+=sizeof(struct vm_tfunction_t)+(sizeof(node->go[0])*node->nrgo)-1;
+      } break;
+      case TCEVENT: {
+        struct vm_tcevent_t *node = (struct vm_tcevent_t *)&obj->ast.buffer[i];
+        i+=sizeof(struct vm_tcevent_t)+strlen((char *)node->token);
+      } break;
+      case TVAR: {
+        struct vm_tvar_t *node = (struct vm_tvar_t *)&obj->ast.buffer[i];
+        if(stricmp((char *)node->token, name) == 0) {
+          return i;
+        }
+        i+=sizeof(struct vm_tvar_t)+strlen((char *)node->token);
+      } break;
+      case TEVENT: {
+        struct vm_tevent_t *node = (struct vm_tevent_t *)&obj->ast.buffer[i];
+        i += sizeof(struct vm_tevent_t)+strlen((char *)node->token);
+      } break;
+      case TNUMBER: {
+        struct vm_tnumber_t *node = (struct vm_tnumber_t *)&obj->ast.buffer[i];
+        i+=sizeof(struct vm_tnumber_t)+strlen((char *)node->token);
+      } break;
+      case VINTEGER: {
+        i+=sizeof(struct vm_vinteger_t)-1;
+      } break;
+      case VFLOAT: {
+        i+=sizeof(struct vm_vfloat_t)-1;
+      } break;
+      case TOPERATOR: {
+        i+=sizeof(struct vm_toperator_t)-1;
+      } break;
+      default: {
+      } break;
+    }
+  }
+  return -1;
+}
+
+static unsigned int vm_global_size(uint8_t type) {
+  switch(type) {
+    case VINTEGER: {
+      return sizeof(struct vm_gvinteger_t);
+    } break;
+    case VFLOAT: {
+      return sizeof(struct vm_gvfloat_t);
+    } break;
+    case VNULL: {
+      return sizeof(struct vm_gvnull_t);
+    } break;
+  }
+  return 0;
+}
+
+/*
+ * A rule in the mempool consists of its rules_t struct,
+ * its bytecode and its varstack, in that order.
+ */
+static unsigned int rule_size(struct rules_t *obj) {
+  return (obj->varstack.buffer - (unsigned char *)obj) + alignedbuffer(obj->varstack.bufsize);
+}
+
+/*
+ * Only parse the rule blocks that changed since the
+ * previous parse. The bytecode of unchanged blocks is
+ * moved to the start of the mempool and the changed
+ * blocks are parsed behind them. Timers, global
+ * variables and the local variables of unchanged rules
+ * are kept. Returns -2 when a full parse is needed.
+ */
+static int rules_reload(File &frules, struct rule_block_t *blocks, int nrblocks) {
+  struct rules_t *order[64];
+  int8_t blockmap[64], rulemap[64], keptmap[64];
+  char **names = NULL;
+  unsigned int pos = 512, txtoffset = 0, changed = 0, nrnames = 0;
+  int i = 0, j = 0, x = 0, nrkept = 0, nrparsed = 0, ret = 0;
+
+  if(nrblocks > 64 || nrrules > 64) {
+    return -2;
+  }
+
+  memset(rulemap, -1, sizeof(rulemap));
+  memset(keptmap, -1, sizeof(keptmap));
+  for(j=0;j<nrblocks;j++) {
+    blockmap[j] = -1;
+    for(i=0;i<nrrules;i++) {
+      struct varstack_t *varstack = (struct varstack_t *)rules[i]->userdata;
+      if(rulemap[i] == -1 && varstack->hash != 0 && varstack->hash == blocks[j].hash) {
+        blockmap[j] = i;
+        rulemap[i] = j;
+        nrkept++;
+        break;
+      }
+    }
+    if(blockmap[j] == -1) {
+      changed += blocks[j].size + 1;
+    }
+  }
+
+  if(nrkept == 0) {
+    return -2;
+  }
+
+  for(i=0;i<nrrules;i++) {
+    if(rulemap[i] > -1) {
+      pos = alignedbuffer(pos) + rule_size(rules[i]);
+      keptmap[i] = x++;
+    }
+  }
+
+  txtoffset = alignedbuffer(MEMPOOL_SIZE-changed-5);
+  if(txtoffset <= alignedbuffer(pos)) {
+    return -2;
+  }
+
+  parsing = 1;
+
+  logprintf_P(F("reparsing %d of %d rule blocks"), nrblocks-nrkept, nrblocks);
+
+  /*
+   * Timers, windows and globals created while
+   * validating the changed rules are dropped
+   * afterwards, so set the current ones aside.
+   */
+  struct timerqueue_t **timers = timerqueue;
+  int nrtimers = timerqueue_size;
+  timerqueue = NULL;
+  timerqueue_size = 0;
+
+  rule_windows_detach();
+
+  struct varstack_t globals = global_varstack;
+  global_varstack.stack = NULL;
+  global_varstack.nrbytes = 4;
+
+  /*
+   * Globals are linked to the variable that last set
+   * them. Link them to the new number of that rule or
+   * remember their name when the rule is removed.
+   */
+  for(x=4;alignedbytes(x)<globals.nrbytes;x++) {
+    x = alignedbytes(x);
+    struct vm_gvnull_t *val = (struct vm_gvnull_t *)&globals.stack[x];
+    if(vm_global_size(val->type) == 0) {
+      break;
+    }
+    if(keptmap[val->rule-1] == -1) {
+      struct vm_tvar_t *node = (struct vm_tvar_t *)&rules[val->rule-1]->ast.buffer[val->ret];
+      if((names = (char **)REALLOC(names, sizeof(char *)*(nrnames+1))) == NULL) {
+        OUT_OF_MEMORY
+      }
+      if((names[nrnames++] = STRDUP((char *)node->token)) == NULL) {
+        OUT_OF_MEMORY
+      }
+      val->rule = 0;
+    } else {
+      val->rule = keptmap[val->rule-1]+1;
+    }
+    x += vm_global_size(val->type)-1;
+  }
+
+  for(i=0;i<nrrules;i++) {
+    if(rulemap[i] == -1) {
+      struct varstack_t *varstack = (struct varstack_t *)rules[i]->userdata;
+      if(varstack->stack != NULL) {
+        FREE(varstack->stack);
+      }
+      FREE(rules[i]->userdata);
+    }
+  }
+
+  /*
+   * Move the unchanged rules to the start of the mempool.
+   * The bytecode only holds relative positions, so only
+   * the buffer pointers need to be updated.
+   */
+  pos = 512;
+  for(i=0;i<nrrules;i++) {
+    if(rulemap[i] > -1) {
+      struct rules_t *obj = rules[i];
+      unsigned int start = (unsigned char *)obj - mempool;
+      unsigned int astoffset = obj->ast.buffer - (unsigned char *)obj;
+      unsigned int varoffset = obj->varstack.buffer - (unsigned char *)obj;
+      unsigned int size = rule_size(obj);
+
+      pos = alignedbuffer(pos);
+      memmove(&mempool[pos], &mempool[start], size);
+      obj = (struct rules_t *)&mempool[pos];
+      obj->ast.buffer = &mempool[pos+astoffset];
+      obj->varstack.buffer = &mempool[pos+varoffset];
+      obj->nr = nrparsed+1;
+
+      order[rulemap[i]] = obj;
+      keptmap[nrparsed] = rulemap[i];
+      rules[nrparsed++] = obj;
+      pos += size;
+    }
+  }
+  nrrules = nrparsed;
+
+  memset(&mempool[pos], 0, MEMPOOL_SIZE-pos);
+
+  {
+    unsigned int txtpos = txtoffset;
+    for(j=0;j<nrblocks;j++) {
+      if(blockmap[j] == -1) {
+        txtpos = rules_load(frules, &blocks[j], txtpos);
+      }
+    }
+  }
+
+  struct varstack_t *varstack = (struct varstack_t *)MALLOC(sizeof(struct varstack_t));
+  if(varstack == NULL) {
+    OUT_OF_MEMORY
+  }
+  memset(varstack, 0, sizeof(struct varstack_t));
+  varstack->nrbytes = 4;
+  varstack->bufsize = 4;
+
+  struct pbuf mem;
+  struct pbuf input;
+  memset(&mem, 0, sizeof(struct pbuf));
+  memset(&input, 0, sizeof(struct pbuf));
+
+  mem.payload = mempool;
+  mem.len = pos;
+  mem.tot_len = MEMPOOL_SIZE;
+
+  input.payload = &mempool[txtoffset];
+  input.len = txtoffset;
+  input.tot_len = changed;
+
+  while((ret = rule_initialize(&input, &rules, &nrrules, &mem, varstack)) == 0) {
+    varstack = (struct varstack_t *)MALLOC(sizeof(struct varstack_t));
+    if(varstack == NULL) {
+      OUT_OF_MEMORY
+    }
+    memset(varstack, 0, sizeof(struct varstack_t));
+    varstack->nrbytes = 4;
+    varstack->bufsize = 4;
+    input.payload = &mempool[input.len];
+  }
+
+  logprintf_P(F("rules memory used: %d / %d"), mem.len, mem.tot_len);
+
+  if(ret != -1) {
+    FREE(varstack);
+  }
+
+  struct timerqueue_t *node = NULL;
+  while((node = timerqueue_pop()) != NULL) {
+    FREE(node);
+  }
+  timerqueue = timers;
+  timerqueue_size = nrtimers;
+
+  rule_windows_attach();
+
+  if(global_varstack.stack != NULL) {
+    FREE(global_varstack.stack);
+  }
+  global_varstack = globals;
+
+  if(ret == -1) {
+    for(i=0;i<nrrules;i++) {
+      struct varstack_t *varstack = (struct varstack_t *)rules[i]->userdata;
+      if(varstack != NULL) {
+        if(varstack->stack != NULL) {
+          FREE(varstack->stack);
+        }
+        FREE(rules[i]->userdata);
+      }
+    }
+    rules_gc(&rules, nrrules);
+    nrrules = 0;
+
+    FREE(global_varstack.stack);
+    global_varstack.stack = NULL;
+    global_varstack.nrbytes = 4;
+
+    for(i=0;i<nrnames;i++) {
+      FREE(names[i]);
+    }
+    if(names != NULL) {
+      FREE(names);
+    }
+    return -1;
+  }
+
+  for(i=nrparsed;i<nrrules;i++) {
+    vm_clear_values(rules[i]);
+  }
+
+  /*
+   * Restore the order of the rules file. This fails
+   * when the blocks parsed don't match the blocks
+   * found by rules_split.
+   */
+  if(nrrules == nrblocks) {
+    x = nrparsed;
+    for(j=0;j<nrblocks;j++) {
+      if(blockmap[j] == -1) {
+        order[j] = rules[x++];
+      }
+    }
+    for(j=0;j<nrblocks;j++) {
+      struct varstack_t *varstack = (struct varstack_t *)order[j]->userdata;
+      varstack->hash = blocks[j].hash;
+      rules[j] = order[j];
+      rules[j]->nr = j+1;
+    }
+  } else {
+    for(i=0;i<nrparsed;i++) {
+      keptmap[i] = i;
+    }
+    for(i=nrparsed;i<nrrules;i++) {
+      ((struct varstack_t *)rules[i]->userdata)->hash = 0;
+    }
+  }
+
+  /*
+   * Link the globals of removed rules to another
+   * variable with the same name, or drop them when
+   * no rule uses them anymore.
+   */
+  j = 0;
+  for(x=4;alignedbytes(x)<global_varstack.nrbytes;x++) {
+    x = alignedbytes(x);
+    struct vm_gvnull_t *val = (struct vm_gvnull_t *)&global_varstack.stack[x];
+    unsigned int size = vm_global_size(val->type);
+    if(size == 0) {
+      break;
+    }
+    if(val->rule > 0) {
+      val->rule = keptmap[val->rule-1]+1;
+    } else {
+      char *name = names[j++];
+      for(i=0;i<nrrules;i++) {
+        if((ret = vm_find_var(rules[i], name)) > -1) {
+          val->rule = i+1;
+          val->ret = ret;
+          break;
+        }
+      }
+      FREE(name);
+    }
+    if(val->rule == 0) {
+      size = alignedbytes(size);
+      memmove(&global_varstack.stack[x], &global_varstack.stack[x+size], global_varstack.nrbytes-x-size);
+      global_varstack.nrbytes -= size;
+      x--;
+      continue;
+    }
+
+    struct vm_tvar_t *var = (struct vm_tvar_t *)&rules[val->rule-1]->ast.buffer[val->ret];
+    var->value = x;
+
+    x += size-1;
+  }
+  if(names != NULL) {
+    FREE(names);
+  }
+  global_varstack.bufsize = alignedbuffer(global_varstack.nrbytes);
+
+  parsing = 0;
+  return 0;
+}
+
 int rules_parse(char *file) {
   File frules = LittleFS.open(file, "r");
   if(frules) {
+    struct rule_block_t *blocks = NULL;
+    int nrblocks = 0;
+
+    if((blocks = (struct rule_block_t *)MALLOC(sizeof(struct rule_block_t)*64)) == NULL) {
+      OUT_OF_MEMORY
+    }
+    nrblocks = rules_split(frules, blocks);
+
+    if(nrrules > 0 && nrblocks > 0) {
+      int ret = rules_reload(frules, blocks, nrblocks);
+      if(ret != -2) {
+        FREE(blocks);
+        frules.close();
+        if(ret == 0) {
+          rules_time_schedule();
+        }
+        return ret;
+      }
+    }
+
     parsing = 1;
 
     if(nrrules > 0) {
@@ -1447,28 +2288,18 @@ int rules_parse(char *file) {
     global_varstack.stack = NULL;
     global_varstack.nrbytes = 4;
 
-#define BUFFER_SIZE 128
-    char content[BUFFER_SIZE];
-    memset(content, 0, BUFFER_SIZE);
-    int len = frules.size();
-    int chunk = 0, len1 = 0;
+    rule_windows_free();
+
+    int len = 0, i = 0;
+    for(i=0;i<nrblocks;i++) {
+      len += blocks[i].size + 1;
+    }
 
     unsigned int txtoffset = alignedbuffer(MEMPOOL_SIZE-len-5);
+    unsigned int txtpos = txtoffset;
 
-    while(1) {
-      memset(content, 0, BUFFER_SIZE);
-      frules.seek(chunk*BUFFER_SIZE, SeekSet);
-      if (chunk * BUFFER_SIZE <= len) {
-        frules.readBytes(content, BUFFER_SIZE);
-        len1 = BUFFER_SIZE;
-      } else if ((chunk * BUFFER_SIZE) >= len && (chunk * BUFFER_SIZE) <= len + BUFFER_SIZE) {
-        frules.readBytes(content, len - ((chunk - 1)*BUFFER_SIZE));
-        len1 = len - ((chunk - 1) * BUFFER_SIZE);
-      } else {
-        break;
-      }
-      memcpy(&mempool[txtoffset+(chunk*BUFFER_SIZE)], &content, alignedbuffer(len1));
-      chunk++;
+    for(i=0;i<nrblocks;i++) {
+      txtpos = rules_load(frules, &blocks[i], txtpos);
     }
     frules.close();
 
@@ -1479,6 +2310,7 @@ int rules_parse(char *file) {
     varstack->stack = NULL;
     varstack->nrbytes = 4;
     varstack->bufsize = 4;
+    varstack->hash = 0;
 
     struct pbuf mem;
     struct pbuf input;
@@ -1503,6 +2335,7 @@ int rules_parse(char *file) {
       varstack->stack = NULL;
       varstack->nrbytes = 4;
       varstack->bufsize = 4;
+      varstack->hash = 0;
       input.payload = &mempool[input.len];
     }
 
@@ -1520,6 +2353,11 @@ int rules_parse(char *file) {
       FREE(node);
     }
 
+    /*
+     * Drop the samples added while validating
+     */
+    rule_windows_clear();
+
     FREE(global_varstack.stack);
     global_varstack.stack = NULL;
     global_varstack.nrbytes = 4;
@@ -1534,13 +2372,18 @@ int rules_parse(char *file) {
         rules_gc(&rules, nrrules);
       }
       nrrules = 0;
+      FREE(blocks);
       return -1;
     }
 
-    int i = 0;
     for(i=0;i<nrrules;i++) {
       vm_clear_values(rules[i]);
+      if(nrblocks == nrrules) {
+        ((struct varstack_t *)rules[i]->userdata)->hash = blocks[i].hash;
+      }
     }
+    FREE(blocks);
+    rules_time_schedule();
     parsing = 0;
     return 0;
   } else {
@@ -1562,27 +2405,32 @@ void rules_event_cb(const char *prefix, const char *name) {
             strnicmp((char *)&event->token[len1], name, len) == 0
           )
         ) {
-        char out[512];
-        logprintf_P(F("%s %s %s"), F("===="), event->token, F("===="));
-        logprintf_P(F("%s %d %s %d"), F(">>> rule"), i, F("nrbytes:"), rules[i]->ast.nrbytes);
-        logprintf_P(F("%s %d"), F(">>> global stack nrbytes:"), global_varstack.nrbytes);
+        if(log_enabled(LOG_RULES, LOG_DEBUG)) {
+          logprintf_P(F("%s %s %s"), F("===="), event->token, F("===="));
+          logprintf_P(F("%s %d %s %d"), F(">>> rule"), i, F("nrbytes:"), rules[i]->ast.nrbytes);
+          logprintf_P(F("%s %d"), F(">>> global stack nrbytes:"), global_varstack.nrbytes);
+        }
 
         rules[i]->timestamp.first = micros();
 
         rule_run(rules[i], 0);
 
         rules[i]->timestamp.second = micros();
-
-        logprintf_P(F("%s%d %s %d %s"), F("rule #"), rules[i]->nr, F("was executed in"), rules[i]->timestamp.second - rules[i]->timestamp.first, F("microseconds"));
-
-        logprintln_P(F("\n>>> local variables"));
-        memset(&out, 0, sizeof(out));
-        vm_value_prt(rules[i], (char *)&out, sizeof(out));
-        logprintln(out);
-        logprintln_P(F(">>> global variables"));
-        memset(&out, 0, sizeof(out));
-        vm_global_value_prt((char *)&out, sizeof(out));
-        logprintln(out);
+        rules_event_notify(rules[i], (char *)event->token);
+
+        if(log_enabled(LOG_RULES, LOG_DEBUG)) {
+          char out[512];
+          logprintf_P(F("%s%d %s %d %s"), F("rule #"), rules[i]->nr, F("was executed in"), rules[i]->timestamp.second - rules[i]->timestamp.first, F("microseconds"));
+
+          logprintln_P(F("\n>>> local variables"));
+          memset(&out, 0, sizeof(out));
+          vm_value_prt(rules[i], (char *)&out, sizeof(out));
+          logprintln(out);
+          logprintln_P(F(">>> global variables"));
+          memset(&out, 0, sizeof(out));
+          vm_global_value_prt((char *)&out, sizeof(out));
+          logprintln(out);
+        }
         break;
       }
     }
@@ -1604,27 +2452,32 @@ void rules_boot(void) {
     if(rules[i]->ast.buffer[start->go] == TEVENT) {
       struct vm_tevent_t *event = (struct vm_tevent_t *)&rules[i]->ast.buffer[start->go];
       if(stricmp((char *)&event->token, "System#Boot") == 0) {
-        char out[512];
-        logprintf_P(F("==== SYSTEM#BOOT ===="));
-        logprintf_P(F("%s %d %s %d"), F(">>> rule"), i, F("nrbytes:"), rules[i]->ast.nrbytes);
-        logprintf_P(F("%s %d"), F(">>> global stack nrbytes:"), global_varstack.nrbytes);
+        if(log_enabled(LOG_RULES, LOG_DEBUG)) {
+          logprintf_P(F("==== SYSTEM#BOOT ===="));
+          logprintf_P(F("%s %d %s %d"), F(">>> rule"), i, F("nrbytes:"), rules[i]->ast.nrbytes);
+          logprintf_P(F("%s %d"), F(">>> global stack nrbytes:"), global_varstack.nrbytes);
+        }
 
         rules[i]->timestamp.first = micros();
 
         rule_run(rules[i], 0);
 
         rules[i]->timestamp.second = micros();
-
-        logprintf_P(F("%s%d %s %d %s"), F("rule #"), rules[i]->nr, F("was executed in"), rules[i]->timestamp.second - rules[i]->timestamp.first, F("microseconds"));
-
-        logprintln_P(F("\n>>> local variables"));
-        memset(&out, 0, sizeof(out));
-        vm_value_prt(rules[i], (char *)&out, sizeof(out));
-        logprintln(out);
-        logprintln_P(F(">>> global variables"));
-        memset(&out, 0, sizeof(out));
-        vm_global_value_prt((char *)&out, sizeof(out));
-        logprintln(out);
+        rules_event_notify(rules[i], (char *)event->token);
+
+        if(log_enabled(LOG_RULES, LOG_DEBUG)) {
+          char out[512];
+          logprintf_P(F("%s%d %s %d %s"), F("rule #"), rules[i]->nr, F("was executed in"), rules[i]->timestamp.second - rules[i]->timestamp.first, F("microseconds"));
+
+          logprintln_P(F("\n>>> local variables"));
+          memset(&out, 0, sizeof(out));
+          vm_value_prt(rules[i], (char *)&out, sizeof(out));
+          logprintln(out);
+          logprintln_P(F(">>> global variables"));
+          memset(&out, 0, sizeof(out));
+          vm_global_value_prt((char *)&out, sizeof(out));
+          logprintln(out);
+        }
         break;
       }
     }
@@ -17,11 +17,17 @@
 
 #include "src/common/mem.h"
 
+/*
+ * Timer number used for the Time#HH:MM events
+ */
+#define RULES_TIME_TIMER -5
+
 void rules_loop(void);
 void rules_boot(void);
 int rules_parse(char *file);
 void rules_setup(void);
 void rules_timer_cb(int nr);
+void rules_time_cb(void);
 void rules_event_cb(const char *prefix, const char *name);
 
 #endif
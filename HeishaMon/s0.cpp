@@ -1,6 +1,8 @@
 #include <PubSubClient.h>
 #include "commands.h"
 #include "s0.h"
+#include "src/common/log.h"
+#include "src/common/outbox.h"
 
 #define MQTT_RETAIN_VALUES 1 // do we retain 1wire values?
 
@@ -140,8 +142,6 @@ void s0Loop(PubSubClient &mqtt_client, void (*log_message)(char*), char* mqtt_to
 
       //report using mqtt
       char log_msg[256];
-      char mqtt_topic[256];
-      char valueStr[20];
 
       //debug
       /*
@@ -158,25 +158,15 @@ void s0Loop(PubSubClient &mqtt_client, void (*log_message)(char*), char* mqtt_to
       */
       //end debug
 
-      sprintf_P(log_msg, PSTR("Pulses seen on S0 port %d: Good: %lu Bad: %lu Average good pulse width: %i"), (i + 1),  actS0Data[i].goodPulses, actS0Data[i].badPulses, actS0Data[i].avgPulseWidth);
-      log_message(log_msg);
-
-      sprintf_P(log_msg, PSTR("Measured Watthour on S0 port %d: %.2f"), (i + 1),  Watthour );
-      log_message(log_msg);
-      sprintf(valueStr, "%.2f", Watthour);
-      sprintf_P(mqtt_topic, PSTR("%s/%s/Watthour/%d"), mqtt_topic_base, mqtt_topic_s0, (i + 1));
-      mqtt_client.publish(mqtt_topic, valueStr, MQTT_RETAIN_VALUES);
-
-      sprintf(log_msg, PSTR("Measured total Watthour on S0 port %d: %.2f"), (i + 1),  WatthourTotal );
-      log_message(log_msg);
-      sprintf(valueStr, "%.2f", WatthourTotal);
-      sprintf(mqtt_topic, PSTR("%s/%s/WatthourTotal/%d"), mqtt_topic_base, mqtt_topic_s0, (i + 1));
-      mqtt_client.publish(mqtt_topic, valueStr, MQTT_RETAIN_VALUES);
-      sprintf(log_msg, PSTR("Calculated Watt on S0 port %d: %u"), (i + 1), actS0Data[i].watt);
-      log_message(log_msg);
-      sprintf(valueStr, "%u",  actS0Data[i].watt);
-      sprintf(mqtt_topic, PSTR("%s/%s/Watt/%d"), mqtt_topic_base, mqtt_topic_s0, (i + 1));
-      mqtt_client.publish(mqtt_topic, valueStr, MQTT_RETAIN_VALUES);
+      logcat_P(LOG_S0, LOG_DEBUG, "Pulses seen on S0 port %d: Good: %lu Bad: %lu Average good pulse width: %i", (i + 1),  actS0Data[i].goodPulses, actS0Data[i].badPulses, actS0Data[i].avgPulseWidth);
+
+      logcat_P(LOG_S0, LOG_DEBUG, "Measured Watthour on S0 port %d: %.2f", (i + 1),  Watthour );
+      outbox_publish_number(MQTT_TOPIC_ID_S0 | (MQTT_S0_WATTHOUR << 4) | (i + 1), llround(Watthour * 100), 2, MQTT_RETAIN_VALUES | OUTBOX_DELTA);
+
+      logcat_P(LOG_S0, LOG_DEBUG, "Measured total Watthour on S0 port %d: %.2f", (i + 1),  WatthourTotal );
+      outbox_publish_number(MQTT_TOPIC_ID_S0 | (MQTT_S0_WATTHOUR_TOTAL << 4) | (i + 1), llround(WatthourTotal * 100), 2, MQTT_RETAIN_VALUES);
+      logcat_P(LOG_S0, LOG_DEBUG, "Calculated Watt on S0 port %d: %u", (i + 1), actS0Data[i].watt);
+      outbox_publish_number(MQTT_TOPIC_ID_S0 | (MQTT_S0_WATT << 4) | (i + 1), actS0Data[i].watt, 0, MQTT_RETAIN_VALUES);
     }
   }
 }
@@ -224,6 +214,32 @@ void s0TableOutput(struct webserver_t *client) {
 
 unsigned long jsonPulses[NUM_S0_COUNTERS];
 
+void s0MetricsOutput(struct webserver_t *client) {
+  char str[96];
+  int len = 0;
+
+  webserver_send_content_P(client, PSTR("# TYPE heishamon_s0_watt gauge\n"), 31);
+  for (int i = 0; i < NUM_S0_COUNTERS; i++) {
+    len = snprintf_P(str, sizeof(str), PSTR("heishamon_s0_watt{port=\"%d\"} %u\n"), i + 1, actS0Data[i].watt);
+    webserver_send_content(client, str, len);
+  }
+  webserver_send_content_P(client, PSTR("# TYPE heishamon_s0_watthour counter\n"), 37);
+  for (int i = 0; i < NUM_S0_COUNTERS; i++) {
+    len = snprintf_P(str, sizeof(str), PSTR("heishamon_s0_watthour_total{port=\"%d\"} "), i + 1);
+    dtostrf(actS0Data[i].pulsesTotal * (1000.0 / actS0Settings[i].ppkwh), 0, 1, &str[len]);
+    len = strlen(str);
+    str[len++] = '\n';
+    webserver_send_content(client, str, len);
+  }
+  webserver_send_content_P(client, PSTR("# TYPE heishamon_s0_pulses counter\n"), 35);
+  for (int i = 0; i < NUM_S0_COUNTERS; i++) {
+    len = snprintf_P(str, sizeof(str), PSTR("heishamon_s0_pulses_total{port=\"%d\",quality=\"good\"} %lu\n"), i + 1, actS0Data[i].goodPulses);
+    webserver_send_content(client, str, len);
+    len = snprintf_P(str, sizeof(str), PSTR("heishamon_s0_pulses_total{port=\"%d\",quality=\"bad\"} %lu\n"), i + 1, actS0Data[i].badPulses);
+    webserver_send_content(client, str, len);
+  }
+}
+
 void s0JsonOutput(struct webserver_t *client) {
   webserver_send_content_P(client, PSTR("["), 1);
   for (int i = 0; i < NUM_S0_COUNTERS; i++) {
@@ -0,0 +1,451 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+/*
+ * Incremental gzip (RFC 1952) / deflate (RFC 1951)
+ * decoder. Input can be fed in parts of any size,
+ * all state lives in struct inflate_t so nothing
+ * has to be buffered besides the history window.
+ * The huffman decoding follows tinf by Joergen
+ * Ibsen.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP8266
+  #include <Arduino.h>
+#else
+  #define PROGMEM
+  #define pgm_read_byte(a) (*(a))
+  #define pgm_read_word(a) (*(a))
+  #define pgm_read_dword(a) (*(a))
+#endif
+
+#include "inflate.h"
+
+typedef enum {
+  INFLATE_MAGIC = 0,
+  INFLATE_HEADER,
+  INFLATE_EXTRALEN,
+  INFLATE_EXTRA,
+  INFLATE_NAME,
+  INFLATE_COMMENT,
+  INFLATE_HCRC,
+  INFLATE_BLOCK,
+  INFLATE_STORED,
+  INFLATE_STORED_DATA,
+  INFLATE_DYNAMIC,
+  INFLATE_DYNAMIC_CODES,
+  INFLATE_DYNAMIC_LENGTHS,
+  INFLATE_DATA,
+  INFLATE_CRC,
+  INFLATE_SIZE,
+  INFLATE_DONE,
+  INFLATE_ERROR
+} inflate_steps;
+
+/*
+ * Bits a step needs before it can run without
+ * suspending halfway. A literal / length / distance
+ * triple takes at most 15+5+15+13 bits. The gzip
+ * trailer guarantees these are available before
+ * the end of a valid stream.
+ */
+static const uint8_t needbits[] PROGMEM = {
+  32, 48, 16, 8, 8, 8, 16, 3, 32, 8, 14, 3, 14, 48, 32, 32, 0, 0
+};
+
+static const uint16_t lbase[29] PROGMEM = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+static const uint8_t lbits[29] PROGMEM = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+static const uint16_t dbase[30] PROGMEM = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+  8193, 12289, 16385, 24577
+};
+
+static const uint8_t dbits[30] PROGMEM = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static const uint8_t clcidx[19] PROGMEM = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+static const uint32_t crctable[16] PROGMEM = {
+  0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+  0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+  0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+  0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+
+#define FHCRC     0x02
+#define FEXTRA    0x04
+#define FNAME     0x08
+#define FCOMMENT  0x10
+
+static uint32_t inflate_getbits(struct inflate_t *inf, uint8_t nr) {
+  uint32_t val = (uint32_t)(inf->bitbuf & ((1ULL << nr) - 1));
+  inf->bitbuf >>= nr;
+  inf->bitcnt -= nr;
+  return val;
+}
+
+static void inflate_build(struct inflate_tree_t *t, const uint8_t *lengths, uint16_t num) {
+  uint16_t offs[16];
+  uint16_t i = 0, sum = 0;
+
+  memset(t->counts, 0, sizeof(t->counts));
+  for(i=0;i<num;i++) {
+    t->counts[lengths[i]]++;
+  }
+  t->counts[0] = 0;
+
+  for(i=0;i<16;i++) {
+    offs[i] = sum;
+    sum += t->counts[i];
+  }
+  for(i=0;i<num;i++) {
+    if(lengths[i] > 0) {
+      t->symbols[offs[lengths[i]]++] = i;
+    }
+  }
+}
+
+static int16_t inflate_decode(struct inflate_t *inf, struct inflate_tree_t *t) {
+  int16_t sum = 0, cur = 0;
+  uint8_t len = 0;
+
+  do {
+    cur = 2*cur + inflate_getbits(inf, 1);
+    if(++len > 15) {
+      return -1;
+    }
+    sum += t->counts[len];
+    cur -= t->counts[len];
+  } while(cur >= 0);
+
+  return t->symbols[sum + cur];
+}
+
+static int8_t inflate_flush(struct inflate_t *inf) {
+  if(inf->wpos > inf->wflush && inf->callback != NULL) {
+    if(inf->callback(inf->userdata, &inf->window[inf->wflush], inf->wpos - inf->wflush) == -1) {
+      return -1;
+    }
+  }
+  inf->wflush = inf->wpos;
+  return 0;
+}
+
+static int8_t inflate_put(struct inflate_t *inf, unsigned char c) {
+  uint32_t crc = inf->crc ^ c;
+  crc = (crc >> 4) ^ pgm_read_dword(&crctable[crc & 0x0f]);
+  crc = (crc >> 4) ^ pgm_read_dword(&crctable[crc & 0x0f]);
+  inf->crc = crc;
+
+  inf->window[inf->wpos++] = c;
+  inf->total++;
+  if(inf->wpos == INFLATE_WINDOW_SIZE) {
+    if(inflate_flush(inf) == -1) {
+      return -1;
+    }
+    inf->wpos = 0;
+    inf->wflush = 0;
+  }
+  return 0;
+}
+
+static uint8_t inflate_header_next(struct inflate_t *inf) {
+  if(inf->flags & FEXTRA) {
+    return INFLATE_EXTRALEN;
+  } else if(inf->flags & FNAME) {
+    return INFLATE_NAME;
+  } else if(inf->flags & FCOMMENT) {
+    return INFLATE_COMMENT;
+  } else if(inf->flags & FHCRC) {
+    return INFLATE_HCRC;
+  }
+  return INFLATE_BLOCK;
+}
+
+static int8_t inflate_step(struct inflate_t *inf) {
+  switch(inf->step) {
+    case INFLATE_MAGIC: {
+      uint32_t magic = inflate_getbits(inf, 24);
+      if(magic != 0x088b1f) {
+        return -1;
+      }
+      inf->flags = inflate_getbits(inf, 8);
+      inf->step = INFLATE_HEADER;
+    } break;
+    case INFLATE_HEADER: {
+      // mtime, xfl and os
+      inflate_getbits(inf, 24);
+      inflate_getbits(inf, 24);
+      inf->step = inflate_header_next(inf);
+    } break;
+    case INFLATE_EXTRALEN: {
+      inf->todo = inflate_getbits(inf, 16);
+      inf->flags &= ~FEXTRA;
+      inf->step = (inf->todo > 0) ? INFLATE_EXTRA : inflate_header_next(inf);
+    } break;
+    case INFLATE_EXTRA: {
+      inflate_getbits(inf, 8);
+      if(--inf->todo == 0) {
+        inf->step = inflate_header_next(inf);
+      }
+    } break;
+    case INFLATE_NAME:
+    case INFLATE_COMMENT: {
+      if(inflate_getbits(inf, 8) == 0) {
+        inf->flags &= (inf->step == INFLATE_NAME) ? ~FNAME : ~FCOMMENT;
+        inf->step = inflate_header_next(inf);
+      }
+    } break;
+    case INFLATE_HCRC: {
+      inflate_getbits(inf, 16);
+      inf->flags &= ~FHCRC;
+      inf->step = INFLATE_BLOCK;
+    } break;
+    case INFLATE_BLOCK: {
+      inf->final = inflate_getbits(inf, 1);
+      switch(inflate_getbits(inf, 2)) {
+        case 0: {
+          inflate_getbits(inf, inf->bitcnt & 7);
+          inf->step = INFLATE_STORED;
+        } break;
+        case 1: {
+          uint16_t i = 0;
+          for(i=0;i<144;i++) {
+            inf->lengths[i] = 8;
+          }
+          for(;i<256;i++) {
+            inf->lengths[i] = 9;
+          }
+          for(;i<280;i++) {
+            inf->lengths[i] = 7;
+          }
+          for(;i<288;i++) {
+            inf->lengths[i] = 8;
+          }
+          inflate_build(&inf->ltree, inf->lengths, 288);
+          memset(inf->lengths, 5, 30);
+          inflate_build(&inf->dtree, inf->lengths, 30);
+          inf->step = INFLATE_DATA;
+        } break;
+        case 2: {
+          inf->step = INFLATE_DYNAMIC;
+        } break;
+        default: {
+          return -1;
+        } break;
+      }
+    } break;
+    case INFLATE_STORED: {
+      uint16_t len = inflate_getbits(inf, 16);
+      uint16_t nlen = inflate_getbits(inf, 16);
+      if(len != (uint16_t)~nlen) {
+        return -1;
+      }
+      inf->todo = len;
+      if(len > 0) {
+        inf->step = INFLATE_STORED_DATA;
+      } else {
+        inf->step = (inf->final == 1) ? INFLATE_CRC : INFLATE_BLOCK;
+      }
+    } break;
+    case INFLATE_STORED_DATA: {
+      while(inf->todo > 0 && inf->bitcnt >= 8) {
+        if(inflate_put(inf, inflate_getbits(inf, 8)) == -1) {
+          return -1;
+        }
+        inf->todo--;
+      }
+      if(inf->todo == 0) {
+        inf->step = (inf->final == 1) ? INFLATE_CRC : INFLATE_BLOCK;
+      }
+    } break;
+    case INFLATE_DYNAMIC: {
+      inf->hlit = inflate_getbits(inf, 5) + 257;
+      inf->hdist = inflate_getbits(inf, 5) + 1;
+      inf->hclen = inflate_getbits(inf, 4) + 4;
+      if(inf->hlit > 286 || inf->hdist > 30) {
+        return -1;
+      }
+      memset(inf->lengths, 0, 19);
+      inf->nrlens = 0;
+      inf->step = INFLATE_DYNAMIC_CODES;
+    } break;
+    case INFLATE_DYNAMIC_CODES: {
+      inf->lengths[pgm_read_byte(&clcidx[inf->nrlens++])] = inflate_getbits(inf, 3);
+      if(inf->nrlens == inf->hclen) {
+        /*
+         * The code length tree is only needed
+         * until the distance tree gets built.
+         */
+        inflate_build(&inf->dtree, inf->lengths, 19);
+        inf->nrlens = 0;
+        inf->step = INFLATE_DYNAMIC_LENGTHS;
+      }
+    } break;
+    case INFLATE_DYNAMIC_LENGTHS: {
+      int16_t sym = inflate_decode(inf, &inf->dtree);
+      uint8_t len = 0, rep = 1;
+      if(sym < 0) {
+        return -1;
+      } else if(sym < 16) {
+        len = sym;
+      } else if(sym == 16) {
+        if(inf->nrlens == 0) {
+          return -1;
+        }
+        len = inf->lengths[inf->nrlens-1];
+        rep = 3 + inflate_getbits(inf, 2);
+      } else if(sym == 17) {
+        rep = 3 + inflate_getbits(inf, 3);
+      } else {
+        rep = 11 + inflate_getbits(inf, 7);
+      }
+      if(inf->nrlens + rep > inf->hlit + inf->hdist) {
+        return -1;
+      }
+      while(rep-- > 0) {
+        inf->lengths[inf->nrlens++] = len;
+      }
+      if(inf->nrlens == inf->hlit + inf->hdist) {
+        if(inf->lengths[256] == 0) {
+          return -1;
+        }
+        inflate_build(&inf->ltree, inf->lengths, inf->hlit);
+        inflate_build(&inf->dtree, &inf->lengths[inf->hlit], inf->hdist);
+        inf->step = INFLATE_DATA;
+      }
+    } break;
+    case INFLATE_DATA: {
+      int16_t sym = inflate_decode(inf, &inf->ltree);
+      if(sym < 0) {
+        return -1;
+      } else if(sym < 256) {
+        return inflate_put(inf, sym);
+      } else if(sym == 256) {
+        inf->step = (inf->final == 1) ? INFLATE_CRC : INFLATE_BLOCK;
+      } else {
+        sym -= 257;
+        if(sym >= 29) {
+          return -1;
+        }
+        uint16_t len = pgm_read_word(&lbase[sym]) + inflate_getbits(inf, pgm_read_byte(&lbits[sym]));
+        int16_t dsym = inflate_decode(inf, &inf->dtree);
+        if(dsym < 0 || dsym >= 30) {
+          return -1;
+        }
+        uint16_t dist = pgm_read_word(&dbase[dsym]) + inflate_getbits(inf, pgm_read_byte(&dbits[dsym]));
+        if(dist > inf->total) {
+          return -1;
+        }
+        if(dist > INFLATE_WINDOW_SIZE) {
+          /*
+           * A match never overlaps itself this far
+           * back, so it can be read in one go once
+           * everything has been handed out.
+           */
+          unsigned char buf[258];
+          if(inf->history == NULL || inflate_flush(inf) == -1 ||
+             inf->history(inf->userdata, inf->total - dist, buf, len) == -1) {
+            return -1;
+          }
+          uint16_t i = 0;
+          for(i=0;i<len;i++) {
+            if(inflate_put(inf, buf[i]) == -1) {
+              return -1;
+            }
+          }
+          break;
+        }
+        while(len-- > 0) {
+          if(inflate_put(inf, inf->window[(inf->wpos - dist) & (INFLATE_WINDOW_SIZE-1)]) == -1) {
+            return -1;
+          }
+        }
+      }
+    } break;
+    case INFLATE_CRC: {
+      inflate_getbits(inf, inf->bitcnt & 7);
+      if(inflate_getbits(inf, 32) != (inf->crc ^ 0xffffffff)) {
+        return -1;
+      }
+      inf->step = INFLATE_SIZE;
+    } break;
+    case INFLATE_SIZE: {
+      if(inflate_getbits(inf, 32) != inf->total) {
+        return -1;
+      }
+      inf->step = INFLATE_DONE;
+    } break;
+  }
+  return 0;
+}
+
+struct inflate_t *inflate_init(inflate_cb_t *callback, inflate_history_cb_t *history, void *userdata) {
+  struct inflate_t *inf = (struct inflate_t *)malloc(sizeof(struct inflate_t));
+  if(inf == NULL) {
+    return NULL;
+  }
+  memset(inf, 0, sizeof(struct inflate_t));
+  if((inf->window = (unsigned char *)malloc(INFLATE_WINDOW_SIZE)) == NULL) {
+    free(inf);
+    return NULL;
+  }
+  inf->crc = 0xffffffff;
+  inf->step = INFLATE_MAGIC;
+  inf->callback = callback;
+  inf->history = history;
+  inf->userdata = userdata;
+  return inf;
+}
+
+int8_t inflate_feed(struct inflate_t *inf, unsigned char *buf, uint16_t len) {
+  uint16_t pos = 0;
+
+  while(inf->step != INFLATE_DONE && inf->step != INFLATE_ERROR) {
+    while(inf->bitcnt <= 56 && pos < len) {
+      inf->bitbuf |= (uint64_t)buf[pos++] << inf->bitcnt;
+      inf->bitcnt += 8;
+    }
+    if(inf->bitcnt < pgm_read_byte(&needbits[inf->step])) {
+      break;
+    }
+    if(inflate_step(inf) == -1) {
+      inf->step = INFLATE_ERROR;
+    }
+  }
+
+  if(inf->step == INFLATE_ERROR || inflate_flush(inf) == -1) {
+    inf->step = INFLATE_ERROR;
+    return -1;
+  }
+  return (inf->step == INFLATE_DONE) ? 1 : 0;
+}
+
+void inflate_free(struct inflate_t *inf) {
+  if(inf != NULL) {
+    free(inf->window);
+    free(inf);
+  }
+}
@@ -0,0 +1,75 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifndef _INFLATE_H_
+#define _INFLATE_H_
+
+#include <stdint.h>
+
+/*
+ * Size of the history window. Deflate allows
+ * back references up to 32KB, references that
+ * go further back than this window are read
+ * from the already written output through the
+ * history callback, or rejected without one.
+ * Must be a power of two.
+ */
+#ifndef INFLATE_WINDOW_SIZE
+  #define INFLATE_WINDOW_SIZE 4096
+#endif
+
+typedef int8_t (inflate_cb_t)(void *userdata, unsigned char *buf, uint16_t len);
+typedef int8_t (inflate_history_cb_t)(void *userdata, uint32_t offset, unsigned char *buf, uint16_t len);
+
+typedef struct inflate_tree_t {
+  uint16_t counts[16];
+  uint16_t symbols[288];
+} inflate_tree_t;
+
+typedef struct inflate_t {
+  uint64_t bitbuf;
+  uint8_t bitcnt;
+  uint8_t step;
+  uint8_t flags;
+  uint8_t final;
+  uint16_t todo;
+  uint16_t hlit;
+  uint16_t hdist;
+  uint16_t hclen;
+  uint16_t nrlens;
+  uint8_t lengths[320];
+  struct inflate_tree_t ltree;
+  struct inflate_tree_t dtree;
+  uint32_t crc;
+  uint32_t total;
+  uint16_t wpos;
+  uint16_t wflush;
+  unsigned char *window;
+  inflate_cb_t *callback;
+  inflate_history_cb_t *history;
+  void *userdata;
+} inflate_t;
+
+/*
+ * Gzip streams start with these two bytes
+ */
+#define INFLATE_IS_GZIP(a, len) ((len) >= 1 && (a)[0] == 0x1f && ((len) == 1 || (a)[1] == 0x8b))
+
+struct inflate_t *inflate_init(inflate_cb_t *callback, inflate_history_cb_t *history, void *userdata);
+/*
+ * Feed the next part of a gzip stream. Returns
+ * -1 on a corrupt stream or callback error, 0
+ * when more input is needed and 1 once the
+ * trailer has been verified. The inflated data
+ * is passed to the callback in window sized
+ * parts.
+ */
+int8_t inflate_feed(struct inflate_t *inf, unsigned char *buf, uint16_t len);
+void inflate_free(struct inflate_t *inf);
+
+#endif
@@ -7,90 +7,708 @@
 */
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <sys/time.h>
 #include <time.h>
 
 #include <Arduino.h>
 
-#include "mem.h"
+#include "log.h"
+#include "ring.h"
 #include "../../webfunctions.h"
 
 extern settingsStruct heishamonSettings;
 extern PubSubClient mqtt_client;
+extern WiFiClient mqtt_wifi_client;
 extern const char* mqtt_logtopic;
 
-void _logprintln(const char *file, unsigned int line, char *msg) {
-  if(heishamonSettings.logSerial1) {
-    Serial1.print(millis());
-    Serial1.print(": ");
-    Serial1.println(msg);
+/*
+ * Every entry in the ring is a header directly
+ * followed by the zero terminated line.
+ */
+typedef struct logentry_t {
+  uint32_t time;
+  uint32_t millis;
+  uint16_t len;
+  uint8_t sinks;
+  uint8_t flags;
+} logentry_t;
+
+/*
+ * A binary entry holds the format id, the
+ * format pointer and the packed arguments
+ */
+#define LOG_FLAG_BINARY 0x01
+#define LOG_BINARY_HEAD (4 + sizeof(PGM_P))
+
+typedef struct logsink_t {
+  uint32_t seq;
+  uint32_t pos;
+  uint16_t off;
+  uint16_t rate;
+  uint16_t tokens;
+  unsigned long refill;
+  uint32_t dropped;
+} logsink_t;
+
+/*
+ * Sequence numbers count the entries the same
+ * way as the ring positions count the bytes.
+ */
+static uint8_t buffer[LOG_RING_SIZE];
+static struct ring_t ring = {
+  buffer, LOG_RING_SIZE, sizeof(struct logentry_t), offsetof(struct logentry_t, len), 0, 0
+};
+static uint32_t headseq = 0;
+static uint32_t tailseq = 0;
+
+static struct logsink_t sinks[LOG_NR_SINKS] = {
+  { 0, 0, 0, LOG_RATE_SERIAL, LOG_RATE_SERIAL, 0, 0 },
+  { 0, 0, 0, LOG_RATE_MQTT, LOG_RATE_MQTT, 0, 0 },
+  { 0, 0, 0, LOG_RATE_WEB, LOG_RATE_WEB, 0, 0 }
+};
+
+uint8_t log_categories = LOG_CATEGORIES;
+uint8_t log_level = LOG_LEVEL_MAX;
+uint8_t log_binary = 0;
+
+static const char category_names[LOG_NR_CATEGORIES][8] PROGMEM = {
+  "serial", "decode", "mqtt", "rules", "web", "s0", "dallas", "ot"
+};
+
+static const char level_names[LOG_DEBUG+1][6] PROGMEM = {
+  "error", "warn", "info", "debug"
+};
+
+static char fmtbuf[LOG_LINE_SIZE];
+static char logline[LOG_LINE_SIZE + 64];
+static uint16_t loglinelen = 0;
+static uint32_t loglineseq = 0xFFFFFFFF;
+static uint32_t timestamp = 0;
+static char timestring[32] = { 0 };
+
+// forget the oldest line to make room
+static uint16_t log_evict(void *data) {
+  struct logentry_t *entry = (struct logentry_t *)data;
+  tailseq++;
+  return sizeof(struct logentry_t) + entry->len + 1;
+}
+
+static void log_push_entry(uint8_t mask, uint8_t flags, const char *msg, uint16_t len) {
+  struct logentry_t entry;
+
+  if(len > LOG_LINE_SIZE-1) {
+    len = LOG_LINE_SIZE-1;
   }
-  websocket_write_all(msg, strlen(msg));
+
+  uint8_t *at = ring_push(&ring, sizeof(struct logentry_t) + len + 1, &entry, log_evict);
+
+  entry.time = time(NULL);
+  entry.millis = millis();
+  entry.len = len;
+  entry.sinks = mask;
+  entry.flags = flags;
+
+  memcpy(at, &entry, sizeof(struct logentry_t));
+  memcpy(&at[sizeof(struct logentry_t)], msg, len);
+  at[sizeof(struct logentry_t)+len] = 0;
+
+  headseq++;
 }
 
-void _logprintf(const char *file, unsigned int line, char *fmt, ...) {
-  char *str = NULL;
+void log_push(uint8_t mask, const char *msg, uint16_t len) {
+  log_push_entry(mask, 0, msg, len);
+}
 
-  va_list ap, apcpy;
-  va_copy(apcpy, ap);
-  va_start(apcpy, fmt);
+/*
+ * Walk a printf format and store each argument
+ * in its smallest form: integers as 4 bytes (8
+ * for ll), floating point as a float and strings
+ * zero terminated. Returns the number of bytes
+ * used, arguments that don't fit are left out.
+ */
+static uint16_t log_pack(uint8_t *out, uint16_t size, PGM_P fmt, va_list ap) {
+  uint16_t pos = 0;
+  uint8_t longs = 0;
+  char c = 0;
 
-  int bytes = vsnprintf(NULL, 0, fmt, apcpy);
+  while((c = pgm_read_byte(fmt++)) != 0) {
+    if(c != '%') {
+      continue;
+    }
+    c = pgm_read_byte(fmt++);
+    if(c == '%') {
+      continue;
+    }
+    while(c == '-' || c == '+' || c == ' ' || c == '#' || c == '0') {
+      c = pgm_read_byte(fmt++);
+    }
+    for(uint8_t i=0;i<2;i++) {
+      if(c == '*') {
+        int val = va_arg(ap, int);
+        if(pos + 4 <= size) {
+          memcpy(&out[pos], &val, 4);
+          pos += 4;
+        }
+        c = pgm_read_byte(fmt++);
+      } else {
+        while(c >= '0' && c <= '9') {
+          c = pgm_read_byte(fmt++);
+        }
+      }
+      if(i == 0 && c == '.') {
+        c = pgm_read_byte(fmt++);
+      } else {
+        break;
+      }
+    }
+    longs = 0;
+    while(c == 'h' || c == 'l' || c == 'L' || c == 'z' || c == 'j' || c == 't') {
+      longs += (c == 'l');
+      c = pgm_read_byte(fmt++);
+    }
+    switch(c) {
+      case 0:
+        return pos;
+      case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c': case 'p': {
+        if(longs >= 2) {
+          long long val = va_arg(ap, long long);
+          if(pos + 8 <= size) {
+            memcpy(&out[pos], &val, 8);
+            pos += 8;
+          }
+        } else {
+          uint32_t val = 0;
+          if(longs == 1) {
+            val = va_arg(ap, unsigned long);
+          } else if(c == 'p') {
+            val = (uintptr_t)va_arg(ap, void *);
+          } else {
+            val = va_arg(ap, unsigned int);
+          }
+          if(pos + 4 <= size) {
+            memcpy(&out[pos], &val, 4);
+            pos += 4;
+          }
+        }
+      } break;
+      case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+        float val = va_arg(ap, double);
+        if(pos + 4 <= size) {
+          memcpy(&out[pos], &val, 4);
+          pos += 4;
+        }
+      } break;
+      case 's': case 'S': {
+        const char *str = va_arg(ap, const char *);
+        uint16_t i = 0;
+        if(str == NULL) {
+          str = PSTR("(null)");
+        }
+        if(pos < size) {
+          // pgm_read_byte reads from ram as well
+          while(i < LOG_BINARY_STRLEN-1 && pos + 1 < size && (c = pgm_read_byte(&str[i])) != 0) {
+            out[pos++] = c;
+            i++;
+          }
+          out[pos++] = 0;
+        }
+      } break;
+    }
+  }
+  return pos;
+}
 
-  va_end(apcpy);
-  if((str = (char *)MALLOC(bytes+1)) == NULL) {
-    OUT_OF_MEMORY
+/*
+ * Format a binary entry with its format from
+ * flash and the packed arguments. Arguments
+ * missing from the record are shown as '?'.
+ */
+static uint16_t log_render(char *out, uint16_t size, PGM_P fmt, const uint8_t *args, uint16_t len) {
+  uint16_t o = 0, pos = 0, n = 0;
+  uint8_t longs = 0;
+  char spec[24];
+  char c = 0;
+  int ret = -1;
+
+  while((c = pgm_read_byte(fmt++)) != 0 && o < size - 1) {
+    if(c != '%') {
+      out[o++] = c;
+      continue;
+    }
+    c = pgm_read_byte(fmt++);
+    if(c == '%') {
+      out[o++] = '%';
+      continue;
+    }
+    spec[0] = '%';
+    n = 1;
+    while(c == '-' || c == '+' || c == ' ' || c == '#' || c == '0') {
+      if(n < 8) {
+        spec[n++] = c;
+      }
+      c = pgm_read_byte(fmt++);
+    }
+    for(uint8_t i=0;i<2;i++) {
+      if(c == '*') {
+        int val = 0;
+        if(pos + 4 <= len) {
+          memcpy(&val, &args[pos], 4);
+          pos += 4;
+        }
+        /*
+         * snprintf_P returns the length it wanted
+         * to write, spec only holds what fit
+         */
+        n += snprintf_P(&spec[n], sizeof(spec) - n - 4, PSTR("%d"), val);
+        if(n > sizeof(spec) - 5) {
+          n = sizeof(spec) - 5;
+        }
+        c = pgm_read_byte(fmt++);
+      } else {
+        while(c >= '0' && c <= '9') {
+          if(n < sizeof(spec) - 5) {
+            spec[n++] = c;
+          }
+          c = pgm_read_byte(fmt++);
+        }
+      }
+      if(i == 0 && c == '.') {
+        if(n < sizeof(spec) - 5) {
+          spec[n++] = '.';
+        }
+        c = pgm_read_byte(fmt++);
+      } else {
+        break;
+      }
+    }
+    longs = 0;
+    while(c == 'h' || c == 'l' || c == 'L' || c == 'z' || c == 'j' || c == 't') {
+      if(c == 'h' && n < sizeof(spec) - 5) {
+        spec[n++] = 'h';
+      }
+      longs += (c == 'l');
+      c = pgm_read_byte(fmt++);
+    }
+    if(c == 0) {
+      break;
+    }
+    ret = -1;
+    switch(c) {
+      case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c': case 'p': {
+        if(longs >= 2) {
+          long long val = 0;
+          if(pos + 8 > len) {
+            break;
+          }
+          memcpy(&val, &args[pos], 8);
+          pos += 8;
+          spec[n++] = 'l';
+          spec[n++] = 'l';
+          spec[n++] = c;
+          spec[n] = 0;
+          ret = snprintf(&out[o], size - o, spec, val);
+        } else {
+          uint32_t val = 0;
+          if(pos + 4 > len) {
+            break;
+          }
+          memcpy(&val, &args[pos], 4);
+          pos += 4;
+          if(c == 'p') {
+            spec[n++] = 'x';
+            spec[n] = 0;
+            ret = snprintf(&out[o], size - o, spec, (unsigned int)val);
+          } else {
+            spec[n++] = c;
+            spec[n] = 0;
+            ret = snprintf(&out[o], size - o, spec, (unsigned int)val);
+          }
+        }
+      } break;
+      case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+        float val = 0;
+        if(pos + 4 > len) {
+          break;
+        }
+        memcpy(&val, &args[pos], 4);
+        pos += 4;
+        spec[n++] = c;
+        spec[n] = 0;
+        ret = snprintf(&out[o], size - o, spec, (double)val);
+      } break;
+      case 's': case 'S': {
+        if(pos >= len) {
+          break;
+        }
+        spec[n++] = 's';
+        spec[n] = 0;
+        ret = snprintf(&out[o], size - o, spec, (const char *)&args[pos]);
+        pos += strnlen((const char *)&args[pos], len - pos) + 1;
+      } break;
+      default:
+        continue;
+    }
+    if(ret < 0) {
+      out[o++] = '?';
+    } else {
+      o += ret;
+    }
+    if(o > size - 1) {
+      o = size - 1;
+    }
   }
-  va_start(ap, fmt);
-  vsprintf(str, fmt, ap);
-  va_end(ap);
+  out[o] = 0;
+  return o;
+}
 
-  _logprintln(file, line, str);
+static uint8_t log_sink_enabled(uint8_t nr) {
+  switch(nr) {
+    case 0:
+      return heishamonSettings.logSerial1;
+    case 1:
+      return heishamonSettings.logMqtt;
+  }
+  return 1;
+}
 
-  FREE(str);
+/*
+ * Format a line the way it is sent to all
+ * sinks, ending with CRLF for the serial port.
+ * The line of the last entry is kept so each
+ * sink doesn't format it again.
+ */
+static uint16_t log_format(uint32_t seq, struct logentry_t *entry, char *msg) {
+  if(seq == loglineseq) {
+    return loglinelen;
+  }
+  if((entry->flags & LOG_FLAG_BINARY) != 0) {
+    PGM_P fmt = NULL;
+    memcpy(&fmt, &msg[4], sizeof(PGM_P));
+    log_render(fmtbuf, sizeof(fmtbuf), fmt, (uint8_t *)&msg[LOG_BINARY_HEAD], entry->len - LOG_BINARY_HEAD);
+    msg = fmtbuf;
+  }
+  if(entry->time != timestamp || timestring[0] == 0) {
+    time_t rawtime = entry->time;
+    strftime(timestring, sizeof(timestring), "%c", localtime(&rawtime));
+    timestamp = entry->time;
+  }
+  int len = snprintf_P(logline, sizeof(logline), PSTR("%s (%lu): %s\r\n"), timestring, (unsigned long)entry->millis, msg);
+  if(len >= (int)sizeof(logline)) {
+    len = sizeof(logline)-1;
+    logline[len-2] = '\r';
+    logline[len-1] = '\n';
+  }
+  loglineseq = seq;
+  loglinelen = len;
+  return len;
 }
 
-void _logprintln_P(const char *file, unsigned int line, const __FlashStringHelper *msg) {
-  PGM_P p = (PGM_P)msg;
-  int len = strlen_P((const char *)p);
-  char *str = (char *)MALLOC(len+1);
-  if(str == NULL) {
-    OUT_OF_MEMORY
+/*
+ * A binary record as sent to websocket clients:
+ * version, time, millis, format id and the
+ * packed arguments, all little endian.
+ */
+static void log_record(struct logentry_t *entry, uint8_t *msg) {
+  uint8_t frame[13 + LOG_LINE_SIZE];
+  uint16_t len = entry->len - LOG_BINARY_HEAD;
+
+  frame[0] = LOG_RECORD_VERSION;
+  memcpy(&frame[1], &entry->time, 4);
+  memcpy(&frame[5], &entry->millis, 4);
+  memcpy(&frame[9], msg, 4);
+  memcpy(&frame[13], &msg[LOG_BINARY_HEAD], len);
+
+  websocket_write_all_binary(frame, 13 + len);
+}
+
+/*
+ * Send (part of) the next line to a sink.
+ * Returns 1 when the sink made progress and
+ * 0 when it has nothing to do or has to wait.
+ */
+static uint8_t log_sink_step(uint8_t nr, uint8_t flush) {
+  struct logsink_t *sink = &sinks[nr];
+  struct logentry_t entry;
+  uint8_t done = 1;
+
+  if(log_sink_enabled(nr) == 0) {
+    sink->seq = headseq;
+    sink->pos = ring.head;
+    sink->off = 0;
+    return 0;
+  }
+  if((int32_t)(tailseq - sink->seq) > 0) {
+    sink->dropped += tailseq - sink->seq;
+    sink->seq = tailseq;
+    sink->pos = ring.tail;
+    sink->off = 0;
   }
-  strcpy_P(str, p);
+  if(sink->seq == headseq) {
+    return 0;
+  }
+
+  uint32_t pos = ring_entry_at(&ring, sink->pos, &entry);
+
+  if(entry.sinks & (1 << nr)) {
+    if(nr == 1 && !mqtt_client.connected()) {
+      return 0;
+    }
+    if(flush == 0 && sink->rate > 0) {
+      if((unsigned long)(millis() - sink->refill) >= 1000) {
+        sink->refill = millis();
+        sink->tokens = sink->rate;
+      }
+      if(sink->tokens == 0) {
+        return 0;
+      }
+    }
 
-  _logprintln(file, line, str);
+    char *msg = (char *)&ring_data(&ring, pos)[sizeof(struct logentry_t)];
+    uint16_t len = 0;
 
-  FREE(str);
+    switch(nr) {
+      case 0: {
+        len = log_format(sink->seq, &entry, msg);
+        uint16_t todo = len - sink->off;
+        if(flush == 0) {
+          int avail = Serial1.availableForWrite();
+          if(avail <= 0) {
+            return 0;
+          }
+          if(todo > avail) {
+            todo = avail;
+          }
+        }
+        Serial1.write((const uint8_t *)&logline[sink->off], todo);
+        sink->off += todo;
+        done = (sink->off == len);
+      } break;
+      case 1: {
+        char topic[256];
+        len = log_format(sink->seq, &entry, msg);
+        uint16_t tlen = snprintf_P(topic, sizeof(topic), PSTR("%s/%s"), heishamonSettings.mqtt_topic_base, mqtt_logtopic);
+        // wait for the TCP send window instead of blocking in publish
+        if(mqtt_wifi_client.availableForWrite() < (size_t)(tlen + len + 4)) {
+          return 0;
+        }
+        if(!mqtt_client.publish((const char *)topic, (const uint8_t *)logline, len-2, false)) {
+          sink->dropped++;
+        }
+      } break;
+      case 2: {
+        if((entry.flags & LOG_FLAG_BINARY) != 0) {
+          /*
+           * Websocket clients render the record
+           * themselves, the text is only made
+           * for event stream clients.
+           */
+          if(websocket_clients() > 0) {
+            log_record(&entry, (uint8_t *)msg);
+          }
+          if(webserver_events_wanted(EVENTS_LOG) == 0) {
+            break;
+          }
+          len = log_format(sink->seq, &entry, msg);
+          logline[len-2] = 0;
+          webserver_events_all(EVENTS_LOG, PSTR("log"), logline, len-2);
+          logline[len-2] = '\r';
+          break;
+        }
+        len = log_format(sink->seq, &entry, msg);
+        logline[len-2] = 0;
+        websocket_write_all(logline, len-2);
+        webserver_events_all(EVENTS_LOG, PSTR("log"), logline, len-2);
+        logline[len-2] = '\r';
+      } break;
+    }
+    if(done == 1 && sink->tokens > 0) {
+      sink->tokens--;
+    }
+  }
+
+  if(done == 1) {
+    sink->seq++;
+    sink->pos = pos + sizeof(struct logentry_t) + entry.len + 1;
+    sink->off = 0;
+  }
+  return 1;
 }
 
-void _logprintf_P(const char *file, unsigned int line, const __FlashStringHelper *fmt, ...) {
-  PGM_P p = (PGM_P)fmt;
-  int len = strlen_P((const char *)p);
-  char *foo = (char *)MALLOC(len+1);
-  if(foo == NULL) {
-    OUT_OF_MEMORY
+void log_loop(void) {
+  unsigned long start = micros();
+  uint8_t busy = 1, i = 0;
+
+  while(busy == 1 && (unsigned long)(micros() - start) < LOG_LOOP_BUDGET) {
+    busy = 0;
+    for(i=0;i<LOG_NR_SINKS;i++) {
+      busy |= log_sink_step(i, 0);
+    }
+  }
+}
+
+void log_flush(void) {
+  uint8_t busy = 1, i = 0;
+
+  while(busy == 1) {
+    busy = 0;
+    for(i=0;i<LOG_NR_SINKS;i++) {
+      busy |= log_sink_step(i, 1);
+    }
   }
-  strcpy_P(foo, p);
+}
+
+uint32_t log_dropped(uint8_t sink) {
+  if(sink >= LOG_NR_SINKS) {
+    return 0;
+  }
+  return sinks[sink].dropped;
+}
 
-  char *str = NULL;
+void log_message(char *string) {
+  log_push(LOG_SINK_ALL, string, strlen(string));
+}
 
-  va_list ap, apcpy;
-  va_copy(apcpy, ap);
-  va_start(apcpy, fmt);
+void _logprintln(const char *file, unsigned int line, char *msg) {
+  log_push(LOG_SINK_SERIAL | LOG_SINK_WEB, msg, strlen(msg));
+}
 
-  int bytes = vsnprintf(NULL, 0, foo, apcpy);
+void _logprintf(const char *file, unsigned int line, char *fmt, ...) {
+  va_list ap;
+
+  va_start(ap, fmt);
+  int len = vsnprintf(fmtbuf, sizeof(fmtbuf), fmt, ap);
+  va_end(ap);
 
-  va_end(apcpy);
-  if((str = (char *)MALLOC(bytes+1)) == NULL) {
-    OUT_OF_MEMORY
+  if(len >= (int)sizeof(fmtbuf)) {
+    len = sizeof(fmtbuf)-1;
   }
+  if(len > 0) {
+    log_push(LOG_SINK_SERIAL | LOG_SINK_WEB, fmtbuf, len);
+  }
+}
+
+void _logprintln_P(const char *file, unsigned int line, const __FlashStringHelper *msg) {
+  strncpy_P(fmtbuf, (PGM_P)msg, sizeof(fmtbuf)-1);
+  fmtbuf[sizeof(fmtbuf)-1] = 0;
+
+  log_push(LOG_SINK_SERIAL | LOG_SINK_WEB, fmtbuf, strlen(fmtbuf));
+}
+
+void _logprintf_P(const char *file, unsigned int line, const __FlashStringHelper *fmt, ...) {
+  va_list ap;
+
   va_start(ap, fmt);
-  vsprintf(str, foo, ap);
+  int len = vsnprintf_P(fmtbuf, sizeof(fmtbuf), (PGM_P)fmt, ap);
   va_end(ap);
 
-  _logprintln(file, line, str);
+  if(len >= (int)sizeof(fmtbuf)) {
+    len = sizeof(fmtbuf)-1;
+  }
+  if(len > 0) {
+    log_push(LOG_SINK_SERIAL | LOG_SINK_WEB, fmtbuf, len);
+  }
+}
+
+void _logcat_P(uint32_t id, PGM_P fmt, ...) {
+  va_list ap;
 
-  FREE(foo);
-  FREE(str);
-}
\ No newline at end of file
+  if(log_binary == 1) {
+    uint8_t *rec = (uint8_t *)fmtbuf;
+    memcpy(&rec[0], &id, 4);
+    memcpy(&rec[4], &fmt, sizeof(PGM_P));
+    va_start(ap, fmt);
+    uint16_t len = log_pack(&rec[LOG_BINARY_HEAD], sizeof(fmtbuf) - LOG_BINARY_HEAD - 1, fmt, ap);
+    va_end(ap);
+    log_push_entry(LOG_SINK_ALL, LOG_FLAG_BINARY, fmtbuf, LOG_BINARY_HEAD + len);
+    return;
+  }
+
+  va_start(ap, fmt);
+  int len = vsnprintf_P(fmtbuf, sizeof(fmtbuf), fmt, ap);
+  va_end(ap);
+
+  if(len >= (int)sizeof(fmtbuf)) {
+    len = sizeof(fmtbuf)-1;
+  }
+  if(len > 0) {
+    log_push(LOG_SINK_ALL, fmtbuf, len);
+  }
+}
+
+void _logcatln_P(uint32_t id, PGM_P msg) {
+  if(log_binary == 1) {
+    memcpy(&fmtbuf[0], &id, 4);
+    memcpy(&fmtbuf[4], &msg, sizeof(PGM_P));
+    log_push_entry(LOG_SINK_ALL, LOG_FLAG_BINARY, fmtbuf, LOG_BINARY_HEAD);
+    return;
+  }
+  strncpy_P(fmtbuf, msg, sizeof(fmtbuf)-1);
+  fmtbuf[sizeof(fmtbuf)-1] = 0;
+
+  log_push(LOG_SINK_ALL, fmtbuf, strlen(fmtbuf));
+}
+
+PGM_P log_category_name(uint8_t nr) {
+  if(nr >= LOG_NR_CATEGORIES) {
+    return NULL;
+  }
+  return category_names[nr];
+}
+
+int16_t log_categories_parse(const char *str) {
+  int16_t mask = 0;
+  uint8_t i = 0, len = 0;
+
+  while(*str == ' ') {
+    str++;
+  }
+  if(*str >= '0' && *str <= '9') {
+    int val = atoi(str);
+    if(val < 0 || val > 0xFF) {
+      return -1;
+    }
+    return val;
+  }
+  if(strcasecmp_P(str, PSTR("all")) == 0) {
+    return 0xFF;
+  }
+  if(strcasecmp_P(str, PSTR("none")) == 0 || *str == 0) {
+    return 0;
+  }
+  while(*str != 0) {
+    len = strcspn(str, ", ");
+    for(i=0;i<LOG_NR_CATEGORIES;i++) {
+      if(strlen_P(category_names[i]) == len && strncasecmp_P(str, category_names[i], len) == 0) {
+        mask |= (1 << i);
+        break;
+      }
+    }
+    if(i == LOG_NR_CATEGORIES) {
+      return -1;
+    }
+    str += len;
+    while(*str == ',' || *str == ' ') {
+      str++;
+    }
+  }
+  return mask;
+}
+
+int8_t log_level_parse(const char *str) {
+  uint8_t i = 0;
+
+  if(*str >= '0' && *str <= '9') {
+    int val = atoi(str);
+    if(val > LOG_DEBUG) {
+      return -1;
+    }
+    return val;
+  }
+  for(i=0;i<=LOG_DEBUG;i++) {
+    if(strcasecmp_P(str, level_names[i]) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
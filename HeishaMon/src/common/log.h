@@ -11,6 +11,123 @@
 
 #include <Arduino.h>
 
+/*
+ * Log lines are stored in a ring buffer and
+ * written to the sinks from log_loop(). Each
+ * sink keeps its own position in the ring, so
+ * a slow sink only loses its own lines.
+ */
+#ifndef LOG_RING_SIZE
+  #define LOG_RING_SIZE 2048 // power of two
+#endif
+
+#ifndef LOG_LINE_SIZE
+  #define LOG_LINE_SIZE 384
+#endif
+
+/*
+ * Time log_loop() may spend per call in microseconds
+ */
+#ifndef LOG_LOOP_BUDGET
+  #define LOG_LOOP_BUDGET 2000
+#endif
+
+/*
+ * Lines per second for each sink, 0 is unlimited
+ */
+#define LOG_RATE_SERIAL 0
+#define LOG_RATE_MQTT   20
+#define LOG_RATE_WEB    50
+
+#define LOG_SINK_SERIAL 0x01
+#define LOG_SINK_MQTT   0x02
+#define LOG_SINK_WEB    0x04
+#define LOG_SINK_ALL    0x07
+
+#define LOG_NR_SINKS    3
+
+/*
+ * Message categories and levels. A message
+ * is only formatted when both its category
+ * and level are enabled. Categories left out
+ * of LOG_CATEGORIES, or levels above
+ * LOG_LEVEL_MAX, are compiled out entirely.
+ */
+#define LOG_SERIAL      0x01
+#define LOG_DECODE      0x02
+#define LOG_MQTT        0x04
+#define LOG_RULES       0x08
+#define LOG_WEB         0x10
+#define LOG_S0          0x20
+#define LOG_DALLAS      0x40
+#define LOG_OT          0x80
+
+#define LOG_NR_CATEGORIES 8
+
+#define LOG_ERROR       0
+#define LOG_WARN        1
+#define LOG_INFO        2
+#define LOG_DEBUG       3
+
+#ifndef LOG_CATEGORIES
+  #define LOG_CATEGORIES  0xFF
+#endif
+
+#ifndef LOG_LEVEL_MAX
+  #define LOG_LEVEL_MAX   LOG_DEBUG
+#endif
+
+extern uint8_t log_categories;
+extern uint8_t log_level;
+extern uint8_t log_binary;
+
+/*
+ * In binary mode messages are stored as the
+ * id of their format string and the packed
+ * arguments. They are only formatted when a
+ * text sink sends them, websocket clients get
+ * the record itself and render it with the
+ * format table made by Tools/logformats.py.
+ * The id is the FNV-1a hash of the format.
+ */
+static constexpr uint32_t log_fmt_hash(const char *str, uint32_t hash = 2166136261UL) {
+  return (*str == 0) ? hash : log_fmt_hash(str + 1, (hash ^ (uint8_t)*str) * 16777619UL);
+}
+
+template<uint32_t id> struct log_fmt_id_t {
+  static const uint32_t value = id;
+};
+
+#define LOG_FMT_ID(fmt) (log_fmt_id_t<log_fmt_hash(fmt)>::value)
+
+/*
+ * String arguments are cut off at this length
+ * in binary records.
+ */
+#ifndef LOG_BINARY_STRLEN
+  #define LOG_BINARY_STRLEN 64
+#endif
+
+#define LOG_RECORD_VERSION 0x01
+
+#define log_enabled(cat, lvl) \
+  (((LOG_CATEGORIES) & (cat)) != 0 && (lvl) <= (LOG_LEVEL_MAX) && \
+   (log_categories & (cat)) != 0 && (lvl) <= log_level)
+
+#define logcat_P(cat, lvl, fmt, ...) \
+  do { \
+    if(log_enabled(cat, lvl)) { \
+      _logcat_P(LOG_FMT_ID(fmt), PSTR(fmt), ##__VA_ARGS__); \
+    } \
+  } while(0)
+
+#define logcatln_P(cat, lvl, msg) \
+  do { \
+    if(log_enabled(cat, lvl)) { \
+      _logcatln_P(LOG_FMT_ID(msg), PSTR(msg)); \
+    } \
+  } while(0)
+
 #define logprintln(a) _logprintln(__FILE__, __LINE__, a)
 #define logprintf(a, ...) _logprintf(__FILE__, __LINE__, a, ##__VA_ARGS__)
 #define logprintln_P(a) _logprintln_P(__FILE__, __LINE__, a)
@@ -21,4 +138,26 @@ void _logprintf(const char *file, unsigned int line, char *fmt, ...);
 void _logprintln_P(const char *file, unsigned int line, const __FlashStringHelper *msg);
 void _logprintf_P(const char *file, unsigned int line, const __FlashStringHelper *fmt, ...);
 
+void _logcat_P(uint32_t id, PGM_P fmt, ...);
+void _logcatln_P(uint32_t id, PGM_P msg);
+
+void log_message(char *string);
+void log_push(uint8_t sinks, const char *msg, uint16_t len);
+void log_loop(void);
+void log_flush(void);
+/*
+ * Lines a sink (0 serial, 1 mqtt, 2 web) lost
+ * because the ring was overwritten before the
+ * sink got to them, or the sink failed them.
+ */
+uint32_t log_dropped(uint8_t sink);
+/*
+ * Parse a category list ("decode,mqtt", "all",
+ * "none" or a number) or a level name. Return
+ * -1 when the text can't be parsed.
+ */
+int16_t log_categories_parse(const char *str);
+int8_t log_level_parse(const char *str);
+PGM_P log_category_name(uint8_t nr);
+
 #endif
@@ -0,0 +1,353 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <time.h>
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <PubSubClient.h>
+
+#include "outbox.h"
+#include "ring.h"
+#include "spool.h"
+#include "log.h"
+
+extern PubSubClient mqtt_client;
+extern WiFiClient mqtt_wifi_client;
+
+/*
+ * Every entry in the ring is a header directly
+ * followed by the inline topic (if any) and the
+ * payload.
+ */
+typedef struct outbox_entry_t {
+  uint32_t queued;
+  uint16_t id;
+  uint16_t len;
+  uint8_t tlen;
+  uint8_t flags;
+  uint16_t pad;
+} outbox_entry_t;
+
+// besides OUTBOX_RETAIN
+#define OUTBOX_DEAD   0x02
+
+static uint8_t buffer[OUTBOX_SIZE];
+static struct ring_t ring = {
+  buffer, OUTBOX_SIZE, sizeof(struct outbox_entry_t), offsetof(struct outbox_entry_t, len), 0, 0
+};
+
+static outbox_topic_cb_t *topic_cb = NULL;
+static struct outbox_stats_t stats;
+static uint64_t latency_total = 0;
+
+static uint8_t replay_tokens = 0;
+static unsigned long replay_refill = 0;
+static uint32_t replayed = 0;
+static uint8_t offline = 0;
+
+static uint16_t outbox_entry_size(struct outbox_entry_t *entry) {
+  return sizeof(struct outbox_entry_t) + entry->tlen + entry->len;
+}
+
+// drop the oldest message to make room
+static uint16_t outbox_evict(void *data) {
+  struct outbox_entry_t *entry = (struct outbox_entry_t *)data;
+  if((entry->flags & OUTBOX_DEAD) == 0) {
+    stats.depth--;
+    stats.dropped++;
+  }
+  return outbox_entry_size(entry);
+}
+
+static void outbox_remove(uint32_t pos, struct outbox_entry_t *entry) {
+  ring_data(&ring, pos)[offsetof(struct outbox_entry_t, flags)] |= OUTBOX_DEAD;
+  entry->flags |= OUTBOX_DEAD;
+  stats.depth--;
+}
+
+/*
+ * Forget a value that was queued before for
+ * the same topic and not sent yet
+ */
+static void outbox_coalesce(uint16_t id, const char *topic) {
+  struct outbox_entry_t entry;
+  uint32_t pos = ring.tail;
+
+  while(pos != ring.head) {
+    pos = ring_entry_at(&ring, pos, &entry);
+    if((entry.flags & OUTBOX_DEAD) == 0 && entry.id == id &&
+      (id != OUTBOX_TOPIC_INLINE ||
+       strcmp((char *)&ring_data(&ring, pos)[sizeof(struct outbox_entry_t)], topic) == 0)) {
+      outbox_remove(pos, &entry);
+      stats.coalesced++;
+      return;
+    }
+    pos += outbox_entry_size(&entry);
+  }
+}
+
+/*
+ * Move the values still waiting in the ring to
+ * the spool, so they are replayed in the order
+ * they were queued.
+ */
+static void outbox_spool(void) {
+  struct outbox_entry_t entry;
+  uint32_t pos = ring.tail;
+  time_t now = time(NULL);
+
+  while(pos != ring.head) {
+    pos = ring_entry_at(&ring, pos, &entry);
+    if((entry.flags & OUTBOX_DEAD) == 0 && entry.tlen == 0 && entry.len <= 0xFF) {
+      uint8_t *data = &ring_data(&ring, pos)[sizeof(struct outbox_entry_t)];
+      uint16_t id = entry.id | ((entry.flags & OUTBOX_RETAIN) ? OUTBOX_SPOOL_RETAIN : 0);
+      if(spool_write(now - (millis() - entry.queued) / 1000, id, (char *)data, entry.len) == 0) {
+        outbox_remove(pos, &entry);
+        stats.spooled++;
+      }
+    }
+    pos += outbox_entry_size(&entry);
+  }
+}
+
+static void outbox_offline(void) {
+  if(offline == 0) {
+    outbox_spool();
+    offline = 1;
+  }
+}
+
+static int8_t outbox_queue(uint16_t id, const char *topic, const char *payload, uint16_t len, uint8_t flags) {
+  struct outbox_entry_t entry;
+  uint16_t tlen = (topic == NULL) ? 0 : strlen(topic) + 1;
+
+  if(tlen > 0xFF || sizeof(struct outbox_entry_t) + tlen + len > OUTBOX_SIZE / 4) {
+    stats.dropped++;
+    return -1;
+  }
+
+  if(topic == NULL && spool_enabled() == 1 && !mqtt_client.connected()) {
+    outbox_offline();
+    if(len <= 0xFF && spool_write(time(NULL), id | ((flags & OUTBOX_RETAIN) ? OUTBOX_SPOOL_RETAIN : 0), payload, len) == 0) {
+      stats.spooled++;
+      return 0;
+    }
+  }
+
+  // every delta counts, so those are never replaced
+  if((flags & OUTBOX_DELTA) == 0) {
+    outbox_coalesce(id, topic);
+  }
+
+  uint8_t *at = ring_push(&ring, sizeof(struct outbox_entry_t) + tlen + len, &entry, outbox_evict);
+
+  entry.queued = millis();
+  entry.id = id;
+  entry.len = len;
+  entry.tlen = tlen;
+  entry.flags = flags & OUTBOX_RETAIN;
+  entry.pad = 0;
+
+  memcpy(at, &entry, sizeof(struct outbox_entry_t));
+  if(tlen > 0) {
+    memcpy(&at[sizeof(struct outbox_entry_t)], topic, tlen);
+  }
+  memcpy(&at[sizeof(struct outbox_entry_t)+tlen], payload, len);
+
+  stats.depth++;
+  stats.bytes = ring.head - ring.tail;
+  if(stats.bytes > stats.peak) {
+    stats.peak = stats.bytes;
+  }
+  return 0;
+}
+
+void outbox_init(outbox_topic_cb_t *callback) {
+  topic_cb = callback;
+}
+
+int8_t outbox_publish(uint16_t id, const char *payload, uint16_t len, uint8_t flags) {
+  return outbox_queue(id, NULL, payload, len, flags);
+}
+
+int8_t outbox_publish_topic(const char *topic, const char *payload, uint16_t len, uint8_t flags) {
+  return outbox_queue(OUTBOX_TOPIC_INLINE, topic, payload, len, flags);
+}
+
+int8_t outbox_publish_number(uint16_t id, int64_t value, uint8_t decimals, uint8_t flags) {
+  char buf[24];
+  uint8_t pos = sizeof(buf);
+  uint64_t num = (value < 0) ? -(uint64_t)value : value;
+
+  do {
+    buf[--pos] = '0' + (num % 10);
+    num /= 10;
+    if(decimals > 0 && sizeof(buf) - pos == decimals) {
+      buf[--pos] = '.';
+      if(num == 0) {
+        buf[--pos] = '0';
+      }
+    }
+  } while(num > 0 || sizeof(buf) - pos < decimals);
+  if(value < 0) {
+    buf[--pos] = '-';
+  }
+  return outbox_queue(id, NULL, &buf[pos], sizeof(buf) - pos, flags);
+}
+
+/*
+ * Publish a message when the TCP send window
+ * has room for the whole packet. Returns 1
+ * when the message was handled and 0 when it
+ * has to wait.
+ */
+static uint8_t outbox_publish_now(const char *topic, uint16_t tlen, const uint8_t *payload, uint16_t len, uint8_t retain) {
+  // fixed header, remaining length and topic length
+  uint32_t remaining = 2 + tlen + len;
+  uint16_t packet = 1 + (remaining < 128 ? 1 : (remaining < 16384 ? 2 : 3)) + remaining;
+
+  if(mqtt_wifi_client.availableForWrite() < packet) {
+    return 0;
+  }
+  if(!mqtt_client.publish(topic, payload, len, retain == 1)) {
+    // keep it for the next connection
+    if(!mqtt_client.connected()) {
+      return 0;
+    }
+    stats.dropped++;
+  }
+  return 1;
+}
+
+static uint8_t outbox_send(uint32_t pos, struct outbox_entry_t *entry) {
+  char topic[256];
+  uint8_t *data = &ring_data(&ring, pos)[sizeof(struct outbox_entry_t)];
+  uint16_t tlen = 0;
+
+  if(entry->tlen > 0) {
+    strncpy(topic, (char *)data, sizeof(topic)-1);
+    topic[sizeof(topic)-1] = 0;
+    tlen = strlen(topic);
+  } else if(topic_cb != NULL) {
+    tlen = topic_cb(entry->id, topic, sizeof(topic));
+  }
+  if(tlen == 0) {
+    // the topic is gone, nothing to send it to
+    stats.dropped++;
+    return 1;
+  }
+
+  uint32_t dropped = stats.dropped;
+  if(outbox_publish_now(topic, tlen, &data[entry->tlen], entry->len, (entry->flags & OUTBOX_RETAIN) ? 1 : 0) == 0) {
+    return 0;
+  }
+  if(dropped == stats.dropped) {
+    uint32_t latency = millis() - entry->queued;
+    latency_total += latency;
+    if(latency > stats.latency_max) {
+      stats.latency_max = latency;
+    }
+    stats.sent++;
+  }
+  return 1;
+}
+
+/*
+ * Send the spooled values, at most
+ * OUTBOX_REPLAY_RATE per second. Returns 1
+ * when the spool is empty.
+ */
+static uint8_t outbox_replay(unsigned long start) {
+  char topic[256];
+  char payload[256];
+  uint32_t stamp = 0;
+  uint16_t id = 0;
+  int16_t len = 0;
+
+  if((unsigned long)(millis() - replay_refill) >= 1000) {
+    replay_refill = millis();
+    replay_tokens = OUTBOX_REPLAY_RATE;
+  }
+  while(replay_tokens > 0 && (unsigned long)(micros() - start) < OUTBOX_LOOP_BUDGET) {
+    if((len = spool_peek(&stamp, &id, payload, sizeof(payload))) < 0) {
+      if(replayed > 0) {
+        logcat_P(LOG_MQTT, LOG_INFO, "Replayed %lu stored mqtt values", (unsigned long)replayed);
+        replayed = 0;
+      }
+      return 1;
+    }
+
+    time_t now = time(NULL);
+    uint16_t tlen = 0;
+    // only skip old values when the clock was set when they were stored and now
+    if(now < OUTBOX_TIME_VALID || stamp < OUTBOX_TIME_VALID || (uint32_t)(now - stamp) <= OUTBOX_REPLAY_MAX_AGE) {
+      if(topic_cb != NULL) {
+        tlen = topic_cb(id & ~OUTBOX_SPOOL_RETAIN, topic, sizeof(topic));
+      }
+    }
+    if(tlen > 0) {
+      if(outbox_publish_now(topic, tlen, (uint8_t *)payload, len, (id & OUTBOX_SPOOL_RETAIN) ? 1 : 0) == 0) {
+        return 0;
+      }
+      replay_tokens--;
+      replayed++;
+    }
+    spool_pop();
+  }
+  return 0;
+}
+
+void outbox_loop(void) {
+  struct outbox_entry_t entry;
+  unsigned long start = micros();
+
+  if(spool_enabled() == 1) {
+    spool_loop();
+    if(!mqtt_client.connected()) {
+      outbox_offline();
+      return;
+    }
+    offline = 0;
+    // newer values wait until the spool is sent
+    if(outbox_replay(start) == 0) {
+      return;
+    }
+  }
+  if(!mqtt_client.connected()) {
+    return;
+  }
+  while(ring.tail != ring.head && (unsigned long)(micros() - start) < OUTBOX_LOOP_BUDGET) {
+    uint32_t pos = ring_entry_at(&ring, ring.tail, &entry);
+    if((entry.flags & OUTBOX_DEAD) == 0) {
+      if(outbox_send(pos, &entry) == 0) {
+        break;
+      }
+      stats.depth--;
+    }
+    ring.tail = pos + outbox_entry_size(&entry);
+  }
+  if(ring.tail == ring.head) {
+    ring.head = ring.tail = 0;
+  }
+  stats.bytes = ring.head - ring.tail;
+}
+
+void outbox_stats(struct outbox_stats_t *out) {
+  struct spool_stats_t spool;
+
+  memcpy(out, &stats, sizeof(struct outbox_stats_t));
+  out->latency_avg = (stats.sent > 0) ? (latency_total / stats.sent) : 0;
+
+  spool_stats(&spool);
+  out->replayed = spool.read;
+  out->spool_dropped = spool.dropped;
+  out->spool_segments = spool.segments;
+}
@@ -0,0 +1,108 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifndef _OUTBOX_H_
+#define _OUTBOX_H_
+
+#include <Arduino.h>
+
+/*
+ * MQTT messages are queued in a ring buffer and
+ * published from outbox_loop(), as far as the
+ * TCP send window allows, so a slow broker
+ * never blocks the main loop. A queued value
+ * is replaced when a newer value for the same
+ * topic is queued before it was sent, unless it
+ * was queued with OUTBOX_DELTA.
+ */
+#ifndef OUTBOX_SIZE
+  #define OUTBOX_SIZE 4096 // power of two
+#endif
+
+/*
+ * Time outbox_loop() may spend per call in microseconds
+ */
+#ifndef OUTBOX_LOOP_BUDGET
+  #define OUTBOX_LOOP_BUDGET 2000
+#endif
+
+/*
+ * Topics are stored as an id that the topic
+ * callback turns into the full topic when the
+ * message is sent. Messages queued with
+ * outbox_publish_topic() store the topic itself.
+ */
+#define OUTBOX_TOPIC_INLINE 0xFFFF
+
+/*
+ * With the spool enabled (see spool.h) values
+ * queued by id while the broker can't be
+ * reached are stored on flash with the time
+ * they were made. After reconnecting they are
+ * sent again in the same order, at most
+ * OUTBOX_REPLAY_RATE per second, before any
+ * newer value. Values older than
+ * OUTBOX_REPLAY_MAX_AGE seconds are skipped.
+ * Ids must stay below OUTBOX_SPOOL_RETAIN.
+ */
+#ifndef OUTBOX_REPLAY_RATE
+  #define OUTBOX_REPLAY_RATE 20
+#endif
+
+#ifndef OUTBOX_REPLAY_MAX_AGE
+  #define OUTBOX_REPLAY_MAX_AGE 86400
+#endif
+
+#define OUTBOX_SPOOL_RETAIN 0x8000
+// before this time the clock was not set yet
+#define OUTBOX_TIME_VALID   1600000000
+
+/*
+ * Flags of the publish functions. A delta is
+ * a value that only makes sense together with
+ * all others for the topic, like the energy
+ * since the previous message, so it is never
+ * replaced by a newer one.
+ */
+#define OUTBOX_RETAIN 0x01
+#define OUTBOX_DELTA  0x04
+
+typedef uint16_t (outbox_topic_cb_t)(uint16_t id, char *buf, uint16_t size);
+
+typedef struct outbox_stats_t {
+  uint16_t depth;
+  uint16_t bytes;
+  uint16_t peak;
+  uint32_t sent;
+  uint32_t coalesced;
+  uint32_t dropped;
+  uint32_t latency_avg;
+  uint32_t latency_max;
+  uint32_t spooled;
+  uint32_t replayed;
+  uint32_t spool_dropped;
+  uint8_t spool_segments;
+} outbox_stats_t;
+
+void outbox_init(outbox_topic_cb_t *callback);
+/*
+ * Returns 0 when the message was queued and -1
+ * when it can never fit. When the ring is full
+ * the oldest messages are dropped.
+ */
+int8_t outbox_publish(uint16_t id, const char *payload, uint16_t len, uint8_t flags);
+int8_t outbox_publish_topic(const char *topic, const char *payload, uint16_t len, uint8_t flags);
+/*
+ * Queue value / 10^decimals as text, formatted
+ * without printf.
+ */
+int8_t outbox_publish_number(uint16_t id, int64_t value, uint8_t decimals, uint8_t flags);
+void outbox_loop(void);
+void outbox_stats(struct outbox_stats_t *stats);
+
+#endif
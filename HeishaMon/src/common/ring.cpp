@@ -0,0 +1,56 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <stdlib.h>
+
+#include <Arduino.h>
+
+#include "ring.h"
+
+uint8_t *ring_data(struct ring_t *ring, uint32_t pos) {
+  return &ring->buffer[pos & (ring->size-1)];
+}
+
+uint32_t ring_entry_at(struct ring_t *ring, uint32_t pos, void *entry) {
+  uint32_t at = pos & (ring->size-1);
+  uint16_t len = 0;
+
+  if(ring->size - at >= ring->hdrsize) {
+    memcpy(entry, &ring->buffer[at], ring->hdrsize);
+    memcpy(&len, &((uint8_t *)entry)[ring->lenoff], sizeof(uint16_t));
+    if(len != RING_WRAP) {
+      return pos;
+    }
+  }
+  pos += ring->size - at;
+  memcpy(entry, &ring->buffer[0], ring->hdrsize);
+  return pos;
+}
+
+uint8_t *ring_push(struct ring_t *ring, uint16_t size, void *entry, ring_evict_cb_t *evict) {
+  uint32_t at = ring->head & (ring->size-1);
+  uint32_t start = ring->head;
+  uint16_t wrap = RING_WRAP;
+
+  if(at + size > ring->size) {
+    start += ring->size - at;
+  }
+  while(ring->tail != ring->head && start + size - ring->tail > ring->size) {
+    ring->tail = ring_entry_at(ring, ring->tail, entry);
+    ring->tail += evict(entry);
+  }
+  if(ring->tail == ring->head) {
+    ring->tail = start;
+  }
+  if(start != ring->head && ring->size - at >= ring->hdrsize) {
+    memcpy(&ring->buffer[at + ring->lenoff], &wrap, sizeof(uint16_t));
+  }
+  ring->head = start + size;
+
+  return &ring->buffer[start & (ring->size-1)];
+}
@@ -0,0 +1,59 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifndef _RING_H_
+#define _RING_H_
+
+#include <Arduino.h>
+
+/*
+ * A ring buffer of variable sized entries. Every
+ * entry starts with a header that holds the length
+ * field as uint16_t at lenoff. An entry never
+ * wraps, a header with length RING_WRAP (or too
+ * little room for a header) marks the rest of the
+ * ring as unused.
+ *
+ * head and tail are byte positions that keep
+ * counting up, the index in the buffer is the
+ * position modulo size, which is a power of two.
+ */
+typedef struct ring_t {
+  uint8_t *buffer;
+  uint32_t size;
+  uint8_t hdrsize;
+  uint8_t lenoff;
+  uint32_t head;
+  uint32_t tail;
+} ring_t;
+
+#define RING_WRAP 0xFFFF
+
+/*
+ * Called for the oldest entry when it has to make
+ * room, with its header. Returns the size of the
+ * whole entry.
+ */
+typedef uint16_t (ring_evict_cb_t)(void *entry);
+
+uint8_t *ring_data(struct ring_t *ring, uint32_t pos);
+/*
+ * Read the header of the entry at or after pos
+ * into entry. Returns the position of the entry,
+ * which differs from pos when the ring wrapped.
+ */
+uint32_t ring_entry_at(struct ring_t *ring, uint32_t pos, void *entry);
+/*
+ * Reserve size bytes at the head, forgetting the
+ * oldest entries when needed. entry is used to
+ * read their headers. Returns where the caller
+ * writes the new entry.
+ */
+uint8_t *ring_push(struct ring_t *ring, uint16_t size, void *entry, ring_evict_cb_t *evict);
+
+#endif
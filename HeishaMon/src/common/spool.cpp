@@ -0,0 +1,346 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include <stdlib.h>
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include "spool.h"
+
+/*
+ * A segment starts with a header, followed by
+ * the records in the order they were written:
+ *
+ * - seconds since the previous record (or the
+ *   header time) as varint
+ * - the id as varint
+ * - the payload length as one byte
+ * - the payload
+ *
+ * A record is never split over two segments.
+ */
+typedef struct spool_header_t {
+  uint32_t magic;
+  uint32_t seq;
+  uint32_t time;
+} spool_header_t;
+
+#define SPOOL_MAGIC 0x4C4F5053
+
+/*
+ * Segment numbers keep counting up, the file
+ * used is the number modulo SPOOL_SEGMENTS.
+ * The segments in use are rd_seq up to and
+ * including wr_seq, none when rd_seq is
+ * wr_seq + 1.
+ */
+static uint8_t enabled = 0;
+static uint32_t rd_seq = 0;
+static uint32_t rd_off = 0;
+static uint32_t rd_time = 0;
+static uint32_t rd_next = 0;
+static uint32_t rd_next_time = 0;
+static File rd_file;
+
+static uint32_t wr_seq = 0xFFFFFFFF;
+static uint32_t wr_size = 0;
+static uint32_t wr_time = 0;
+static uint8_t wr_sealed = 0;
+
+static uint8_t buffer[SPOOL_BUFFER_SIZE];
+static uint16_t buffer_len = 0;
+static unsigned long buffer_time = 0;
+
+static struct spool_stats_t stats;
+
+static void spool_path(char *path, uint32_t seq) {
+  snprintf_P(path, 16, PSTR("/spool%u.bin"), (unsigned int)(seq % SPOOL_SEGMENTS));
+}
+
+static uint32_t spool_segments(void) {
+  return wr_seq + 1 - rd_seq;
+}
+
+static uint8_t spool_varint(uint8_t *out, uint32_t value) {
+  uint8_t n = 0;
+  while(value >= 0x80) {
+    out[n++] = (value & 0x7F) | 0x80;
+    value >>= 7;
+  }
+  out[n++] = value;
+  return n;
+}
+
+static int8_t spool_read_varint(File &f, uint32_t *value) {
+  uint8_t shift = 0;
+  *value = 0;
+  while(shift < 35) {
+    int c = f.read();
+    if(c < 0) {
+      return -1;
+    }
+    *value |= (uint32_t)(c & 0x7F) << shift;
+    if((c & 0x80) == 0) {
+      return 0;
+    }
+    shift += 7;
+  }
+  return -1;
+}
+
+/*
+ * Forget the oldest segment, either because
+ * it was read or because it is overwritten.
+ */
+static void spool_segment_done(void) {
+  char path[16];
+
+  if(rd_file) {
+    rd_file.close();
+  }
+  spool_path(path, rd_seq);
+  LittleFS.remove(path);
+  if(rd_seq == wr_seq) {
+    buffer_len = 0;
+    wr_size = 0;
+  }
+  rd_seq++;
+  rd_off = 0;
+}
+
+void spool_flush(void) {
+  char path[16];
+
+  if(buffer_len == 0) {
+    return;
+  }
+  spool_path(path, wr_seq);
+  File f = LittleFS.open(path, (wr_size == 0) ? "w" : "a");
+  if(!f || f.write(buffer, buffer_len) != buffer_len) {
+    // the segment is lost, start a new one for the next record
+    stats.dropped++;
+    wr_sealed = 1;
+  } else {
+    wr_size += buffer_len;
+  }
+  if(f) {
+    f.close();
+  }
+  buffer_len = 0;
+
+  // the reader has to reopen the file to see what was added
+  if(rd_seq == wr_seq && rd_file) {
+    rd_file.close();
+  }
+}
+
+static void spool_rotate(uint32_t time) {
+  struct spool_header_t header;
+
+  spool_flush();
+
+  wr_seq++;
+  wr_size = 0;
+  wr_time = time;
+  wr_sealed = 0;
+  while(spool_segments() > SPOOL_SEGMENTS) {
+    spool_segment_done();
+    stats.dropped++;
+  }
+
+  header.magic = SPOOL_MAGIC;
+  header.seq = wr_seq;
+  header.time = time;
+  memcpy(buffer, &header, sizeof(struct spool_header_t));
+  buffer_len = sizeof(struct spool_header_t);
+  buffer_time = millis();
+}
+
+int8_t spool_write(uint32_t time, uint16_t id, const char *payload, uint8_t len) {
+  uint8_t head[11];
+  uint8_t n = 0;
+
+  if(enabled == 0) {
+    return -1;
+  }
+
+  if(spool_segments() == 0 || wr_sealed == 1) {
+    spool_rotate(time);
+  }
+  if(time < wr_time) {
+    time = wr_time;
+  }
+  n += spool_varint(&head[n], time - wr_time);
+  n += spool_varint(&head[n], id);
+  head[n++] = len;
+
+  if(wr_size + buffer_len + n + len > SPOOL_SEGMENT_SIZE) {
+    spool_rotate(time);
+    return spool_write(time, id, payload, len);
+  }
+  if(buffer_len + n + len > SPOOL_BUFFER_SIZE) {
+    spool_flush();
+  }
+  if(buffer_len == 0) {
+    buffer_time = millis();
+  }
+  memcpy(&buffer[buffer_len], head, n);
+  memcpy(&buffer[buffer_len+n], payload, len);
+  buffer_len += n + len;
+
+  wr_time = time;
+  stats.written++;
+  return 0;
+}
+
+int16_t spool_peek(uint32_t *time, uint16_t *id, char *payload, uint16_t size) {
+  char path[16];
+
+  while(spool_segments() > 0) {
+    if(rd_seq == wr_seq) {
+      if(rd_off > 0 && rd_off >= wr_size + buffer_len) {
+        return -1;
+      }
+      if(rd_off >= wr_size) {
+        spool_flush();
+      }
+    }
+    if(!rd_file) {
+      spool_path(path, rd_seq);
+      rd_file = LittleFS.open(path, "r");
+      if(!rd_file) {
+        spool_segment_done();
+        continue;
+      }
+      if(rd_off == 0) {
+        struct spool_header_t header;
+        if(rd_file.read((uint8_t *)&header, sizeof(struct spool_header_t)) != sizeof(struct spool_header_t) ||
+           header.magic != SPOOL_MAGIC || header.seq != rd_seq) {
+          spool_segment_done();
+          continue;
+        }
+        rd_off = sizeof(struct spool_header_t);
+        rd_time = header.time;
+      }
+    }
+    if(rd_file.position() != rd_off) {
+      rd_file.seek(rd_off, SeekSet);
+    }
+
+    uint32_t delta = 0, nr = 0;
+    int c = 0;
+    if(spool_read_varint(rd_file, &delta) < 0 ||
+       spool_read_varint(rd_file, &nr) < 0 ||
+       (c = rd_file.read()) < 0 ||
+       rd_file.read((uint8_t *)payload, (c < size) ? c : size) != (size_t)((c < size) ? c : size)) {
+      // end of the segment, or a record cut off by a reset
+      spool_segment_done();
+      continue;
+    }
+    if(c > size) {
+      rd_file.seek(c - size, SeekCur);
+      c = size;
+    }
+    rd_next = rd_file.position();
+    rd_next_time = rd_time + delta;
+
+    *time = rd_next_time;
+    *id = nr;
+    return c;
+  }
+  return -1;
+}
+
+void spool_pop(void) {
+  if(rd_next <= rd_off) {
+    return;
+  }
+  rd_off = rd_next;
+  rd_time = rd_next_time;
+  stats.read++;
+
+  if(rd_seq == wr_seq && rd_off >= wr_size + buffer_len) {
+    spool_segment_done();
+  }
+}
+
+void spool_loop(void) {
+  if(buffer_len > 0 && (unsigned long)(millis() - buffer_time) >= SPOOL_FLUSH_INTERVAL * 1000UL) {
+    spool_flush();
+  }
+}
+
+uint8_t spool_enabled(void) {
+  return enabled;
+}
+
+int8_t spool_init(void) {
+  struct spool_header_t header;
+  char path[16];
+  uint8_t found = 0;
+
+  if(enabled == 1) {
+    return 0;
+  }
+  if(!LittleFS.begin()) {
+    return -1;
+  }
+
+  rd_seq = 0;
+  rd_off = 0;
+  rd_next = 0;
+  wr_seq = 0xFFFFFFFF;
+  wr_size = 0;
+  wr_sealed = 0;
+  for(uint8_t i = 0; i < SPOOL_SEGMENTS; i++) {
+    spool_path(path, i);
+    File f = LittleFS.open(path, "r");
+    if(!f) {
+      continue;
+    }
+    if(f.read((uint8_t *)&header, sizeof(struct spool_header_t)) == sizeof(struct spool_header_t) &&
+       header.magic == SPOOL_MAGIC && (header.seq % SPOOL_SEGMENTS) == i) {
+      if(found == 0 || header.seq < rd_seq) {
+        rd_seq = header.seq;
+      }
+      if(found == 0 || header.seq > wr_seq) {
+        wr_seq = header.seq;
+        wr_size = f.size();
+      }
+      found = 1;
+    }
+    f.close();
+  }
+  if(found == 1) {
+    /*
+     * The time of the last record is not known
+     * without reading the whole segment, so new
+     * records go to the next one.
+     */
+    wr_sealed = 1;
+  }
+  enabled = 1;
+  return 0;
+}
+
+void spool_disable(void) {
+  if(enabled == 0) {
+    return;
+  }
+  spool_flush();
+  if(rd_file) {
+    rd_file.close();
+  }
+  enabled = 0;
+}
+
+void spool_stats(struct spool_stats_t *out) {
+  memcpy(out, &stats, sizeof(struct spool_stats_t));
+  out->segments = spool_segments();
+}
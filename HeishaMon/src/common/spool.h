@@ -0,0 +1,80 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifndef _SPOOL_H_
+#define _SPOOL_H_
+
+#include <Arduino.h>
+
+/*
+ * The spool keeps messages on LittleFS while
+ * they can't be sent. It is an append-only
+ * ring of segment files that are written one
+ * after another. A segment is removed as soon
+ * as it has been read, so the flash wear is
+ * spread over all segments. When all segments
+ * are in use the oldest one is overwritten.
+ */
+#ifndef SPOOL_SEGMENTS
+  #define SPOOL_SEGMENTS 16
+#endif
+
+#ifndef SPOOL_SEGMENT_SIZE
+  #define SPOOL_SEGMENT_SIZE 4096
+#endif
+
+/*
+ * Records are collected in memory and written
+ * when the buffer is full or after
+ * SPOOL_FLUSH_INTERVAL seconds.
+ */
+#ifndef SPOOL_BUFFER_SIZE
+  #define SPOOL_BUFFER_SIZE 512
+#endif
+
+#ifndef SPOOL_FLUSH_INTERVAL
+  #define SPOOL_FLUSH_INTERVAL 60
+#endif
+
+typedef struct spool_stats_t {
+  uint32_t written;
+  uint32_t read;
+  uint32_t dropped;
+  uint8_t segments;
+} spool_stats_t;
+
+/*
+ * Pick up the segments left from before a
+ * reboot. Returns -1 when the filesystem
+ * can't be used.
+ */
+int8_t spool_init(void);
+/*
+ * Write what is buffered and stop using the
+ * spool. The segments stay on the filesystem
+ * until the next spool_init.
+ */
+void spool_disable(void);
+uint8_t spool_enabled(void);
+/*
+ * Append a record with the time it was made.
+ * Returns -1 when it can't be stored.
+ */
+int8_t spool_write(uint32_t time, uint16_t id, const char *payload, uint8_t len);
+/*
+ * Read the oldest record without removing it.
+ * Returns the payload length or -1 when the
+ * spool is empty.
+ */
+int16_t spool_peek(uint32_t *time, uint16_t *id, char *payload, uint16_t size);
+void spool_pop(void);
+void spool_flush(void);
+void spool_loop(void);
+void spool_stats(struct spool_stats_t *stats);
+
+#endif
@@ -60,6 +60,11 @@
   #define ERR_OK 0
 #endif
 
+static void webserver_next_request(struct webserver_t *client);
+static uint16_t webserver_queue_pack(struct webserver_t *client, unsigned char *buf, uint16_t len);
+static void webserver_queue_notice(struct webserver_t *client);
+static void webserver_events_ping(struct webserver_t *client);
+
 void log_message(char *string);
 void log_message(const __FlashStringHelper *msg);
 
@@ -471,6 +476,73 @@ static int webserver_parse_post(struct webserver_t *client, uint16_t size) {
   return 0;
 }
 
+/*
+ * The multipart delimiter is stored as "\r\n--"
+ * followed by the boundary, directly followed
+ * by its KMP failure table. The value parser
+ * feeds every received byte once through this
+ * table, so the matching state survives a
+ * delimiter split over several TCP segments.
+ */
+static char *webserver_boundary_create(char *boundary) {
+  uint16_t len = strlen(boundary)+4, i = 0;
+  uint8_t k = 0;
+  char *delim = NULL;
+
+  if((delim = (char *)malloc((len*2)+1)) == NULL) {
+    return NULL;
+  }
+  memcpy(delim, "\r\n--", 4);
+  memcpy(&delim[4], boundary, len-4);
+  delim[len] = 0;
+
+  uint8_t *fail = (uint8_t *)&delim[len+1];
+  fail[0] = 0;
+  for(i=1;i<len;i++) {
+    while(k > 0 && delim[i] != delim[k]) {
+      k = fail[k-1];
+    }
+    if(delim[i] == delim[k]) {
+      k++;
+    }
+    fail[i] = k;
+  }
+  return delim;
+}
+
+/*
+ * Advance the delimiter matcher over the
+ * buffer, starting at client->scanned. Only
+ * carriage returns can start a delimiter,
+ * so plain data is skipped with memchr.
+ */
+static void webserver_boundary_scan(struct webserver_t *client, uint16_t len) {
+  char *delim = client->data.boundary;
+  uint8_t *fail = (uint8_t *)&delim[len+1];
+  uint16_t i = client->scanned;
+  uint8_t m = client->matched;
+
+  while(i < client->ptr && m < len) {
+    if(m == 0) {
+      unsigned char *p = (unsigned char *)memchr(&client->buffer[i], '\r', client->ptr-i);
+      if(p == NULL) {
+        i = client->ptr;
+        break;
+      }
+      i = p-client->buffer;
+    }
+    unsigned char c = client->buffer[i++];
+    while(m > 0 && c != (unsigned char)delim[m]) {
+      m = fail[m-1];
+    }
+    if(c == (unsigned char)delim[m]) {
+      m++;
+    }
+  }
+  client->scanned = i;
+  client->matched = m;
+}
+
 int8_t http_parse_request(struct webserver_t *client, uint8_t **buf, uint16_t *len) {
   uint16_t hasread = MIN(WEBSERVER_BUFFER_SIZE-client->ptr, *len);
 
@@ -489,6 +561,7 @@ int8_t http_parse_request(struct webserver_t *client, uint8_t **buf, uint16_t *l
     if(client->substep == 0) {
       if(memcmp_P(client->buffer, PSTR("GET "), 4) == 0) {
         client->method = 0;
+        client->keepalive = (client->requests+1 < WEBSERVER_MAX_REQUESTS);
         if(client->callback != NULL) {
           client->step = WEBSERVER_CLIENT_REQUEST_METHOD;
           if(client->callback != NULL) {
@@ -506,6 +579,7 @@ int8_t http_parse_request(struct webserver_t *client, uint8_t **buf, uint16_t *l
       if(memcmp_P(client->buffer, PSTR("POST "), 5) == 0) {
         client->method = 1;
         client->reqtype = 0;
+        client->keepalive = 0;
         client->step = WEBSERVER_CLIENT_REQUEST_METHOD;
         if(client->callback != NULL) {
           if(client->callback(client, (void *)"POST") == -1) {
@@ -637,6 +711,11 @@ int8_t http_parse_request(struct webserver_t *client, uint8_t **buf, uint16_t *l
               memcpy(tmp, &client->buffer[x+1], args.len);
               client->totallen = atoi(tmp);
             }
+            if(strcasecmp_P((char *)args.name, PSTR("Connection")) == 0) {
+              if(strncasestr(&client->buffer[x+1], "close", args.len) != NULL) {
+                client->keepalive = 0;
+              }
+            }
             if(memcmp_P(args.name, PSTR("Sec-WebSocket-Version"), 21) == 0) {
               client->is_websocket = 1;
             }
@@ -663,7 +742,7 @@ int8_t http_parse_request(struct webserver_t *client, uint8_t **buf, uint16_t *l
                   uint8_t pos = (ptr-tmp)+strlen("boundary=");
                   memmove(&tmp[0], &tmp[pos], args.len-pos);
                   tmp[args.len-pos] = 0;
-                  if((client->data.boundary = strdup(tmp)) == NULL) {
+                  if((client->data.boundary = webserver_boundary_create(tmp)) == NULL) {
 #ifdef ESP8266
                     Serial1.printf(PSTR("Out of memory %s:#%d\n"), __FUNCTION__, __LINE__);
                     ESP.restart();
@@ -750,25 +829,6 @@ int http_parse_body(struct webserver_t *client, char *buf, uint16_t len) {
   return 0;
 }
 
-char *strnstr(const char *haystack, const char *needle, size_t len) {
-  int i;
-  size_t needle_len;
-
-  if(0 == (needle_len = strnlen(needle, len))) {
-    return (char *)haystack;
-  }
-
-  for(i=0; i<=(int)(len-needle_len); i++) {
-    if((haystack[0] == needle[0]) && (0 == strncmp(haystack, needle, needle_len))) {
-      return (char *)haystack;
-    }
-
-    haystack++;
-  }
-  return NULL;
-}
-
-
 int http_parse_multipart_body(struct webserver_t *client, unsigned char *buf, uint16_t len) {
   uint16_t hasread = MIN(WEBSERVER_BUFFER_SIZE-client->ptr, len);
   uint16_t rpos = 0, loop = 1;
@@ -784,14 +844,14 @@ int http_parse_multipart_body(struct webserver_t *client, unsigned char *buf, ui
       switch(client->substep) {
         // Boundary
         case 0: {
-          unsigned char *ptr = strnstr(client->buffer, client->data.boundary, client->ptr);
+          unsigned char *ptr = strnstr(client->buffer, &client->data.boundary[4], client->ptr);
           unsigned char *ptr1 = (unsigned char *)memchr(client->buffer, '=', client->ptr);
           uint16_t pos1 = 0;
           if(ptr1 != NULL) {
             pos1 = (ptr1-client->buffer)+1;
           }
           if(ptr != NULL) {
-            uint16_t pos = (ptr-client->buffer)+strlen(client->data.boundary);
+            uint16_t pos = (ptr-client->buffer)+strlen(client->data.boundary)-4;
             if(pos1 > pos) {
               /*
                * Only compensate for the key at the
@@ -838,12 +898,8 @@ int http_parse_multipart_body(struct webserver_t *client, unsigned char *buf, ui
           } else if(client->ptr < WEBSERVER_BUFFER_SIZE) {
             loop = 0;
           } else {
-            /*
-             * We encountered the boundary delimiter, but
-             * it wasn't the one from this request, but it
-             * was part of the POST body
-             */
-            client->substep = 8;
+            // Body doesn't start with the boundary
+            return -1;
           }
           if(client->substep == 0) {
             loop = 0;
@@ -984,83 +1040,76 @@ int http_parse_multipart_body(struct webserver_t *client, unsigned char *buf, ui
           }
         } break;
         // Value
-        case 8:
         case 7: {
-          unsigned char *ptr = strnstr(client->buffer, "\r\n--", client->ptr);
-          if(ptr != NULL && client->substep != 8) {
-            uint16_t pos = (ptr-client->buffer);
+          unsigned char *ptr = (unsigned char *)memchr(client->buffer, '=', client->ptr);
+          uint16_t dlen = strlen(client->data.boundary);
+          uint16_t vlen = 0;
 
-            ptr = (unsigned char *)memchr(client->buffer, '=', client->ptr);
-            uint16_t vlen = 0;
+          if(ptr != NULL) {
+            vlen = (ptr-client->buffer);
+          } else {
+            // error
+            return -1; /*LCOV_EXCL_LINE*/
+          }
+          if(vlen+1+dlen >= WEBSERVER_BUFFER_SIZE) {
+            return -1; /*LCOV_EXCL_LINE*/
+          }
+          if(client->scanned < vlen+1) {
+            client->scanned = vlen+1;
+          }
 
-            if(ptr != NULL) {
-              vlen = (ptr-client->buffer);
-            } else {
-              // error
-              return -1; /*LCOV_EXCL_LINE*/
-            }
+          webserver_boundary_scan(client, dlen);
 
-			if (pos != (vlen+1)) { //check if separator was already at begin buffer, so nothing to do here
-				struct arguments_t args;
-				client->buffer[vlen] = 0;
-
-				args.name = &client->buffer[0];
-				args.value = &client->buffer[vlen+1];
-				args.len = pos-(vlen+1);
-
-				if(client->callback != NULL) {
-					uint8_t ret = client->callback(client, &args);
-					if(ret == -1) {
-						return -1;
-					}
-				}
-
-				client->buffer[vlen] = '=';
-				memmove(&client->buffer[vlen+1], &client->buffer[pos], client->ptr-pos);
-				client->readlen += (pos-(vlen+1));
-				client->ptr -= (pos-(vlen+1));
-			}
-            client->substep = 0;
-          } else if(client->ptr == WEBSERVER_BUFFER_SIZE) {
-            uint8_t ending = 0;
-            /*
-             * Double check that the CR / LN don't belong
-             * to the boundary delimiter.
-             */
-            if(strncmp((char *)&client->buffer[client->ptr-2], "\r\n", 2) == 0) {
-              ending = 2;
-            }
-            if(client->substep == 8) {
-              client->substep = 7;
-            }
-            unsigned char *ptr = (unsigned char *)memchr(client->buffer, '=', client->ptr);
-            if(ptr != NULL) {
-              uint16_t pos = (ptr-client->buffer);
+          if(client->matched == dlen) {
+            uint16_t pos = client->scanned-dlen;
 
+            if(pos != (vlen+1)) { //check if separator was already at begin buffer, so nothing to do here
               struct arguments_t args;
-              client->buffer[pos] = 0;
+              client->buffer[vlen] = 0;
 
               args.name = &client->buffer[0];
-              args.value = &client->buffer[pos+1];
-              args.len = (WEBSERVER_BUFFER_SIZE-ending)-(pos+1);
+              args.value = &client->buffer[vlen+1];
+              args.len = pos-(vlen+1);
 
               if(client->callback != NULL) {
-                uint8_t ret = client->callback(client, &args);
+                int8_t ret = client->callback(client, &args);
                 if(ret == -1) {
                   return -1;
                 }
               }
-              client->buffer[pos] = '=';
-              if(ending == 2) {
-                client->buffer[pos+1] = '\r';
-                client->buffer[pos+2] = '\n';
+
+              client->buffer[vlen] = '=';
+              memmove(&client->buffer[vlen+1], &client->buffer[pos], client->ptr-pos);
+              client->readlen += (pos-(vlen+1));
+              client->ptr -= (pos-(vlen+1));
+            }
+            client->matched = 0;
+            client->scanned = 0;
+            client->substep = 0;
+          } else if(client->ptr == WEBSERVER_BUFFER_SIZE) {
+            /*
+             * Pass on everything except the bytes that
+             * might be the start of the delimiter.
+             */
+            uint16_t pos = client->ptr-client->matched;
+            struct arguments_t args;
+            client->buffer[vlen] = 0;
+
+            args.name = &client->buffer[0];
+            args.value = &client->buffer[vlen+1];
+            args.len = pos-(vlen+1);
+
+            if(client->callback != NULL) {
+              int8_t ret = client->callback(client, &args);
+              if(ret == -1) {
+                return -1;
               }
-              client->readlen += ((client->ptr-(pos+1))-ending);
-              client->ptr = pos+1+ending;
-            } else {
-              // error
-              return -1;
             }
+            client->buffer[vlen] = '=';
+            memmove(&client->buffer[vlen+1], &client->buffer[pos], client->matched);
+            client->readlen += (pos-(vlen+1));
+            client->ptr = vlen+1+client->matched;
+            client->scanned = client->ptr;
           } else {
             loop = 0;
           }
@@ -1169,6 +1218,33 @@ static PGM_P code_to_text(uint16_t code) {
   /* LCOV_EXCL_STOP*/
 }
 
+static uint16_t webserver_connection_header(struct webserver_t *client, unsigned char *p, uint16_t size) {
+  if(client->keepalive == 1) {
+    return snprintf_P((char *)p, size, PSTR("Keep-Alive: timeout=%d, max=%d\r\n"), WEBSERVER_KEEPALIVE_TIMEOUT/1000, WEBSERVER_MAX_REQUESTS-client->requests-1);
+  } else {
+    return snprintf_P((char *)p, size, PSTR("Connection: close\r\n"));
+  }
+}
+
+/*
+ * Terminate a header that was completely
+ * written by the callback, with a length so
+ * the connection can be reused afterwards.
+ */
+static uint16_t webserver_finish_header(struct webserver_t *client, unsigned char *p, uint16_t i, uint16_t size, uint16_t code, uint16_t len) {
+  if(i >= 4 && memcmp_P(&p[i-4], PSTR("\r\n\r\n"), 4) == 0) {
+    i -= 2;
+  } else if(i < 2 || memcmp_P(&p[i-2], PSTR("\r\n"), 2) != 0) {
+    i += snprintf_P((char *)&p[i], size-i, PSTR("\r\n"));
+  }
+  i += webserver_connection_header(client, &p[i], size-i);
+  if(code != 304) {
+    i += snprintf_P((char *)&p[i], size-i, PSTR("Content-Length: %d\r\n"), len);
+  }
+  i += snprintf_P((char *)&p[i], size-i, PSTR("\r\n"));
+  return i;
+}
+
 static uint16_t webserver_create_header(struct webserver_t *client, uint16_t code, char *mimetype, uint16_t len) {
   uint16_t i = 0;
   unsigned char buffer[512], *p = buffer;
@@ -1182,16 +1258,9 @@ static uint16_t webserver_create_header(struct webserver_t *client, uint16_t cod
     header.ptr = i;
 
     if(client->callback(client, &header) == -1) {
-      if(strstr_P((char *)&p[i], PSTR("\r\n\r\n")) == NULL) {
-        if(strstr((char *)&p[i], PSTR("\r\n")) != NULL) {
-          header.ptr += snprintf_P((char *)&p[header.ptr], sizeof(buffer)-header.ptr, PSTR("\r\n"));
-        } else {
-          header.ptr += snprintf_P((char *)&p[header.ptr], sizeof(buffer)-header.ptr, PSTR("\r\n\r\n"));
-        }
-      }
+      i = webserver_finish_header(client, p, header.ptr, sizeof(buffer), code, len);
       client->step = WEBSERVER_CLIENT_WRITE;
-      i = header.ptr;
-      return i;
+      goto done;
     }
 
     if(header.ptr > i && strstr_P((char *)&p[i], PSTR("\r\n")) == NULL) {
@@ -1201,11 +1270,11 @@ static uint16_t webserver_create_header(struct webserver_t *client, uint16_t cod
     client->step = WEBSERVER_CLIENT_WRITE;
   }
   i += snprintf_P((char *)&p[i], sizeof(buffer) - i, PSTR("Server: ESP8266\r\n"));
-  i += snprintf_P((char *)&p[i], sizeof(buffer) - i, PSTR("Keep-Alive: timeout=15, max=100\r\n"));
+  i += webserver_connection_header(client, &p[i], sizeof(buffer) - i);
   i += snprintf_P((char *)&p[i], sizeof(buffer) - i, PSTR("Content-Type: %s\r\n"), mimetype);
   i += snprintf_P((char *)&p[i], sizeof(buffer) - i, PSTR("Content-Length: %d\r\n\r\n"), len);
 
-
+done:
   if(client->async == 1) {
     tcp_write(client->pcb, &buffer, i, 0);
     tcp_output(client->pcb);
@@ -1220,108 +1289,56 @@ static uint16_t webserver_create_header(struct webserver_t *client, uint16_t cod
   return i;
 }
 
-static int webserver_process_send(struct webserver_t *client) {
-  struct sendlist_t *tmp = NULL;
-  uint16_t cpylen = client->totallen, i = 0, cpyptr = client->ptr;
-  unsigned char cpy[client->totallen+1];
-  memset(&cpy, 0, client->totallen+1);
-
 #if WEBSERVER_MAX_SENDLIST == 0
-  tmp = client->sendlist;
-#else
-  uint8_t x = 0, y = 0;
-  for(x=0;x<WEBSERVER_MAX_SENDLIST;x++) {
-    if(
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-      client->sendlist[x].data.ptr != NULL
-#else
-      (client->sendlist[x].type == 1 && client->sendlist[x].data.ptr != NULL) ||
-      (client->sendlist[x].type == 0 && strlen((char *)client->sendlist[x].data.fixed) > 0)
-#endif
-    ) {
-      tmp = &client->sendlist[x];
-      break;
+/*
+ * Sendlist entries are taken from a fixed pool
+ * instead of being allocated per fragment.
+ */
+static struct sendlist_t sendpool[WEBSERVER_SENDPOOL_SIZE];
+static struct sendlist_t *sendpool_free = NULL;
+static uint8_t sendpool_init = 0;
+static uint8_t sendpool_used = 0;
+static uint8_t sendpool_peak = 0;
+
+static struct sendlist_t *webserver_sendpool_get(void) {
+  struct sendlist_t *node = NULL;
+  uint8_t i = 0;
+
+  if(sendpool_init == 0) {
+    for(i=0;i<WEBSERVER_SENDPOOL_SIZE;i++) {
+      sendpool[i].next = sendpool_free;
+      sendpool_free = &sendpool[i];
     }
+    sendpool_init = 1;
   }
-#endif
 
-  if(client->chunked == 1) {
-    while(tmp != NULL && cpylen > 0) {
-      if(cpyptr == 0) {
-        if(cpylen >= tmp->size) {
-          cpyptr += tmp->size;
-          cpylen -= tmp->size;
-#if WEBSERVER_MAX_SENDLIST == 0
-          tmp = tmp->next;
-#else
-          tmp = NULL;
-          for(y=x+1;y<WEBSERVER_MAX_SENDLIST;y++) {
-            if(
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-              client->sendlist[y].data.ptr != NULL
-#else
-              (client->sendlist[y].type == 1 && client->sendlist[y].data.ptr != NULL) ||
-              (client->sendlist[y].type == 0 && strlen((char *)client->sendlist[y].data.fixed) > 0)
-#endif
-            ) {
-              tmp = &client->sendlist[y];
-              x = y;
-              break;
-            }
-          }
+  if((node = sendpool_free) != NULL) {
+    sendpool_free = node->next;
+    memset(node, 0, sizeof(struct sendlist_t));
+    if(++sendpool_used > sendpool_peak) {
+      sendpool_peak = sendpool_used;
+    }
+  }
+  return node;
+}
 #endif
-          cpyptr = 0;
-        } else {
-          cpyptr += cpylen;
-          cpylen = 0;
-        }
-      } else if(cpyptr+cpylen >= tmp->size) {
-        cpylen -= (tmp->size-cpyptr);
+
+/*
+ * Most sendpool entries in use at the same time
+ */
+uint16_t webserver_sendpool_peak(void) {
 #if WEBSERVER_MAX_SENDLIST == 0
-          tmp = tmp->next;
-#else
-          tmp = NULL;
-          for(y=x+1;y<WEBSERVER_MAX_SENDLIST;y++) {
-            if(
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-              client->sendlist[y].data.ptr != NULL
+  return sendpool_peak;
 #else
-              (client->sendlist[y].type == 1 && client->sendlist[y].data.ptr != NULL) ||
-              (client->sendlist[y].type == 0 && strlen((char *)client->sendlist[y].data.fixed) > 0)
-#endif
-            ) {
-              tmp = &client->sendlist[y];
-              x = y;
-              break;
-            }
-          }
+  return 0;
 #endif
-        cpyptr = 0;
-      } else {
-        cpyptr += cpylen;
-        cpylen = 0;
-      }
-    }
-
-    unsigned char chunk_size[12];
-    size_t n = snprintf_P((char *)chunk_size, sizeof(chunk_size), PSTR("%X\r\n"), client->totallen - cpylen);
-
-    if(client->async == 1) {
-      tcp_write(client->pcb, chunk_size, n, 0);
-    } else {
-      if(client->client->write(chunk_size, n) > 0) {
-        if(client->is_websocket == 0) {
-          client->lastseen = millis();
-        }
-      }
-    }
-    i += n;
-  }
+}
 
+static struct sendlist_t *webserver_sendlist_first(struct webserver_t *client) {
 #if WEBSERVER_MAX_SENDLIST == 0
-  tmp = client->sendlist;
+  return client->sendlist;
 #else
-  x = 0, y = 0;
+  uint8_t x = 0;
   for(x=0;x<WEBSERVER_MAX_SENDLIST;x++) {
     if(
 #if WEBSERVER_SENDLIST_BUFSIZE == 0
@@ -1331,324 +1348,336 @@ static int webserver_process_send(struct webserver_t *client) {
       (client->sendlist[x].type == 0 && strlen((char *)client->sendlist[x].data.fixed) > 0)
 #endif
     ) {
-      tmp = &client->sendlist[x];
-      break;
+      return &client->sendlist[x];
     }
   }
+  return NULL;
 #endif
-  if(tmp != NULL) {
-    while(tmp != NULL && client->totallen > 0) {
-      if(client->ptr == 0) {
-        if(client->totallen >= tmp->size) {
-          if(tmp->type == 1) {
-            memcpy_P(cpy, &((PGM_P)tmp->data.ptr)[client->ptr], tmp->size);
-            if(client->async == 1) {
-              tcp_write(client->pcb, cpy, tmp->size, TCP_WRITE_FLAG_MORE);
-            } else {
-              if(client->client->write(cpy, tmp->size) > 0) {
-                if(client->is_websocket == 0) {
-                  client->lastseen = millis();
-                }
-              }
-            }
-          } else {
-            if(client->async == 1) {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-              tcp_write(client->pcb, &((unsigned char *)tmp->data.ptr)[client->ptr], tmp->size, TCP_WRITE_FLAG_MORE);
-#else
-              tcp_write(client->pcb, &((unsigned char *)tmp->data.fixed)[client->ptr], tmp->size, TCP_WRITE_FLAG_MORE);
-#endif
-            } else {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-              if(client->client->write(&((unsigned char *)tmp->data.ptr)[client->ptr], tmp->size) > 0) {
-#else
-              if(client->client->write(&((unsigned char *)tmp->data.fixed)[client->ptr], tmp->size) > 0) {
-#endif
-                if(client->is_websocket == 0) {
-                  client->lastseen = millis();
-                }
-              }
-            }
-          }
-          i += tmp->size;
-          client->ptr += tmp->size;
-          client->totallen -= tmp->size;
+}
 
-          if(tmp->type == 0) {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-            free(tmp->data.ptr);
-#else
-            memset(&tmp->data.fixed, 0, WEBSERVER_SENDLIST_BUFSIZE);
-#endif
-          }
+static void webserver_sendlist_pop(struct webserver_t *client) {
+  struct sendlist_t *tmp = webserver_sendlist_first(client);
+
+  if(tmp == NULL) {
+    return;
+  }
 
-          tmp->data.ptr = NULL;
 #if WEBSERVER_MAX_SENDLIST == 0
-          client->sendlist = client->sendlist->next;
-          free(tmp);
-          tmp = client->sendlist;
-#else
-          tmp = NULL;
-          for(y=x+1;y<WEBSERVER_MAX_SENDLIST;y++) {
-            if(
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-              client->sendlist[y].data.ptr != NULL
-#else
-              (client->sendlist[y].type == 1 && client->sendlist[y].data.ptr != NULL) ||
-              (client->sendlist[y].type == 0 && strlen((char *)client->sendlist[y].data.fixed) > 0)
-#endif
-            ) {
-              tmp = &client->sendlist[y];
-              x = y;
-              break;
-            }
-          }
-#endif
-          client->ptr = 0;
-        } else {
-          if(tmp->type == 1) {
-            memcpy_P(cpy, &((PGM_P)tmp->data.ptr)[client->ptr], client->totallen);
-            if(client->async == 1) {
-              tcp_write(client->pcb, cpy, client->totallen, TCP_WRITE_FLAG_MORE);
-            } else {
-              if(client->client->write(cpy, client->totallen) > 0) {
-                if(client->is_websocket == 0) {
-                  client->lastseen = millis();
-                }
-              }
-            }
-          } else {
-            if(client->async == 1) {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-              tcp_write(client->pcb, &((unsigned char *)tmp->data.ptr)[client->ptr], client->totallen, TCP_WRITE_FLAG_MORE);
-#else
-              tcp_write(client->pcb, &((unsigned char *)tmp->data.fixed)[client->ptr], client->totallen, TCP_WRITE_FLAG_MORE);
-#endif
-            } else {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-              if(client->client->write(&((unsigned char *)tmp->data.ptr)[client->ptr], client->totallen) > 0) {
+  client->sendlist = tmp->next;
+  if(client->sendlist == NULL) {
+    client->sendlist_head = NULL;
+  }
+  tmp->next = sendpool_free;
+  sendpool_free = tmp;
+  sendpool_used--;
 #else
-              if(client->client->write(&((unsigned char *)tmp->data.fixed)[client->ptr], client->totallen) > 0) {
-#endif
-                if(client->is_websocket == 0) {
-                  client->lastseen = millis();
-                }
-              }
-            }
-          }
-          i += client->totallen;
-          client->ptr += client->totallen;
-          client->totallen = 0;
-        }
-      } else if(client->ptr+client->totallen >= tmp->size) {
-        if(tmp->type == 1) {
-          memcpy_P(cpy, &((PGM_P)tmp->data.ptr)[client->ptr], (tmp->size-client->ptr));
-          if(client->async == 1) {
-            tcp_write(client->pcb, cpy, (tmp->size-client->ptr), TCP_WRITE_FLAG_MORE);
-          } else {
-            if(client->client->write(cpy, (tmp->size-client->ptr)) > 0) {
-              if(client->is_websocket == 0) {
-                client->lastseen = millis();
-              }
-            }
-          }
-        } else {
-          if(client->async == 1) {
+  if(tmp->type == 0) {
 #if WEBSERVER_SENDLIST_BUFSIZE == 0
-            tcp_write(client->pcb, &((unsigned char *)tmp->data.ptr)[client->ptr], (tmp->size-client->ptr), TCP_WRITE_FLAG_MORE);
-#else
-            tcp_write(client->pcb, &((unsigned char *)tmp->data.fixed)[client->ptr], (tmp->size-client->ptr), TCP_WRITE_FLAG_MORE);
+    free(tmp->data.ptr);
 #endif
-          } else {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-            if(client->client->write(&((unsigned char *)tmp->data.ptr)[client->ptr], (tmp->size-client->ptr)) > 0) {
-#else
-            if(client->client->write(&((unsigned char *)tmp->data.fixed)[client->ptr], (tmp->size-client->ptr)) > 0) {
+  }
+  memset(tmp, 0, sizeof(struct sendlist_t));
 #endif
-              if(client->is_websocket == 0) {
-                client->lastseen = millis();
-              }
-            }
-          }
-        }
-        i += (tmp->size-client->ptr);
-        client->totallen -= (tmp->size-client->ptr);
+}
 
-        if(tmp->type == 0) {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-            free(tmp->data.ptr);
-#else
-            memset(&tmp->data.fixed, 0, WEBSERVER_SENDLIST_BUFSIZE);
-#endif
-          }
+/*
+ * Copy as much queued content as fits in len bytes
+ * into buf, so it can go out in a single segment.
+ */
+static uint16_t webserver_sendlist_pack(struct webserver_t *client, unsigned char *buf, uint16_t len) {
+  struct sendlist_t *tmp = NULL;
+  uint16_t n = 0, x = 0;
 
-        tmp->data.ptr = NULL;
-#if WEBSERVER_MAX_SENDLIST == 0
-        client->sendlist = client->sendlist->next;
-        free(tmp);
-        tmp = client->sendlist;
-#else
-        tmp = NULL;
-        for(y=x+1;y<WEBSERVER_MAX_SENDLIST;y++) {
-          if(
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-            client->sendlist[y].data.ptr != NULL
-#else
-            (client->sendlist[y].type == 1 && client->sendlist[y].data.ptr != NULL) ||
-            (client->sendlist[y].type == 0 && strlen((char *)client->sendlist[y].data.fixed) > 0)
-#endif
-          ) {
-            tmp = &client->sendlist[y];
-            x = y;
-            break;
-          }
-        }
-#endif
-        client->ptr = 0;
-      } else {
-        if(tmp->type == 1) {
-          memcpy_P(cpy, &((PGM_P)tmp->data.ptr)[client->ptr], client->totallen);
-          if(client->async == 1) {
-            tcp_write(client->pcb, cpy, client->totallen, TCP_WRITE_FLAG_MORE);
-          } else {
-            if(client->client->write(cpy, client->totallen) > 0) {
-              if(client->is_websocket == 0) {
-                client->lastseen = millis();
-              }
-            }
-          }
-        } else {
-          if(client->async == 1) {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-            tcp_write(client->pcb, &((unsigned char *)tmp->data.ptr)[client->ptr], client->totallen, TCP_WRITE_FLAG_MORE);
-#else
-            tcp_write(client->pcb, &((unsigned char *)tmp->data.fixed)[client->ptr], client->totallen, TCP_WRITE_FLAG_MORE);
-#endif
-          } else {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-            if(client->client->write(&((unsigned char *)tmp->data.ptr)[client->ptr], client->totallen) > 0) {
+  while(n < len && (tmp = webserver_sendlist_first(client)) != NULL) {
+    x = MIN(tmp->size - client->ptr, len - n);
+    if(tmp->type == 1) {
+      memcpy_P(&buf[n], &((PGM_P)tmp->data.ptr)[client->ptr], x);
+    } else {
+#if WEBSERVER_MAX_SENDLIST > 0 && WEBSERVER_SENDLIST_BUFSIZE == 0
+      memcpy(&buf[n], &((unsigned char *)tmp->data.ptr)[client->ptr], x);
 #else
-            if(client->client->write(&((unsigned char *)tmp->data.fixed)[client->ptr], client->totallen) > 0) {
+      memcpy(&buf[n], &tmp->data.fixed[client->ptr], x);
 #endif
-              if(client->is_websocket == 0) {
-                client->lastseen = millis();
-              }
-            }
-          }
-        }
-        client->ptr += client->totallen;
-        client->totallen = 0;
-      }
     }
-    if(client->chunked == 1) {
-      if(client->async == 1) {
-        tcp_write_P(client->pcb, PSTR("\r\n"), 2, TCP_WRITE_FLAG_MORE);
-      } else {
-        if(client->client->write_P((char *)PSTR("\r\n"), 2) > 0) {
-          if(client->is_websocket == 0) {
-            client->lastseen = millis();
-          }
-        }
-      }
+    n += x;
+    client->ptr += x;
+
+    if(client->ptr == tmp->size) {
+      webserver_sendlist_pop(client);
+      client->ptr = 0;
     }
   }
+  return n;
+}
 
-  if(tmp == NULL) {
-#if WEBSERVER_MAX_SENDLIST > 0
-    uint8_t x = 0;
-    for(x=0;x<WEBSERVER_MAX_SENDLIST;x++) {
-      tmp = &client->sendlist[x];
-      if(tmp->type == 0) {
-        #if WEBSERVER_SENDLIST_BUFSIZE > 0
-          memset(&tmp->data.fixed, 0, WEBSERVER_SENDLIST_BUFSIZE+1);
-        #endif
+static void webserver_sendlist_write(struct webserver_t *client, unsigned char *buf, uint16_t len, uint8_t more) {
+  if(client->async == 1) {
+    tcp_write(client->pcb, buf, len, TCP_WRITE_FLAG_COPY | (more == 1 ? TCP_WRITE_FLAG_MORE : 0));
+  } else {
+    if(client->client->write(buf, len) > 0) {
+      if(client->is_websocket == 0) {
+        client->lastseen = millis();
       }
-      tmp->data.ptr = NULL;
-      memset(tmp, 0, sizeof(struct sendlist_t));
     }
-#endif
-    tmp = NULL;
+  }
+}
 
-    client->content++;
-    if(client->is_websocket == 1) {
-      client->step = WEBSERVER_CLIENT_WEBSOCKET;
-    } else {
-      client->step = WEBSERVER_CLIENT_WRITE;
+/*
+ * Room in front of the packed content for the
+ * chunk size, e.g. "5B4\r\n".
+ */
+#define WEBSERVER_CHUNK_HEADER 6
 
-      if(client->callback(client, NULL) == -1) {
-        client->step = WEBSERVER_CLIENT_CLOSE;
-      } else {
-        client->step = WEBSERVER_CLIENT_SENDING;
-      }
+/*
+ * Content is packed here before it is written,
+ * a segment at a time. With the chunk size in
+ * front, and room for the chunk terminator and
+ * the closing chunk after it. It is too large
+ * for the stack.
+ */
+static unsigned char sendbuf[WEBSERVER_CHUNK_HEADER+MTU_SIZE+7];
 
 #if WEBSERVER_MAX_SENDLIST == 0
-      tmp = client->sendlist;
-#else
-      for(x=0;x<WEBSERVER_MAX_SENDLIST;x++) {
-        if(
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
-          client->sendlist[x].data.ptr != NULL
+/*
+ * Content webserver_process_send packed in sendbuf,
+ * but did not write yet, while it asks the callback
+ * for more. It has to go out before anything the
+ * callback queued is flushed.
+ */
+static struct webserver_t *packed_client = NULL;
+static uint16_t *packed_len = NULL;
+
+/*
+ * Write len bytes of content that start at
+ * WEBSERVER_CHUNK_HEADER bytes into buf, as a
+ * chunk when the response is chunked. buf needs
+ * two more bytes for the chunk terminator.
+ */
+static void webserver_chunk_write(struct webserver_t *client, unsigned char *buf, uint16_t len) {
+  uint16_t start = WEBSERVER_CHUNK_HEADER;
+
+  if(client->chunked == 1) {
+    char chunk_size[WEBSERVER_CHUNK_HEADER+1];
+    uint8_t x = snprintf_P(chunk_size, sizeof(chunk_size), PSTR("%X\r\n"), len);
+    start -= x;
+    memcpy(&buf[start], chunk_size, x);
+    buf[WEBSERVER_CHUNK_HEADER+len++] = '\r';
+    buf[WEBSERVER_CHUNK_HEADER+len++] = '\n';
+  }
+  webserver_sendlist_write(client, &buf[start], len + (WEBSERVER_CHUNK_HEADER - start), 1);
+}
+
+/*
+ * Write out up to one segment of the content
+ * queued for a client.
+ */
+static uint8_t webserver_sendlist_flush(struct webserver_t *client) {
+  uint16_t len = MTU_SIZE;
+  if(client->async == 1) {
+    if((len = MIN(tcp_sndbuf(client->pcb), MTU_SIZE)) <= 16) {
+      return 0;
+    }
+  }
+  /*
+   * Writing the packed content also frees sendbuf
+   */
+  if(packed_client != NULL && *packed_len > 0) {
+    webserver_chunk_write(packed_client, sendbuf, *packed_len);
+    *packed_len = 0;
+    if(packed_client == client) {
+      return 1;
+    }
+  }
+
+  webserver_chunk_write(client, sendbuf, webserver_sendlist_pack(client, &sendbuf[WEBSERVER_CHUNK_HEADER], len - 16));
+  return 1;
+}
+#endif
+
+/*
+ * Whether the content callback of a client has to
+ * wait for free sendpool entries, see
+ * WEBSERVER_SENDPOOL_RESERVE. Content the client
+ * already queued is written out meanwhile, as the
+ * entries it holds can be the ones missing.
+ */
+static uint8_t webserver_sendpool_wait(struct webserver_t *client) {
+#if WEBSERVER_MAX_SENDLIST == 0
+  if((WEBSERVER_SENDPOOL_SIZE - sendpool_used) >= WEBSERVER_SENDPOOL_RESERVE) {
+    return 0;
+  }
+  if(client->sendlist != NULL) {
+    webserver_sendlist_flush(client);
+  }
+  return 1;
 #else
-          (client->sendlist[x].type == 1 && client->sendlist[x].data.ptr != NULL) ||
-          (client->sendlist[x].type == 0 && strlen((char *)client->sendlist[x].data.fixed) > 0)
+  return 0;
 #endif
-        ) {
-          tmp = &client->sendlist[x];
-          break;
-        }
+}
+
+static int webserver_process_send(struct webserver_t *client) {
+  uint16_t len = MIN(client->totallen, MTU_SIZE), n = 0, start = WEBSERVER_CHUNK_HEADER;
+  uint8_t done = 0;
+  unsigned char *p = &sendbuf[WEBSERVER_CHUNK_HEADER];
+
+  if(client->is_websocket == 1 || client->is_eventstream == 1) {
+    n = webserver_queue_pack(client, p, len);
+    if(client->queuelen == 0) {
+      if(client->is_websocket == 1) {
+        client->step = WEBSERVER_CLIENT_WEBSOCKET;
+      } else {
+        client->step = WEBSERVER_CLIENT_EVENTSTREAM;
       }
+    }
+    /*
+     * An event stream client never sends anything,
+     * so it only times out when it stops reading.
+     */
+    if(client->is_eventstream == 1 && n > 0) {
+      client->lastseen = millis();
+    }
+  } else {
+    n = webserver_sendlist_pack(client, p, len);
+  }
+
+  /*
+   * Keep asking for the next part of the response
+   * as long as it still fits in the same segment.
+   */
+  while(client->is_websocket == 0 && client->is_eventstream == 0 && webserver_sendlist_first(client) == NULL) {
+    /*
+     * Wait for other clients to free sendpool
+     * entries, the callback is asked again on
+     * the next run.
+     */
+    if(webserver_sendpool_wait(client) == 1) {
+      break;
+    }
+    client->content++;
+    client->step = WEBSERVER_CLIENT_WRITE;
+#if WEBSERVER_MAX_SENDLIST == 0
+    packed_client = client;
+    packed_len = &n;
 #endif
-      if(tmp == NULL) {
-        if(client->chunked == 1) {
-          if(client->async == 1) {
-            tcp_write_P(client->pcb, PSTR("0\r\n\r\n"), 5, 0);
-          } else {
-            if(client->client->write_P((char *)PSTR("0\r\n\r\n"), 5) > 0) {
-              if(client->is_websocket == 0) {
-                client->lastseen = millis();
-              }
-            }
-          }
-          i += 5;
-        } else {
-          if(client->async == 1) {
-            tcp_write_P(client->pcb, PSTR("\r\n\r\n"), 4, 0);
-          } else {
-            if(client->client->write_P((char *)PSTR("\r\n\r\n"), 4) > 0) {
-              if(client->is_websocket == 0) {
-                client->lastseen = millis();
-              }
-            }
-          }
-          i += 4;
-        }
-        client->step = WEBSERVER_CLIENT_CLOSE;
-        client->userdata = NULL;
-        client->ptr = 0;
-        client->content = 0;
-      }
+    if(client->callback(client, NULL) == -1 || client->aborted == 1) {
+      client->step = WEBSERVER_CLIENT_CLOSE;
+    } else {
+      client->step = WEBSERVER_CLIENT_SENDING;
+    }
+#if WEBSERVER_MAX_SENDLIST == 0
+    packed_client = NULL;
+#endif
+
+    if(webserver_sendlist_first(client) == NULL) {
+      done = 1;
+      break;
+    }
+    if(client->step == WEBSERVER_CLIENT_CLOSE || n == len) {
+      break;
+    }
+    n += webserver_sendlist_pack(client, &p[n], len - n);
+  }
+
+  /*
+   * Queued events already are complete chunks
+   */
+  if(client->chunked == 1 && client->is_eventstream == 0) {
+    if(n > 0) {
+      char chunk_size[WEBSERVER_CHUNK_HEADER+1];
+      uint8_t x = snprintf_P(chunk_size, sizeof(chunk_size), PSTR("%X\r\n"), n);
+      start -= x;
+      memcpy(&sendbuf[start], chunk_size, x);
+      p[n++] = '\r';
+      p[n++] = '\n';
+    }
+    if(done == 1) {
+      memcpy_P(&p[n], PSTR("0\r\n\r\n"), 5);
+      n += 5;
+    }
+  }
+
+  n += WEBSERVER_CHUNK_HEADER - start;
+  if(n > 0) {
+    webserver_sendlist_write(client, &sendbuf[start], n, done == 0);
+  }
+
+  if(done == 1) {
+    if(client->step == WEBSERVER_CLIENT_CLOSE) {
+      client->keepalive = 0;
+    }
+    client->step = WEBSERVER_CLIENT_CLOSE;
+    client->userdata = NULL;
+    client->ptr = 0;
+    client->content = 0;
+    if(client->keepalive == 1) {
+      webserver_next_request(client);
     }
   }
+
   if(client->async == 1) {
     tcp_output(client->pcb);
   }
 
-  return i;
+  return n;
 }
 
-void webserver_send_content_P(struct webserver_t *client, PGM_P buf, uint16_t size) {
+#if WEBSERVER_MAX_SENDLIST == 0
+/*
+ * Get a free sendlist entry. When the pool is empty
+ * the content already queued for this client is
+ * written out first to make room.
+ */
+static struct sendlist_t *webserver_sendlist_get(struct webserver_t *client) {
   struct sendlist_t *node = NULL;
 
-#if WEBSERVER_MAX_SENDLIST == 0
-  node = (struct sendlist_t *)malloc(sizeof(struct sendlist_t));
-  /*LCOV_EXCL_START*/
+  while((node = webserver_sendpool_get()) == NULL && client->sendlist != NULL) {
+    if(webserver_sendlist_flush(client) == 0) {
+      break;
+    }
+  }
+
+  /*
+   * Leaving out the content would corrupt the
+   * response, so it is aborted instead.
+   */
   if(node == NULL) {
   #ifdef ESP8266
-    Serial1.printf(PSTR("Out of memory %s:#%d\n"), __FUNCTION__, __LINE__);
-    ESP.restart();
-    exit(-1);
+    log_message(F("Sendlist queue is full"));
+  #else
+    printf("Sendlist queue is full\n");
   #endif
+    client->aborted = 1;
+  }
+  return node;
+}
+
+static void webserver_sendlist_add(struct webserver_t *client, struct sendlist_t *node) {
+  if(client->sendlist == NULL) {
+    client->sendlist = node;
+    client->sendlist_head = node;
+  } else {
+    client->sendlist_head->next = node;
+    client->sendlist_head = node;
+  }
+}
+#endif
+
+void webserver_send_content_P(struct webserver_t *client, PGM_P buf, uint16_t size) {
+  struct sendlist_t *node = NULL;
+
+#if WEBSERVER_MAX_SENDLIST == 0
+  if(size == 0 || (node = webserver_sendlist_get(client)) == NULL) {
+    return;
   }
+  /*
+   * PROGMEM content is referenced and
+   * only copied when it is being sent
+   */
+  node->data.ptr = (void *)buf;
+  node->size = size;
+  node->type = 1;
+
+  webserver_sendlist_add(client, node);
 #else
   uint8_t i = 0;
   for(i=0;i<WEBSERVER_MAX_SENDLIST;i++) {
@@ -1666,28 +1695,16 @@ void webserver_send_content_P(struct webserver_t *client, PGM_P buf, uint16_t si
   }
   if(node == NULL) {
   #ifdef ESP8266
-    log_message(PSTR("Sendlist queue is full"));
+    log_message(F("Sendlist queue is full"));
   #else
     printf("Sendlist queue is full\n");
   #endif
     return;
   }
-#endif
-
-  /*LCOV_EXCL_STOP*/
   memset(node, 0, sizeof(struct sendlist_t));
   node->data.ptr = (void *)buf;
   node->size = size;
   node->type = 1;
-
-#if WEBSERVER_MAX_SENDLIST == 0
-  if(client->sendlist == NULL) {
-    client->sendlist = node;
-    client->sendlist_head = node;
-  } else {
-    client->sendlist_head->next = node;
-    client->sendlist_head = node;
-  }
 #endif
 }
 
@@ -1695,14 +1712,26 @@ void webserver_send_content(struct webserver_t *client, char *buf, uint16_t size
   struct sendlist_t *node = NULL;
 
 #if WEBSERVER_MAX_SENDLIST == 0
-  node = (struct sendlist_t *)malloc(sizeof(struct sendlist_t));
-  /*LCOV_EXCL_START*/
-  if(node == NULL) {
-  #ifdef ESP8266
-    Serial1.printf(PSTR("Out of memory %s:#%d\n"), __FUNCTION__, __LINE__);
-    ESP.restart();
-    exit(-1);
-  #endif
+  uint16_t x = 0;
+
+  /*
+   * Small fragments are packed together
+   * in the last entry while it has room
+   */
+  while(size > 0) {
+    node = client->sendlist_head;
+    if(node == NULL || node->type == 1 || node->size == WEBSERVER_SENDPOOL_BUFSIZE) {
+      if((node = webserver_sendlist_get(client)) == NULL) {
+        return;
+      }
+      node->type = 0;
+      webserver_sendlist_add(client, node);
+    }
+    x = MIN(WEBSERVER_SENDPOOL_BUFSIZE - node->size, size);
+    memcpy(&node->data.fixed[node->size], buf, x);
+    node->size += x;
+    buf += x;
+    size -= x;
   }
 #else
   uint8_t i = 0;
@@ -1721,13 +1750,12 @@ void webserver_send_content(struct webserver_t *client, char *buf, uint16_t size
   }
   if(node == NULL) {
   #ifdef ESP8266
-    log_message(PSTR("Sendlist queue is full"));
+    log_message(F("Sendlist queue is full"));
   #else
     printf("Sendlist queue is full\n");
   #endif
     return;
   }
-#endif
   memset(node, 0, sizeof(struct sendlist_t));
 #if WEBSERVER_SENDLIST_BUFSIZE > 0
   int x = 0;
@@ -1747,15 +1775,6 @@ void webserver_send_content(struct webserver_t *client, char *buf, uint16_t size
 
   node->size = size;
   node->type = 0;
-
-#if WEBSERVER_MAX_SENDLIST == 0
-  if(client->sendlist == NULL) {
-    client->sendlist = node;
-    client->sendlist_head = node;
-  } else {
-    client->sendlist_head->next = node;
-    client->sendlist_head = node;
-  }
 #endif
 }
 
@@ -1774,15 +1793,13 @@ int8_t webserver_send(struct webserver_t *client, uint16_t code, char *mimetype,
       header.ptr = i;
 
       if(client->callback(client, &header) == -1) {
-        if(strstr_P((char *)&p[i], PSTR("\r\n\r\n")) == NULL) {
-          if(strstr_P((char *)&p[i], PSTR("\r\n")) != NULL) {
-            header.ptr += snprintf((char *)&p[header.ptr], sizeof(buffer)-header.ptr, PSTR("\r\n"));
-          } else {
-            header.ptr += snprintf((char *)&p[header.ptr], sizeof(buffer)-header.ptr, PSTR("\r\n\r\n"));
-          }
-        }
+        /*
+         * A complete custom header has no
+         * chunked body
+         */
+        i = webserver_finish_header(client, p, header.ptr, sizeof(buffer), code, 0);
+        client->chunked = 0;
         client->step = WEBSERVER_CLIENT_WRITE;
-        i = header.ptr;
         goto done;
       }
       if(header.ptr > i && strstr_P((char *)&p[i], PSTR("\r\n")) == NULL) {
@@ -1792,7 +1809,7 @@ int8_t webserver_send(struct webserver_t *client, uint16_t code, char *mimetype,
       client->step = WEBSERVER_CLIENT_WRITE;
     }
 
-    i += snprintf((char *)&p[i], sizeof(buffer)-i, PSTR("Keep-Alive: timeout=15, max=100\r\n"));
+    i += webserver_connection_header(client, &p[i], sizeof(buffer)-i);
     i += snprintf((char *)&p[i], sizeof(buffer)-i, PSTR("Content-Type: %s\r\n"), mimetype);
     i += snprintf((char *)&p[i], sizeof(buffer)-i, PSTR("Transfer-Encoding: chunked\r\n\r\n"));
 
@@ -1848,8 +1865,8 @@ err_t webserver_sent(void *arg, tcp_pcb *pcb, uint16_t len) {
   uint16_t i = 0;
   for(i=0;i<WEBSERVER_MAX_CLIENTS;i++) {
     if(clients[i].data.pcb == pcb) {
-      if(clients[i].data.step == WEBSERVER_CLIENT_WRITE) {
-        if(clients[i].data.callback(&clients[i].data, NULL) == -1) {
+      if(clients[i].data.step == WEBSERVER_CLIENT_WRITE && webserver_sendpool_wait(&clients[i].data) == 0) {
+        if(clients[i].data.callback(&clients[i].data, NULL) == -1 || clients[i].data.aborted == 1) {
           clients[i].data.step = WEBSERVER_CLIENT_CLOSE;
         } else {
           clients[i].data.step = WEBSERVER_CLIENT_SENDING;
@@ -1877,7 +1894,7 @@ err_t webserver_sent(void *arg, tcp_pcb *pcb, uint16_t len) {
 static void send_websocket_handshake(struct webserver_t *client, const char *key) {
   char cpy[61] = { 0 };
   char input[20] = { 0 };
-  char encoded[20] = { 0 };
+  char encoded[29] = { 0 };
 
   const char *magic = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
 
@@ -1913,16 +1930,318 @@ static void send_websocket_handshake(struct webserver_t *client, const char *key
   }
 }
 
+static uint32_t webserver_dropped_frames = 0;
+static uint16_t webserver_queue_max = 0;
+
+uint32_t webserver_dropped(void) {
+  return webserver_dropped_frames;
+}
+
+/*
+ * Most bytes queued for a single client
+ */
+uint16_t webserver_queue_peak(void) {
+  return webserver_queue_max;
+}
+
+static uint8_t websocket_frame_header(unsigned char *buf, uint8_t opcode, uint16_t data_len) {
+  uint8_t index = 2;
+
+  buf[0] = 0x80 + (opcode & 0x0f);
+  if(data_len <= 125) {
+    buf[1] = data_len;
+  } else {
+    /*
+     * 64 bit lengths are too big for ESP8266
+     */
+    buf[1] = 126;
+    buf[2] = (data_len >> 8) & 255;
+    buf[3] = (data_len) & 255;
+    index = 4;
+  }
+  return index;
+}
+
+static void webserver_queue_put(struct webserver_t *client, const unsigned char *buf, uint16_t len, uint8_t progmem) {
+  uint16_t tail = (client->queuehead + client->queuelen) % WEBSERVER_QUEUE_SIZE;
+  uint16_t x = MIN(len, WEBSERVER_QUEUE_SIZE - tail);
+
+  if(progmem == 1) {
+    memcpy_P(&client->queue[tail], buf, x);
+    memcpy_P(client->queue, &buf[x], len - x);
+  } else {
+    memcpy(&client->queue[tail], buf, x);
+    memcpy(client->queue, &buf[x], len - x);
+  }
+  client->queuelen += len;
+  if(client->queuelen > webserver_queue_max) {
+    webserver_queue_max = client->queuelen;
+  }
+}
+
+static void webserver_queue_get(struct webserver_t *client, unsigned char *buf, uint16_t len) {
+  uint16_t x = MIN(len, WEBSERVER_QUEUE_SIZE - client->queuehead);
+
+  memcpy(buf, &client->queue[client->queuehead], x);
+  memcpy(&buf[x], client->queue, len - x);
+  client->queuehead = (client->queuehead + len) % WEBSERVER_QUEUE_SIZE;
+  client->queuelen -= len;
+}
+
+/*
+ * Drop the oldest frame that has not been partly
+ * sent yet. Each frame is stored behind its length.
+ */
+static uint8_t webserver_queue_drop(struct webserver_t *client) {
+  uint16_t pos = (client->queuehead + client->queueframe) % WEBSERVER_QUEUE_SIZE;
+  uint16_t len = 0, k = 0;
+
+  if(client->queuelen <= client->queueframe) {
+    return 0;
+  }
+  len = 2 + (client->queue[pos] | (client->queue[(pos + 1) % WEBSERVER_QUEUE_SIZE] << 8));
+
+  /*
+   * Move the rest of the frame being
+   * sent over the dropped one
+   */
+  for(k=client->queueframe;k>0;k--) {
+    client->queue[(client->queuehead + len + k - 1) % WEBSERVER_QUEUE_SIZE] =
+      client->queue[(client->queuehead + k - 1) % WEBSERVER_QUEUE_SIZE];
+  }
+  client->queuehead = (client->queuehead + len) % WEBSERVER_QUEUE_SIZE;
+  client->queuelen -= len;
+  return 1;
+}
+
+/*
+ * Make room for a frame of len bytes, following
+ * WEBSERVER_QUEUE_POLICY when the queue is full.
+ */
+static uint8_t webserver_queue_room(struct webserver_t *client, uint16_t len) {
+  if(client->queue == NULL) {
+    if((client->queue = (unsigned char *)malloc(WEBSERVER_QUEUE_SIZE)) == NULL) {
+#ifdef ESP8266
+      Serial1.printf(PSTR("Out of memory %s:#%d\n"), __FUNCTION__, __LINE__);
+      ESP.restart();
+      exit(-1);
+#endif
+    }
+    client->queuehead = 0;
+    client->queuelen = 0;
+    client->queueframe = 0;
+  }
+
+#if WEBSERVER_QUEUE_POLICY == WEBSERVER_DROP_NEWEST
+  webserver_queue_notice(client);
+#endif
+
+  while(WEBSERVER_QUEUE_SIZE - client->queuelen < len + 2) {
+#if WEBSERVER_QUEUE_POLICY == WEBSERVER_DROP_OLDEST
+    if(len + 2 <= WEBSERVER_QUEUE_SIZE && webserver_queue_drop(client) == 1) {
+      client->dropped++;
+      webserver_dropped_frames++;
+      continue;
+    }
+#elif WEBSERVER_QUEUE_POLICY == WEBSERVER_DISCONNECT
+    client->step = WEBSERVER_CLIENT_CLOSE;
+#endif
+    client->dropped++;
+    webserver_dropped_frames++;
+    return 0;
+  }
+  return 1;
+}
+
+static void webserver_queue_length(struct webserver_t *client, uint16_t len) {
+  unsigned char size[2];
+
+  size[0] = len & 255;
+  size[1] = (len >> 8) & 255;
+  webserver_queue_put(client, size, 2, 0);
+}
+
+static void webserver_queue_sending(struct webserver_t *client) {
+  if(client->step == WEBSERVER_CLIENT_WEBSOCKET || client->step == WEBSERVER_CLIENT_EVENTSTREAM) {
+    client->step = WEBSERVER_CLIENT_SENDING;
+  }
+}
+
+static void websocket_queue_frame(struct webserver_t *client, uint8_t opcode, const unsigned char *data, uint16_t data_len, uint8_t progmem) {
+  unsigned char header[4];
+  uint8_t index = websocket_frame_header(header, opcode, data_len);
+
+  webserver_queue_length(client, index + data_len);
+  webserver_queue_put(client, header, index, 0);
+  if(data_len > 0) {
+    webserver_queue_put(client, data, data_len, progmem);
+  }
+}
+
+/*
+ * An event is sent as a single chunk:
+ * "<size>\r\nevent: <event>\ndata: <data>\n\n\r\n"
+ */
+static uint16_t webserver_event_length(const char *event, uint16_t len, uint16_t *body) {
+  uint8_t digits = 1;
+
+  *body = 7 + strlen(event) + 7 + len + 2;
+  while((*body >> (4 * digits)) > 0) {
+    digits++;
+  }
+  return digits + 2 + *body + 2;
+}
+
+static void webserver_event_frame(struct webserver_t *client, const char *event, const unsigned char *data, uint16_t len) {
+  char head[40];
+  uint16_t body = 0, tail = 0, i = 0;
+
+  webserver_queue_length(client, webserver_event_length(event, len, &body));
+  i = snprintf_P(head, sizeof(head), PSTR("%X\r\nevent: %s\ndata: "), body, event);
+  webserver_queue_put(client, (unsigned char *)head, i, 0);
+
+  /*
+   * A newline would end the data field
+   */
+  tail = (client->queuehead + client->queuelen) % WEBSERVER_QUEUE_SIZE;
+  webserver_queue_put(client, data, len, 0);
+  for(i=0;i<len;i++) {
+    if(client->queue[(tail + i) % WEBSERVER_QUEUE_SIZE] == '\n' || client->queue[(tail + i) % WEBSERVER_QUEUE_SIZE] == '\r') {
+      client->queue[(tail + i) % WEBSERVER_QUEUE_SIZE] = ' ';
+    }
+  }
+  webserver_queue_put(client, (unsigned char *)PSTR("\n\n\r\n"), 4, 1);
+}
+
+/*
+ * Tell the client how many frames it missed. With
+ * WEBSERVER_DROP_NEWEST this is done in front of the first
+ * frame that fits again, otherwise once the queue has
+ * been sent, so the notice itself isn't dropped again.
+ */
+static void webserver_queue_notice(struct webserver_t *client) {
+  char msg[24];
+  uint16_t len = 0, body = 0;
+
+  if(client->dropped == 0 || client->queue == NULL) {
+    return;
+  }
+  if(client->is_eventstream == 1) {
+    len = snprintf_P(msg, sizeof(msg), PSTR("%u"), client->dropped);
+    if(WEBSERVER_QUEUE_SIZE - client->queuelen >= webserver_event_length("dropped", len, &body) + 2) {
+      webserver_event_frame(client, "dropped", (unsigned char *)msg, len);
+      client->dropped = 0;
+    }
+  } else {
+    len = snprintf_P(msg, sizeof(msg), PSTR("{\"dropped\":%u}"), client->dropped);
+    if(WEBSERVER_QUEUE_SIZE - client->queuelen >= len + 4) {
+      websocket_queue_frame(client, WEBSOCKET_OPCODE_TEXT, (unsigned char *)msg, len, 0);
+      client->dropped = 0;
+    }
+  }
+}
+
+static void websocket_queue(struct webserver_t *client, uint8_t opcode, const unsigned char *data, uint16_t data_len, uint8_t progmem) {
+  if(webserver_queue_room(client, (data_len <= 125 ? 2 : 4) + data_len) == 1) {
+    websocket_queue_frame(client, opcode, data, data_len, progmem);
+    webserver_queue_sending(client);
+  }
+}
+
+static void webserver_event_queue(struct webserver_t *client, const char *event, const unsigned char *data, uint16_t len) {
+  uint16_t body = 0;
+
+  if(webserver_queue_room(client, webserver_event_length(event, len, &body)) == 1) {
+    webserver_event_frame(client, event, data, len);
+    webserver_queue_sending(client);
+  }
+}
+
+/*
+ * Copy as much of the queued frames
+ * as fits in len bytes into buf.
+ */
+static uint16_t webserver_queue_pack(struct webserver_t *client, unsigned char *buf, uint16_t len) {
+  unsigned char size[2];
+  uint16_t n = 0, x = 0;
+
+  while(n < len && client->queuelen > 0) {
+    if(client->queueframe == 0) {
+      webserver_queue_get(client, size, 2);
+      client->queueframe = size[0] | (size[1] << 8);
+    }
+    x = MIN(client->queueframe, len - n);
+    webserver_queue_get(client, &buf[n], x);
+    client->queueframe -= x;
+    n += x;
+  }
+  if(client->queuelen == 0) {
+    webserver_queue_notice(client);
+  }
+  return n;
+}
+
+static void websocket_send_control(struct webserver_t *client, uint8_t opcode) {
+  websocket_queue(client, opcode, NULL, 0, 0);
+}
+
+/*
+ * Turn the current response into an event stream. Should
+ * be called right before sending the headers of a chunked
+ * text/event-stream response, so the connection isn't
+ * offered for keep-alive. Only events of the types set
+ * in client->events are sent, all when none are set.
+ */
+void webserver_events_start(struct webserver_t *client) {
+  client->is_eventstream = 1;
+  client->keepalive = 0;
+  client->lastping = millis();
+  if(client->events == 0) {
+    client->events = 0xFF;
+  }
+}
+
+static void webserver_events_ping(struct webserver_t *client) {
+  if(webserver_queue_room(client, 13) == 1) {
+    webserver_queue_length(client, 13);
+    webserver_queue_put(client, (unsigned char *)PSTR("8\r\n: ping\n\n\r\n"), 13, 1);
+    webserver_queue_sending(client);
+  }
+}
+
+void webserver_events_all(uint8_t type, PGM_P event, char *data, uint16_t len) {
+  char name[16];
+  uint8_t i = 0;
+
+  strncpy_P(name, event, sizeof(name) - 1);
+  name[sizeof(name) - 1] = 0;
+
+  for(i=0;i<WEBSERVER_MAX_CLIENTS;i++) {
+    if(clients[i].data.is_eventstream == 1 && (clients[i].data.events & type) != 0 &&
+       clients[i].data.step != WEBSERVER_CLIENT_CLOSE) {
+      webserver_event_queue(&clients[i].data, name, (unsigned char *)data, len);
+    }
+  }
+}
+
+uint8_t webserver_events_wanted(uint8_t type) {
+  uint8_t i = 0;
+
+  for(i=0;i<WEBSERVER_MAX_CLIENTS;i++) {
+    if(clients[i].data.is_eventstream == 1 && (clients[i].data.events & type) != 0 &&
+       clients[i].data.step != WEBSERVER_CLIENT_CLOSE) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
 void websocket_write_P(struct webserver_t *client, PGM_P data, uint16_t data_len) {
-  websocket_send_header(client, WEBSOCKET_OPCODE_TEXT, data_len);
-  webserver_send_content_P(client, data, data_len);
-  client->step = WEBSERVER_CLIENT_SENDING;
+  websocket_queue(client, WEBSOCKET_OPCODE_TEXT, (const unsigned char *)data, data_len, 1);
 }
 
 void websocket_write(struct webserver_t *client, char *data, uint16_t data_len) {
-  websocket_send_header(client, WEBSOCKET_OPCODE_TEXT, data_len);
-  webserver_send_content(client, (char *)data, data_len);
-  client->step = WEBSERVER_CLIENT_SENDING;
+  websocket_queue(client, WEBSOCKET_OPCODE_TEXT, (const unsigned char *)data, data_len, 0);
 }
 
 void websocket_write_all(char *data, uint16_t data_len) {
@@ -1934,46 +2253,32 @@ void websocket_write_all(char *data, uint16_t data_len) {
   }
 }
 
-void websocket_write_all_P(PGM_P data, uint16_t data_len) {
+void websocket_write_all_binary(unsigned char *data, uint16_t data_len) {
   uint8_t i = 0;
   for(i=0;i<WEBSERVER_MAX_CLIENTS;i++) {
     if(clients[i].data.is_websocket == 1 && clients[i].data.step != WEBSERVER_CLIENT_CLOSE) {
-      websocket_write_P(&clients[i].data, data, data_len);
+      websocket_queue(&clients[i].data, WEBSOCKET_OPCODE_BINARY, data, data_len, 0);
     }
   }
 }
 
-void websocket_send_header(struct webserver_t *client, uint8_t opcode, uint16_t data_len) {
-  unsigned char copy[10];
-  int index = 2;
-  memset(&copy, 0, 10);
+uint8_t websocket_clients(void) {
+  uint8_t i = 0, nr = 0;
+  for(i=0;i<WEBSERVER_MAX_CLIENTS;i++) {
+    if(clients[i].data.is_websocket == 1 && clients[i].data.step != WEBSERVER_CLIENT_CLOSE) {
+      nr++;
+    }
+  }
+  return nr;
+}
 
-  copy[0] = 0x80 + (opcode & 0x0f);
-  if(data_len <= 125) {
-    copy[1] = data_len;
-  } else if(data_len < 65535) {
-    copy[1] = 126;
-    copy[2] = (data_len >> 8) & 255;
-    copy[3] = (data_len) & 255;
-    index = 4;
-  } else {
-    /**
-     * Size too big for ESP8266
-     */
-    /*
-      copy[1] = 127;
-      copy[2] = (data_len >> 56) & 255;
-      copy[3] = (data_len >> 48) & 255;
-      copy[4] = (data_len >> 40) & 255;
-      copy[5] = (data_len >> 32) & 255;
-      copy[6] = (data_len >> 24) & 255;
-      copy[7] = (data_len >> 16) & 255;
-      copy[8] = (data_len >> 8) & 255;
-      copy[9] = (data_len) & 255;
-      index = 10;
-     */
+void websocket_write_all_P(PGM_P data, uint16_t data_len) {
+  uint8_t i = 0;
+  for(i=0;i<WEBSERVER_MAX_CLIENTS;i++) {
+    if(clients[i].data.is_websocket == 1 && clients[i].data.step != WEBSERVER_CLIENT_CLOSE) {
+      websocket_write_P(&clients[i].data, data, data_len);
+    }
   }
-  webserver_send_content(client, (char *)copy, index);
 }
 
 int websocket_read(struct webserver_t *client, unsigned char *buf, ssize_t buf_len) {
@@ -2015,10 +2320,10 @@ int websocket_read(struct webserver_t *client, unsigned char *buf, ssize_t buf_l
       client->lastseen = millis();
     } break;
     case WEBSOCKET_OPCODE_PING: {
-      websocket_send_header(client, WEBSOCKET_OPCODE_PONG, 0);
+      websocket_send_control(client, WEBSOCKET_OPCODE_PONG);
     } break;
     case WEBSOCKET_OPCODE_CONNECTION_CLOSE:
-      websocket_send_header(client, WEBSOCKET_OPCODE_CONNECTION_CLOSE, 0);
+      websocket_send_control(client, WEBSOCKET_OPCODE_CONNECTION_CLOSE);
       client->step = WEBSERVER_CLIENT_CLOSE;
       return -1;
     break;
@@ -2060,6 +2365,8 @@ uint8_t webserver_sync_receive(struct webserver_t *client, uint8_t *rbuffer, uin
           }
          } else if(client->reqtype == 1) {
           client->substep = 0;
+          client->matched = 0;
+          client->scanned = 0;
           if(http_parse_multipart_body(client, (unsigned char *)rbuffer, size) == -1) {
             client->step = WEBSERVER_CLIENT_CLOSE;
           }
@@ -2074,6 +2381,23 @@ uint8_t webserver_sync_receive(struct webserver_t *client, uint8_t *rbuffer, uin
         }
       } else if(client->step != WEBSERVER_CLIENT_WEBSOCKET) {
         client->step = WEBSERVER_CLIENT_WRITE;
+        /*
+         * Keep any pipelined request until
+         * this one has been answered.
+         */
+        if(client->keepalive == 1 && client->ptr+size > 0) {
+          if((client->pipeline = (unsigned char *)malloc(client->ptr+size)) == NULL) {
+#ifdef ESP8266
+            Serial1.printf(PSTR("Out of memory %s:#%d\n"), __FUNCTION__, __LINE__);
+            ESP.restart();
+            exit(-1);
+#endif
+          }
+          memcpy(client->pipeline, client->buffer, client->ptr);
+          memcpy(&client->pipeline[client->ptr], rbuffer, size);
+          client->pipelinelen = client->ptr+size;
+        }
+        client->ptr = 0;
       }
     }
   }
@@ -2158,6 +2482,19 @@ err_t webserver_async_receive(void *arg, tcp_pcb *pcb, struct pbuf *data, err_t
   return ERR_OK;
 }
 
+/*
+ * A keep-alive connection waiting too long
+ * for its next request.
+ */
+static uint8_t webserver_client_idle(struct webserver_t *client) {
+  if(client->requests > 0 && client->step == WEBSERVER_CLIENT_READ_HEADER &&
+     client->substep == 0 && client->ptr == 0 &&
+     (unsigned long)(millis() - client->lastseen) > WEBSERVER_KEEPALIVE_TIMEOUT) {
+    return 1;
+  }
+  return 0;
+}
+
 #ifdef ESP8266
 err_t webserver_poll(void *arg, struct tcp_pcb *pcb) {
   uint8_t i = 0;
@@ -2165,7 +2502,13 @@ err_t webserver_poll(void *arg, struct tcp_pcb *pcb) {
     if(clients[i].data.pcb == pcb) {
       if(clients[i].data.is_websocket == 1) {
         if((unsigned long)(millis() - clients[i].data.lastping) > WEBSERVER_CLIENT_PING_INTERVAL) {
-          websocket_send_header(&clients[i].data, WEBSOCKET_OPCODE_PING, 0);
+          websocket_send_control(&clients[i].data, WEBSOCKET_OPCODE_PING);
+          clients[i].data.lastping = millis();
+        }
+      }
+      if(clients[i].data.is_eventstream == 1) {
+        if((unsigned long)(millis() - clients[i].data.lastping) > WEBSERVER_CLIENT_PING_INTERVAL) {
+          webserver_events_ping(&clients[i].data);
           clients[i].data.lastping = millis();
         }
       }
@@ -2177,6 +2520,18 @@ err_t webserver_poll(void *arg, struct tcp_pcb *pcb) {
   #endif
         clients[i].data.step = WEBSERVER_CLIENT_CLOSE;
         webserver_client_close(&clients[i].data);
+      } else if(webserver_client_idle(&clients[i].data) == 1) {
+        clients[i].data.step = WEBSERVER_CLIENT_CLOSE;
+        webserver_client_close(&clients[i].data);
+      } else if((clients[i].data.step == WEBSERVER_CLIENT_WRITE || clients[i].data.step == WEBSERVER_CLIENT_SENDING) &&
+                clients[i].data.is_websocket == 0 && clients[i].data.is_eventstream == 0 &&
+                webserver_sendlist_first(&clients[i].data) == NULL) {
+        /*
+         * A response waiting for sendpool room has
+         * nothing in flight, so no sent callback
+         * will continue it.
+         */
+        webserver_sent(arg, pcb, 0);
       }
       break;
     }
@@ -2205,6 +2560,8 @@ void webserver_reset_client(struct webserver_t *client) {
   client->totallen = 0;
   client->step = 0;
   client->substep = 0;
+  client->matched = 0;
+  client->scanned = 0;
   client->chunked = 0;
   client->ptr = 0;
   client->route = 0;
@@ -2212,24 +2569,34 @@ void webserver_reset_client(struct webserver_t *client) {
   client->lastping = 0;
   client->content = 0;
   client->is_websocket = 0;
+  client->is_eventstream = 0;
+  client->aborted = 0;
+  client->events = 0;
+  client->keepalive = 0;
+  client->requests = 0;
   client->userdata = NULL;
 
-  struct sendlist_t *tmp = NULL;
+  if(client->pipeline != NULL) {
+    free(client->pipeline);
+    client->pipeline = NULL;
+  }
+  client->pipelinelen = 0;
+
+  if(client->queue != NULL) {
+    free(client->queue);
+    client->queue = NULL;
+  }
+  client->queuehead = 0;
+  client->queuelen = 0;
+  client->queueframe = 0;
+  client->dropped = 0;
+
 #if WEBSERVER_MAX_SENDLIST == 0
   while(client->sendlist) {
-    tmp = client->sendlist;
-    client->sendlist = client->sendlist->next;
-    if(tmp->type == 0) {
-      #if WEBSERVER_SENDLIST_BUFSIZE == 0
-        free(tmp->data.ptr);
-      #else
-        memset(&tmp->data.fixed, 0, WEBSERVER_SENDLIST_BUFSIZE);
-      #endif
-    }
-    tmp->data.ptr = NULL;
-    free(tmp);
+    webserver_sendlist_pop(client);
   }
 #else
+  struct sendlist_t *tmp = NULL;
   uint8_t i = 0;
   for(i=0;i<WEBSERVER_MAX_SENDLIST;i++) {
     tmp = &client->sendlist[i];
@@ -2261,6 +2628,49 @@ void webserver_reset_client(struct webserver_t *client) {
   memset(&client->buffer, 0, WEBSERVER_BUFFER_SIZE);
 }
 
+/*
+ * Prepare a keep-alive connection for its next
+ * request, after the previous one was answered.
+ */
+static void webserver_next_request(struct webserver_t *client) {
+  if(client->callback != NULL) {
+    client->callback(client, NULL);
+  }
+
+  client->readlen = 0;
+  client->reqtype = 0;
+  client->method = 0;
+  client->totallen = 0;
+  client->substep = 0;
+  client->matched = 0;
+  client->scanned = 0;
+  client->chunked = 0;
+  client->ptr = 0;
+  client->route = 0;
+  client->content = 0;
+  client->keepalive = 0;
+  client->events = 0;
+  client->userdata = NULL;
+  client->requests++;
+  client->lastseen = millis();
+  client->step = WEBSERVER_CLIENT_READ_HEADER;
+
+  if(client->data.boundary != NULL) {
+    free(client->data.boundary);
+    client->data.boundary = NULL;
+  }
+  memset(&client->buffer, 0, WEBSERVER_BUFFER_SIZE);
+
+  if(client->pipeline != NULL) {
+    unsigned char *pipeline = client->pipeline;
+    uint16_t len = client->pipelinelen;
+    client->pipeline = NULL;
+    client->pipelinelen = 0;
+    webserver_sync_receive(client, pipeline, len);
+    free(pipeline);
+  }
+}
+
 #ifdef ESP8266
 err_t webserver_client(void *arg, tcp_pcb *pcb, err_t err) {
   uint8_t i = 0;
@@ -2294,9 +2704,16 @@ void webserver_loop(void) {
     if(clients[i].data.step == 0 || clients[i].data.async == 1) {
       continue;
     }
+    size = 0;
     if(clients[i].data.is_websocket == 1) {
       if((unsigned long)(millis() - clients[i].data.lastping) > WEBSERVER_CLIENT_PING_INTERVAL) {
-        websocket_send_header(&clients[i].data, WEBSOCKET_OPCODE_PING, 0);
+        websocket_send_control(&clients[i].data, WEBSOCKET_OPCODE_PING);
+        clients[i].data.lastping = millis();
+      }
+    }
+    if(clients[i].data.is_eventstream == 1) {
+      if((unsigned long)(millis() - clients[i].data.lastping) > WEBSERVER_CLIENT_PING_INTERVAL) {
+        webserver_events_ping(&clients[i].data);
         clients[i].data.lastping = millis();
       }
     }
@@ -2308,11 +2725,19 @@ void webserver_loop(void) {
 #endif
       clients[i].data.step = WEBSERVER_CLIENT_CLOSE;
     }
+    if(webserver_client_idle(&clients[i].data) == 1) {
+      clients[i].data.step = WEBSERVER_CLIENT_CLOSE;
+    }
 
     if(!clients[i].data.client->connected()) {
       clients[i].data.step = WEBSERVER_CLIENT_CLOSE;
     }
 
+    if((clients[i].data.step == WEBSERVER_CLIENT_WEBSOCKET || clients[i].data.step == WEBSERVER_CLIENT_EVENTSTREAM) &&
+       clients[i].data.queuelen > 0) {
+      clients[i].data.step = WEBSERVER_CLIENT_SENDING;
+    }
+
     switch(clients[i].data.step) {
       case WEBSERVER_CLIENT_CONNECTING: {
         if(clients[i].data.client->available()) {
@@ -2344,10 +2769,13 @@ void webserver_loop(void) {
       } break;
       case WEBSERVER_CLIENT_WRITE: {
         if(clients[i].data.callback != NULL) {
+          if(webserver_sendpool_wait(&clients[i].data) == 1) {
+            continue;
+          }
           if(clients[i].data.step == WEBSERVER_CLIENT_WRITE) {
-            if(clients[i].data.callback(&clients[i].data, NULL) == -1) {
+            if(clients[i].data.callback(&clients[i].data, NULL) == -1 || clients[i].data.aborted == 1) {
               clients[i].data.step = WEBSERVER_CLIENT_CLOSE;
-            } else if(clients[i].data.content > 0) {
+            } else if(clients[i].data.content > 0 || clients[i].data.is_eventstream == 1) {
               clients[i].data.step = WEBSERVER_CLIENT_SENDING;
             } else {
               clients[i].data.step = WEBSERVER_CLIENT_WRITE;
@@ -2366,6 +2794,15 @@ void webserver_loop(void) {
          * Leave room for chunk overhead
          */
         clients[i].data.totallen -= 16;
+#ifdef ESP8266
+        /*
+         * Don't let a slow websocket or event stream client
+         * block the loop, its frames wait in its queue
+         */
+        if(clients[i].data.is_websocket == 1 || clients[i].data.is_eventstream == 1) {
+          clients[i].data.totallen = MIN((uint32_t)clients[i].data.totallen, (uint32_t)clients[i].data.client->availableForWrite());
+        }
+#endif
         webserver_process_send(&clients[i].data);
       } break;
 #ifdef ESP8266
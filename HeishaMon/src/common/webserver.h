@@ -41,6 +41,29 @@
   #define WEBSERVER_SENDLIST_BUFSIZE 0
 #endif
 
+/*
+ * Number of sendlist entries shared by all clients
+ * and the number of bytes of RAM content each entry
+ * holds. Used when WEBSERVER_MAX_SENDLIST is 0.
+ */
+#ifndef WEBSERVER_SENDPOOL_SIZE
+  #define WEBSERVER_SENDPOOL_SIZE 48
+#endif
+
+#ifndef WEBSERVER_SENDPOOL_BUFSIZE
+  #define WEBSERVER_SENDPOOL_BUFSIZE 32
+#endif
+
+/*
+ * Free sendpool entries needed before the content
+ * callback of a client is asked for more. A client
+ * waits while fewer are free, so a callback doesn't
+ * find the pool empty halfway through its content.
+ */
+#ifndef WEBSERVER_SENDPOOL_RESERVE
+  #define WEBSERVER_SENDPOOL_RESERVE 16
+#endif
+
 #ifndef WEBSERVER_CLIENT_TIMEOUT
   #define WEBSERVER_CLIENT_TIMEOUT 30000
 #endif
@@ -49,6 +72,42 @@
   #define WEBSERVER_CLIENT_PING_INTERVAL 3000
 #endif
 
+/*
+ * How long an idle keep-alive connection is kept
+ * open and how many requests it may serve.
+ */
+#ifndef WEBSERVER_KEEPALIVE_TIMEOUT
+  #define WEBSERVER_KEEPALIVE_TIMEOUT 15000
+#endif
+
+#ifndef WEBSERVER_MAX_REQUESTS
+  #define WEBSERVER_MAX_REQUESTS 100
+#endif
+
+/*
+ * Outgoing websocket frames and server-sent events are queued
+ * per client in a ring of WEBSERVER_QUEUE_SIZE bytes. When a
+ * new frame does not fit, WEBSERVER_QUEUE_POLICY decides what
+ * happens:
+ * - WEBSERVER_DROP_OLDEST drops the oldest queued frames
+ * - WEBSERVER_DROP_NEWEST drops the new frames that do not fit
+ * - WEBSERVER_DISCONNECT closes the client
+ * Dropped frames are reported to the client with a single
+ * {"dropped":n} frame (or "dropped" event) as soon as there
+ * is room again.
+ */
+#define WEBSERVER_DROP_OLDEST 0
+#define WEBSERVER_DROP_NEWEST 1
+#define WEBSERVER_DISCONNECT 2
+
+#ifndef WEBSERVER_QUEUE_SIZE
+  #define WEBSERVER_QUEUE_SIZE 1024
+#endif
+
+#ifndef WEBSERVER_QUEUE_POLICY
+  #define WEBSERVER_QUEUE_POLICY WEBSERVER_DROP_OLDEST
+#endif
+
 #ifndef __linux__
   #include <Arduino.h>
   #include "lwip/opt.h"
@@ -94,7 +153,12 @@ typedef struct arguments_t {
 } arguments_t;
 
 typedef struct sendlist_t {
-#if WEBSERVER_SENDLIST_BUFSIZE == 0
+#if WEBSERVER_MAX_SENDLIST == 0
+  union {
+    void *ptr;
+    unsigned char fixed[WEBSERVER_SENDPOOL_BUFSIZE];
+  } data;
+#elif WEBSERVER_SENDLIST_BUFSIZE == 0
   union {
     void *ptr;
   } data;
@@ -131,14 +195,44 @@ typedef struct webserver_t {
   uint8_t reqtype:1;
   uint8_t async:1;
   uint8_t method:1;
+  uint8_t keepalive:1;
+  uint8_t is_eventstream:1;
+  /*
+   * Content was lost, the response can't be
+   * finished and the connection is closed
+   */
+  uint8_t aborted:1;
   uint8_t chunked:4;
   uint8_t step:4;
   uint8_t substep:4;
   uint16_t ptr;
+  /*
+   * Multipart delimiter matcher state,
+   * carried across received segments
+   */
+  uint16_t scanned;
+  uint8_t matched;
   uint32_t totallen;
   uint32_t readlen;
   uint16_t content;
   uint8_t route;
+  uint8_t requests;
+  /*
+   * Pipelined requests received while
+   * still answering the current one
+   */
+  unsigned char *pipeline;
+  uint16_t pipelinelen;
+  /*
+   * Websocket frames or events waiting to
+   * be sent, see WEBSERVER_QUEUE_SIZE
+   */
+  unsigned char *queue;
+  uint16_t queuehead;
+  uint16_t queuelen;
+  uint16_t queueframe;
+  uint16_t dropped;
+  uint8_t events;
 #if WEBSERVER_MAX_SENDLIST == 0
   struct sendlist_t *sendlist;
   struct sendlist_t *sendlist_head;
@@ -171,6 +265,7 @@ typedef enum {
   WEBSERVER_CLIENT_HEADER,
   WEBSERVER_CLIENT_ARGS,
   WEBSERVER_CLIENT_CLOSE,
+  WEBSERVER_CLIENT_EVENTSTREAM,
 } webserver_steps;
 
 enum {
@@ -186,9 +281,16 @@ int8_t webserver_start(int port, webserver_cb_t *callback, uint8_t async);
 void webserver_loop(void);
 void websocket_write_all_P(PGM_P data, uint16_t data_len);
 void websocket_write_all(char *data, uint16_t data_len);
+void websocket_write_all_binary(unsigned char *data, uint16_t data_len);
+uint8_t websocket_clients(void);
 void websocket_write_P(struct webserver_t *client, PGM_P data, uint16_t data_len);
 void websocket_write(struct webserver_t *client, char *data, uint16_t data_len);
-void websocket_send_header(struct webserver_t *client, uint8_t opcode, uint16_t data_len);
+uint32_t webserver_dropped(void);
+uint16_t webserver_sendpool_peak(void);
+uint16_t webserver_queue_peak(void);
+void webserver_events_start(struct webserver_t *client);
+void webserver_events_all(uint8_t type, PGM_P event, char *data, uint16_t len);
+uint8_t webserver_events_wanted(uint8_t type);
 void webserver_send_content(struct webserver_t *client, char *buf, uint16_t len);
 void webserver_send_content_P(struct webserver_t *client, PGM_P buf, uint16_t len);
 err_t webserver_async_receive(void *arg, tcp_pcb *pcb, struct pbuf *data, err_t err);
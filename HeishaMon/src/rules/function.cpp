@@ -34,6 +34,15 @@
 #include "functions/settimer.h"
 #include "functions/isset.h"
 #include "functions/round.h"
+#include "functions/abs.h"
+#include "functions/clamp.h"
+#include "functions/map.h"
+#include "functions/curve.h"
+#include "functions/movingavg.h"
+#include "functions/movingmin.h"
+#include "functions/movingmax.h"
+#include "functions/slope.h"
+#include "functions/ewma.h"
 
 struct rule_function_t rule_functions[] = {
   { "max", rule_function_max_callback },
@@ -43,7 +52,16 @@ struct rule_function_t rule_functions[] = {
   { "coalesce", rule_function_coalesce_callback },
   { "settimer", rule_function_set_timer_callback },
   { "isset", rule_function_isset_callback },
-  { "round", rule_function_round_callback }
+  { "round", rule_function_round_callback },
+  { "abs", rule_function_abs_callback },
+  { "clamp", rule_function_clamp_callback },
+  { "map", rule_function_map_callback },
+  { "curve", rule_function_curve_callback },
+  { "movingAvg", rule_function_moving_avg_callback },
+  { "movingMin", rule_function_moving_min_callback },
+  { "movingMax", rule_function_moving_max_callback },
+  { "slope", rule_function_slope_callback },
+  { "ewma", rule_function_ewma_callback }
 };
 
 unsigned int nr_rule_functions = sizeof(rule_functions)/sizeof(rule_functions[0]);
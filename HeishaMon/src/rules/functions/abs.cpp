@@ -0,0 +1,72 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifdef ESP8266
+  #pragma GCC diagnostic warning "-fpermissive"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../function.h"
+#include "../../common/mem.h"
+#include "../rules.h"
+
+int rule_function_abs_callback(struct rules_t *obj, uint16_t argc, uint16_t *argv, int *ret) {
+/* LCOV_EXCL_START*/
+#ifdef DEBUG
+  printf("%s\n", __FUNCTION__);
+#endif
+/* LCOV_EXCL_STOP*/
+
+  if(argc != 1) {
+    return -1;
+  }
+
+  *ret = obj->varstack.nrbytes;
+
+  switch(obj->varstack.buffer[argv[0]]) {
+    case VINTEGER: {
+      unsigned int size = alignedbytes(obj->varstack.nrbytes+sizeof(struct vm_vinteger_t));
+
+      struct vm_vinteger_t *out = (struct vm_vinteger_t *)&obj->varstack.buffer[obj->varstack.nrbytes];
+      struct vm_vinteger_t *val = (struct vm_vinteger_t *)&obj->varstack.buffer[argv[0]];
+      out->ret = 0;
+      out->type = VINTEGER;
+      out->value = abs(val->value);
+
+      obj->varstack.nrbytes = size;
+    } break;
+    case VFLOAT: {
+      unsigned int size = alignedbytes(obj->varstack.nrbytes+sizeof(struct vm_vfloat_t));
+
+      struct vm_vfloat_t *out = (struct vm_vfloat_t *)&obj->varstack.buffer[obj->varstack.nrbytes];
+      struct vm_vfloat_t *val = (struct vm_vfloat_t *)&obj->varstack.buffer[argv[0]];
+      out->ret = 0;
+      out->type = VFLOAT;
+      out->value = fabs(val->value);
+
+      obj->varstack.nrbytes = size;
+    } break;
+    default: {
+      unsigned int size = alignedbytes(obj->varstack.nrbytes+sizeof(struct vm_vnull_t));
+
+      struct vm_vnull_t *out = (struct vm_vnull_t *)&obj->varstack.buffer[obj->varstack.nrbytes];
+      out->ret = 0;
+      out->type = VNULL;
+
+      obj->varstack.nrbytes = size;
+    } break;
+  }
+
+  obj->varstack.bufsize = MAX(obj->varstack.bufsize, alignedvarstack(obj->varstack.nrbytes));
+
+  return 0;
+}
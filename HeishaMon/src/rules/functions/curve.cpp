@@ -0,0 +1,125 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifdef ESP8266
+  #pragma GCC diagnostic warning "-fpermissive"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../function.h"
+#include "../../common/mem.h"
+#include "../rules.h"
+
+static int get_number(struct rules_t *obj, uint16_t pos, float *out) {
+  switch(obj->varstack.buffer[pos]) {
+    case VINTEGER: {
+      struct vm_vinteger_t *val = (struct vm_vinteger_t *)&obj->varstack.buffer[pos];
+      *out = (float)val->value;
+    } break;
+    case VFLOAT: {
+      struct vm_vfloat_t *val = (struct vm_vfloat_t *)&obj->varstack.buffer[pos];
+      *out = val->value;
+    } break;
+    default: {
+      return -1;
+    } break;
+  }
+  return 0;
+}
+
+/*
+ * curve(value, x1, y1, x2, y2, ..., xn, yn)
+ *
+ * Piecewise linear interpolation over a list of
+ * points sorted by ascending x. Values outside of
+ * the list take the y of the nearest endpoint.
+ *
+ * The points are normally constants, so they are
+ * only stored once in the bytecode.
+ */
+int rule_function_curve_callback(struct rules_t *obj, uint16_t argc, uint16_t *argv, int *ret) {
+/* LCOV_EXCL_START*/
+#ifdef DEBUG
+  printf("%s\n", __FUNCTION__);
+#endif
+/* LCOV_EXCL_STOP*/
+
+  float x = 0, x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+  int i = 0, isnull = 0;
+
+  if(argc < 3 || (argc % 2) == 0) {
+    return -1;
+  }
+
+  *ret = obj->varstack.nrbytes;
+
+  if(get_number(obj, argv[0], &x) == -1 ||
+     get_number(obj, argv[1], &x1) == -1 || get_number(obj, argv[2], &y1) == -1) {
+    isnull = 1;
+  } else if(x <= x1) {
+    /*
+     * Below the first point
+     */
+    x = y1;
+  } else {
+    for(i=3;i<argc;i+=2) {
+      /*
+       * Points that are not sorted
+       * don't make a curve
+       */
+      if(get_number(obj, argv[i], &x2) == -1 || get_number(obj, argv[i+1], &y2) == -1 || x2 < x1) {
+        isnull = 1;
+        break;
+      }
+      if(x <= x2) {
+        break;
+      }
+      x1 = x2;
+      y1 = y2;
+    }
+
+    /*
+     * Above the last point
+     */
+    if(isnull == 0) {
+      if(i >= argc || fabs(x2 - x1) < EPSILON) {
+        x = y1;
+      } else {
+        x = y1 + (x - x1) * (y2 - y1) / (x2 - x1);
+      }
+    }
+  }
+
+  if(isnull == 1) {
+    unsigned int size = alignedbytes(obj->varstack.nrbytes+sizeof(struct vm_vnull_t));
+
+    struct vm_vnull_t *out = (struct vm_vnull_t *)&obj->varstack.buffer[obj->varstack.nrbytes];
+    out->ret = 0;
+    out->type = VNULL;
+
+    obj->varstack.nrbytes = size;
+    obj->varstack.bufsize = MAX(obj->varstack.bufsize, alignedvarstack(obj->varstack.nrbytes));
+    return 0;
+  }
+
+  unsigned int size = alignedbytes(obj->varstack.nrbytes+sizeof(struct vm_vfloat_t));
+
+  struct vm_vfloat_t *out = (struct vm_vfloat_t *)&obj->varstack.buffer[obj->varstack.nrbytes];
+  out->ret = 0;
+  out->type = VFLOAT;
+  out->value = x;
+
+  obj->varstack.nrbytes = size;
+  obj->varstack.bufsize = MAX(obj->varstack.bufsize, alignedvarstack(obj->varstack.nrbytes));
+
+  return 0;
+}
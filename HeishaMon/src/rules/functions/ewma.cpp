@@ -0,0 +1,69 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifdef ESP8266
+  #pragma GCC diagnostic warning "-fpermissive"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../function.h"
+#include "../../common/mem.h"
+#include "../rules.h"
+#include "window.h"
+
+/*
+ * ewma(window, value, alpha)
+ *
+ * Exponentially weighted moving average with a
+ * smoothing factor between 0 and 1. It is kept
+ * next to, but independent of, the samples of
+ * the window with the same number.
+ */
+int rule_function_ewma_callback(struct rules_t *obj, uint16_t argc, uint16_t *argv, int *ret) {
+/* LCOV_EXCL_START*/
+#ifdef DEBUG
+  printf("%s\n", __FUNCTION__);
+#endif
+/* LCOV_EXCL_STOP*/
+
+  struct rule_window_t *window = NULL;
+  float value = 0;
+
+  if(argc != 1 && argc != 3) {
+    return -1;
+  }
+
+  if((window = rule_window_get(obj, argv[0])) == NULL) {
+    return -1;
+  }
+
+  if(argc == 3 && rule_window_value(obj, argv[1], &value) == 0) {
+    float alpha = 0;
+    if(rule_window_value(obj, argv[2], &alpha) == -1 || alpha <= 0 || alpha > 1) {
+      return -1;
+    }
+    if(window->hasewma == 0) {
+      window->ewma = value;
+      window->hasewma = 1;
+    } else {
+      window->ewma += alpha * (value - window->ewma);
+    }
+  }
+
+  if(window->hasewma == 0) {
+    rule_window_result(obj, ret, 0, 1);
+  } else {
+    rule_window_result(obj, ret, window->ewma, 0);
+  }
+
+  return 0;
+}
@@ -0,0 +1,84 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifdef ESP8266
+  #pragma GCC diagnostic warning "-fpermissive"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../function.h"
+#include "../../common/mem.h"
+#include "../rules.h"
+
+/*
+ * map(value, in_low, in_high, out_low, out_high)
+ */
+int rule_function_map_callback(struct rules_t *obj, uint16_t argc, uint16_t *argv, int *ret) {
+/* LCOV_EXCL_START*/
+#ifdef DEBUG
+  printf("%s\n", __FUNCTION__);
+#endif
+/* LCOV_EXCL_STOP*/
+
+  float values[5];
+  int i = 0, isnull = 0;
+
+  if(argc != 5) {
+    return -1;
+  }
+
+  *ret = obj->varstack.nrbytes;
+
+  for(i=0;i<5;i++) {
+    switch(obj->varstack.buffer[argv[i]]) {
+      case VINTEGER: {
+        struct vm_vinteger_t *val = (struct vm_vinteger_t *)&obj->varstack.buffer[argv[i]];
+        values[i] = (float)val->value;
+      } break;
+      case VFLOAT: {
+        struct vm_vfloat_t *val = (struct vm_vfloat_t *)&obj->varstack.buffer[argv[i]];
+        values[i] = val->value;
+      } break;
+      default: {
+        isnull = 1;
+      } break;
+    }
+  }
+
+  /*
+   * An empty input range would divide by zero,
+   * so it gives NULL like a missing value does
+   */
+  if(isnull == 1 || fabs(values[2] - values[1]) < EPSILON) {
+    unsigned int size = alignedbytes(obj->varstack.nrbytes+sizeof(struct vm_vnull_t));
+
+    struct vm_vnull_t *out = (struct vm_vnull_t *)&obj->varstack.buffer[obj->varstack.nrbytes];
+    out->ret = 0;
+    out->type = VNULL;
+
+    obj->varstack.nrbytes = size;
+    obj->varstack.bufsize = MAX(obj->varstack.bufsize, alignedvarstack(obj->varstack.nrbytes));
+    return 0;
+  }
+
+  unsigned int size = alignedbytes(obj->varstack.nrbytes+sizeof(struct vm_vfloat_t));
+
+  struct vm_vfloat_t *out = (struct vm_vfloat_t *)&obj->varstack.buffer[obj->varstack.nrbytes];
+  out->ret = 0;
+  out->type = VFLOAT;
+  out->value = values[3] + (values[0] - values[1]) * (values[4] - values[3]) / (values[2] - values[1]);
+
+  obj->varstack.nrbytes = size;
+  obj->varstack.bufsize = MAX(obj->varstack.bufsize, alignedvarstack(obj->varstack.nrbytes));
+
+  return 0;
+}
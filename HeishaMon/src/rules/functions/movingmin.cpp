@@ -0,0 +1,58 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifdef ESP8266
+  #pragma GCC diagnostic warning "-fpermissive"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../function.h"
+#include "../../common/mem.h"
+#include "../rules.h"
+#include "window.h"
+
+/*
+ * movingMin(window, value)
+ *
+ * Adds the value to the window and returns the
+ * lowest sample of the window.
+ */
+int rule_function_moving_min_callback(struct rules_t *obj, uint16_t argc, uint16_t *argv, int *ret) {
+/* LCOV_EXCL_START*/
+#ifdef DEBUG
+  printf("%s\n", __FUNCTION__);
+#endif
+/* LCOV_EXCL_STOP*/
+
+  struct rule_window_t *window = NULL;
+  float value = 0;
+
+  if(argc < 1 || argc > 2) {
+    return -1;
+  }
+
+  if((window = rule_window_get(obj, argv[0])) == NULL) {
+    return -1;
+  }
+
+  if(argc == 2 && rule_window_value(obj, argv[1], &value) == 0) {
+    rule_window_push(window, value);
+  }
+
+  if(window->count == 0) {
+    rule_window_result(obj, ret, 0, 1);
+  } else {
+    rule_window_result(obj, ret, window->samples[window->minq[window->minhead]], 0);
+  }
+
+  return 0;
+}
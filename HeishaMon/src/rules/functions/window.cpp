@@ -0,0 +1,202 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifdef ESP8266
+  #pragma GCC diagnostic warning "-fpermissive"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "../function.h"
+#include "../../common/mem.h"
+#include "../rules.h"
+#include "window.h"
+
+static struct rule_window_t *windows[RULE_MAX_WINDOWS] = { NULL };
+static struct rule_window_t *detached[RULE_MAX_WINDOWS] = { NULL };
+
+/*
+ * Windows are allocated on first use. Every function
+ * is called once while validating the rules, so this
+ * happens when the rules are parsed.
+ */
+struct rule_window_t *rule_window_get(struct rules_t *obj, uint16_t argv) {
+  if(obj->varstack.buffer[argv] != VINTEGER) {
+    return NULL;
+  }
+
+  struct vm_vinteger_t *val = (struct vm_vinteger_t *)&obj->varstack.buffer[argv];
+  int nr = val->value;
+
+  if(nr < 1 || nr > RULE_MAX_WINDOWS) {
+    return NULL;
+  }
+
+  if(windows[nr-1] == NULL) {
+    if((windows[nr-1] = (struct rule_window_t *)MALLOC(sizeof(struct rule_window_t))) == NULL) {
+      OUT_OF_MEMORY
+    }
+    memset(windows[nr-1], 0, sizeof(struct rule_window_t));
+  }
+
+  return windows[nr-1];
+}
+
+int rule_window_value(struct rules_t *obj, uint16_t argv, float *out) {
+  switch(obj->varstack.buffer[argv]) {
+    case VINTEGER: {
+      struct vm_vinteger_t *val = (struct vm_vinteger_t *)&obj->varstack.buffer[argv];
+      *out = (float)val->value;
+    } break;
+    case VFLOAT: {
+      struct vm_vfloat_t *val = (struct vm_vfloat_t *)&obj->varstack.buffer[argv];
+      *out = val->value;
+    } break;
+    default: {
+      return -1;
+    } break;
+  }
+  return 0;
+}
+
+/*
+ * Recalculate the running sums from scratch
+ * to prevent floating point drift.
+ */
+static void rule_window_resum(struct rule_window_t *window) {
+  uint8_t i = 0, oldest = (window->count < RULE_WINDOW_SIZE) ? 0 : window->pos;
+
+  window->sum = 0;
+  window->sumxy = 0;
+  for(i=0;i<window->count;i++) {
+    float y = window->samples[(oldest + i) % RULE_WINDOW_SIZE];
+    window->sum += y;
+    window->sumxy += i * y;
+  }
+}
+
+void rule_window_push(struct rule_window_t *window, float value) {
+  uint8_t pos = window->pos;
+
+  if(window->count == RULE_WINDOW_SIZE) {
+    /*
+     * The oldest sample is overwritten, so every
+     * remaining sample shifts one position down.
+     */
+    float oldest = window->samples[pos];
+    window->sumxy -= (window->sum - oldest);
+    window->sumxy += (RULE_WINDOW_SIZE - 1) * value;
+    window->sum += value - oldest;
+
+    if(window->minlen > 0 && window->minq[window->minhead] == pos) {
+      window->minhead = (window->minhead + 1) % RULE_WINDOW_SIZE;
+      window->minlen--;
+    }
+    if(window->maxlen > 0 && window->maxq[window->maxhead] == pos) {
+      window->maxhead = (window->maxhead + 1) % RULE_WINDOW_SIZE;
+      window->maxlen--;
+    }
+  } else {
+    window->sumxy += window->count * value;
+    window->sum += value;
+    window->count++;
+  }
+
+  window->samples[pos] = value;
+
+  while(window->minlen > 0 && window->samples[window->minq[(window->minhead + window->minlen - 1) % RULE_WINDOW_SIZE]] >= value) {
+    window->minlen--;
+  }
+  window->minq[(window->minhead + window->minlen) % RULE_WINDOW_SIZE] = pos;
+  window->minlen++;
+
+  while(window->maxlen > 0 && window->samples[window->maxq[(window->maxhead + window->maxlen - 1) % RULE_WINDOW_SIZE]] <= value) {
+    window->maxlen--;
+  }
+  window->maxq[(window->maxhead + window->maxlen) % RULE_WINDOW_SIZE] = pos;
+  window->maxlen++;
+
+  window->pos = (pos + 1) % RULE_WINDOW_SIZE;
+
+  if(window->pos == 0) {
+    rule_window_resum(window);
+  }
+}
+
+void rule_window_result(struct rules_t *obj, int *ret, float value, int isnull) {
+  *ret = obj->varstack.nrbytes;
+
+  if(isnull == 1) {
+    unsigned int size = alignedbytes(obj->varstack.nrbytes+sizeof(struct vm_vnull_t));
+
+    struct vm_vnull_t *out = (struct vm_vnull_t *)&obj->varstack.buffer[obj->varstack.nrbytes];
+    out->ret = 0;
+    out->type = VNULL;
+
+    obj->varstack.nrbytes = size;
+  } else {
+    unsigned int size = alignedbytes(obj->varstack.nrbytes+sizeof(struct vm_vfloat_t));
+
+    struct vm_vfloat_t *out = (struct vm_vfloat_t *)&obj->varstack.buffer[obj->varstack.nrbytes];
+    out->ret = 0;
+    out->type = VFLOAT;
+    out->value = value;
+
+    obj->varstack.nrbytes = size;
+  }
+
+  obj->varstack.bufsize = MAX(obj->varstack.bufsize, alignedvarstack(obj->varstack.nrbytes));
+}
+
+void rule_windows_clear(void) {
+  uint8_t i = 0;
+  for(i=0;i<RULE_MAX_WINDOWS;i++) {
+    if(windows[i] != NULL) {
+      memset(windows[i], 0, sizeof(struct rule_window_t));
+    }
+  }
+}
+
+void rule_windows_free(void) {
+  uint8_t i = 0;
+  for(i=0;i<RULE_MAX_WINDOWS;i++) {
+    if(windows[i] != NULL) {
+      FREE(windows[i]);
+    }
+  }
+}
+
+/*
+ * Set the current windows aside, so validating
+ * a changed rule uses fresh windows instead of
+ * adding samples to the ones in use.
+ */
+void rule_windows_detach(void) {
+  uint8_t i = 0;
+  for(i=0;i<RULE_MAX_WINDOWS;i++) {
+    if(detached[i] != NULL) {
+      FREE(detached[i]);
+    }
+    detached[i] = windows[i];
+    windows[i] = NULL;
+  }
+}
+
+void rule_windows_attach(void) {
+  uint8_t i = 0;
+  for(i=0;i<RULE_MAX_WINDOWS;i++) {
+    if(windows[i] != NULL) {
+      FREE(windows[i]);
+    }
+    windows[i] = detached[i];
+    detached[i] = NULL;
+  }
+}
@@ -0,0 +1,66 @@
+/*
+  Copyright (C) CurlyMo
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#ifndef _RULES_WINDOW_H_
+#define _RULES_WINDOW_H_
+
+#include <stdint.h>
+#include "../rules.h"
+
+/*
+ * Number of samples in a window
+ */
+#ifndef RULE_WINDOW_SIZE
+  #define RULE_WINDOW_SIZE 30
+#endif
+
+/*
+ * Windows are numbered 1 to RULE_MAX_WINDOWS
+ */
+#ifndef RULE_MAX_WINDOWS
+  #define RULE_MAX_WINDOWS 8
+#endif
+
+typedef struct rule_window_t {
+  float samples[RULE_WINDOW_SIZE];
+
+  /*
+   * Monotonic queues of sample positions
+   * holding the minimum and maximum.
+   */
+  uint8_t minq[RULE_WINDOW_SIZE];
+  uint8_t maxq[RULE_WINDOW_SIZE];
+  uint8_t minhead;
+  uint8_t minlen;
+  uint8_t maxhead;
+  uint8_t maxlen;
+
+  uint8_t pos;
+  uint8_t count;
+
+  /*
+   * Running sum of the samples and of the
+   * samples multiplied by their position.
+   */
+  float sum;
+  float sumxy;
+
+  uint8_t hasewma;
+  float ewma;
+} rule_window_t;
+
+struct rule_window_t *rule_window_get(struct rules_t *obj, uint16_t argv);
+void rule_window_push(struct rule_window_t *window, float value);
+int rule_window_value(struct rules_t *obj, uint16_t argv, float *out);
+void rule_window_result(struct rules_t *obj, int *ret, float value, int isnull);
+void rule_windows_clear(void);
+void rule_windows_free(void);
+void rule_windows_detach(void);
+void rule_windows_attach(void);
+
+#endif
@@ -42,20 +42,20 @@
 #include "operators/minus.h"
 
 struct rule_operator_t rule_operators[] = {
-  { "==", 30, 1, rule_operator_eq_callback },
-  { "!=", 30, 1, rule_operator_ne_callback },
-  { "+", 60, 1, rule_operator_plus_callback },
-  { "-", 60, 1, rule_operator_minus_callback },
-  { "*", 70, 1, rule_operator_multiply_callback },
-  { "%", 70, 1, rule_operator_mod_callback },
-  { "&&", 20, 1, rule_operator_and_callback },
-  { "||", 10, 1, rule_operator_or_callback },
-  { "/", 70, 1, rule_operator_divide_callback },
-  { ">=", 30, 1, rule_operator_ge_callback },
-  { "<=", 30, 1, rule_operator_le_callback },
-  { "<", 30, 1, rule_operator_lt_callback },
-  { ">", 30, 1, rule_operator_gt_callback },
-  { "^", 80, 2, rule_operator_power_callback },
+  { "==", 30, 1, rule_operator_eq_callback, rule_operator_eq_fast },
+  { "!=", 30, 1, rule_operator_ne_callback, rule_operator_ne_fast },
+  { "+", 60, 1, rule_operator_plus_callback, rule_operator_plus_fast },
+  { "-", 60, 1, rule_operator_minus_callback, rule_operator_minus_fast },
+  { "*", 70, 1, rule_operator_multiply_callback, rule_operator_multiply_fast },
+  { "%", 70, 1, rule_operator_mod_callback, NULL },
+  { "&&", 20, 1, rule_operator_and_callback, rule_operator_and_fast },
+  { "||", 10, 1, rule_operator_or_callback, rule_operator_or_fast },
+  { "/", 70, 1, rule_operator_divide_callback, NULL },
+  { ">=", 30, 1, rule_operator_ge_callback, rule_operator_ge_fast },
+  { "<=", 30, 1, rule_operator_le_callback, rule_operator_le_fast },
+  { "<", 30, 1, rule_operator_lt_callback, rule_operator_lt_fast },
+  { ">", 30, 1, rule_operator_gt_callback, rule_operator_gt_fast },
+  { "^", 80, 2, rule_operator_power_callback, NULL },
 };
 
 unsigned int nr_rule_operators = sizeof(rule_operators)/sizeof(rule_operators[0]);
\ No newline at end of file
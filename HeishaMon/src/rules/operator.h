@@ -16,6 +16,13 @@ struct rule_operator_t {
   int precedence;
   int associativity;
   int (*callback)(struct rules_t *obj, int a, int b, int *ret);
+  /*
+   * Optional variant used when both operands are
+   * VINTEGER or both are VFLOAT. Returns the type
+   * of the result stored in out, or -1 to fall
+   * back to the regular callback.
+   */
+  int (*fast)(uint8_t type, union vm_number_t a, union vm_number_t b, union vm_number_t *out);
 } __attribute__((packed));
 
 extern struct rule_operator_t rule_operators[];
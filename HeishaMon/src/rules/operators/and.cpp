@@ -107,4 +107,13 @@ int rule_operator_and_callback(struct rules_t *obj, int a, int b, int *ret) {
   obj->varstack.bufsize = MAX(obj->varstack.bufsize, alignedvarstack(obj->varstack.nrbytes));
 
   return 0;
-}
\ No newline at end of file
+}
+
+int rule_operator_and_fast(uint8_t type, union vm_number_t a, union vm_number_t b, union vm_number_t *out) {
+  if(type == VINTEGER) {
+    out->i = (a.i > 0 && b.i > 0);
+  } else {
+    out->i = (a.f > 0 && b.f > 0);
+  }
+  return VINTEGER;
+}
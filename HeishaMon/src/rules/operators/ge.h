@@ -12,5 +12,6 @@
 #include "../rules.h"
 
 int rule_operator_ge_callback(struct rules_t *obj, int a, int b, int *ret);
+int rule_operator_ge_fast(uint8_t type, union vm_number_t a, union vm_number_t b, union vm_number_t *out);
 
 #endif
\ No newline at end of file
@@ -114,3 +114,12 @@ int rule_operator_plus_callback(struct rules_t *obj, int a, int b, int *ret) {
 
   return 0;
 }
+
+int rule_operator_plus_fast(uint8_t type, union vm_number_t a, union vm_number_t b, union vm_number_t *out) {
+  if(type == VINTEGER) {
+    out->i = a.i + b.i;
+  } else {
+    out->f = a.f + b.f;
+  }
+  return type;
+}
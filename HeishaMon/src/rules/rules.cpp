@@ -46,6 +46,25 @@ struct vm_cache_t {
 } __attribute__((packed)) **vmcache;
 static unsigned int nrcache = 0;
 
+struct rule_stats_t rule_stats;
+
+/*
+ * nested counts the rule_run invocations on the
+ * stack, depth the rules called by another rule
+ * that haven't returned to their caller yet.
+ * returning is the caller a called rule returns
+ * to, from the nesting it returned from.
+ */
+static struct {
+  uint32_t steps;
+  unsigned long start;
+  uint8_t nested;
+  uint8_t depth;
+  uint8_t calling;
+  uint16_t returning;
+  uint8_t from;
+} budget;
+
 /*LCOV_EXCL_START*/
 #ifdef DEBUG
 static void print_tree(struct rules_t *obj);
@@ -3449,6 +3468,132 @@ static int vm_value_del(struct rules_t *obj, unsigned int idx) {
   return ret;
 }
 
+/*
+ * Evaluate an operator without copying its operands
+ * to the varstack first. Constants and variables are
+ * read in place, so only the result is pushed. This
+ * is only possible when both operands are integers
+ * or both are floats, otherwise -1 is returned and
+ * the regular operator callback is used. It is not
+ * used by the validation run, see vm_run.
+ */
+static int vm_operator_fast(struct rules_t *obj, int go) {
+  struct vm_toperator_t *node = (struct vm_toperator_t *)&obj->ast.buffer[go];
+  union vm_number_t values[2], out;
+  uint16_t steps[2] = { node->left, node->right };
+  uint16_t stack[2] = { 0, 0 };
+  uint8_t types[2] = { 0, 0 };
+  int i = 0, type = 0, c = obj->varstack.nrbytes;
+
+  if(rule_operators[node->token].fast == NULL) {
+    return -1;
+  }
+
+  for(i=0;i<2;i++) {
+    unsigned char *val = NULL;
+
+    switch(obj->ast.buffer[steps[i]]) {
+      case VINTEGER:
+      case VFLOAT: {
+        val = &obj->ast.buffer[steps[i]];
+      } break;
+      case TOPERATOR: {
+        struct vm_toperator_t *tmp = (struct vm_toperator_t *)&obj->ast.buffer[steps[i]];
+        stack[i] = tmp->value;
+        val = &obj->varstack.buffer[tmp->value];
+      } break;
+      case LPAREN: {
+        struct vm_lparen_t *tmp = (struct vm_lparen_t *)&obj->ast.buffer[steps[i]];
+        stack[i] = tmp->value;
+        val = &obj->varstack.buffer[tmp->value];
+      } break;
+      case TFUNCTION: {
+        struct vm_tfunction_t *tmp = (struct vm_tfunction_t *)&obj->ast.buffer[steps[i]];
+        stack[i] = tmp->value;
+        val = &obj->varstack.buffer[tmp->value];
+      } break;
+      case TVAR: {
+        if(rule_options.get_token_val_cb == NULL || rule_options.cpy_token_val_cb == NULL) {
+          return -1;
+        }
+        rule_options.cpy_token_val_cb(obj, steps[i]);
+        if((val = rule_options.get_token_val_cb(obj, steps[i])) == NULL) {
+          return -1;
+        }
+      } break;
+      default: {
+        return -1;
+      } break;
+    }
+
+    /*
+     * Copy the value right away, variable callbacks
+     * can reuse the same buffer for every call.
+     */
+    types[i] = val[0];
+    if(types[i] == VINTEGER) {
+      values[i].i = ((struct vm_vinteger_t *)val)->value;
+    } else if(types[i] == VFLOAT) {
+      values[i].f = ((struct vm_vfloat_t *)val)->value;
+    } else {
+      return -1;
+    }
+  }
+
+  if(types[0] != types[1]) {
+    return -1;
+  }
+
+  if((type = rule_operators[node->token].fast(types[0], values[0], values[1], &out)) == -1) {
+    return -1;
+  }
+
+  if(type == VINTEGER) {
+    struct vm_vinteger_t *tmp = (struct vm_vinteger_t *)&obj->varstack.buffer[c];
+    tmp->type = VINTEGER;
+    tmp->ret = go;
+    tmp->value = out.i;
+    obj->varstack.nrbytes = alignedbytes(c+sizeof(struct vm_vinteger_t));
+  } else {
+    struct vm_vfloat_t *tmp = (struct vm_vfloat_t *)&obj->varstack.buffer[c];
+    tmp->type = VFLOAT;
+    tmp->ret = go;
+    tmp->value = out.f;
+    obj->varstack.nrbytes = alignedbytes(c+sizeof(struct vm_vfloat_t));
+  }
+  obj->varstack.bufsize = MAX(obj->varstack.bufsize, alignedvarstack(obj->varstack.nrbytes));
+  node->value = c;
+
+  for(i=0;i<2;i++) {
+    if(stack[i] > 0) {
+      switch(obj->ast.buffer[steps[i]]) {
+        case TOPERATOR: {
+          ((struct vm_toperator_t *)&obj->ast.buffer[steps[i]])->value = 0;
+        } break;
+        case LPAREN: {
+          ((struct vm_lparen_t *)&obj->ast.buffer[steps[i]])->value = 0;
+        } break;
+        case TFUNCTION: {
+          ((struct vm_tfunction_t *)&obj->ast.buffer[steps[i]])->value = 0;
+        } break;
+      }
+    }
+  }
+
+  /*
+   * Intermediate results are removed from the
+   * varstack highest position first.
+   */
+  if(stack[0] > 0 || stack[1] > 0) {
+    vm_value_del(obj, MAX(stack[0], stack[1]));
+  }
+  if(stack[0] > 0 && stack[1] > 0) {
+    vm_value_del(obj, MIN(stack[0], stack[1]));
+  }
+
+  return 0;
+}
+
 /*LCOV_EXCL_START*/
 void valprint(struct rules_t *obj, char *out, int size) {
   int x = 0, pos = 0;
@@ -3610,7 +3755,17 @@ static void vm_clear_values(struct rules_t *obj) {
   }
 }
 
-int rule_run(struct rules_t *obj, int validate) {
+static unsigned long budget_millis(void) {
+#ifdef ESP8266
+  return millis();
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (ts.tv_sec * 1000) + (ts.tv_nsec / 1000000);
+#endif
+}
+
+static int vm_run(struct rules_t *obj, int validate) {
 #ifdef DEBUG
   printf("----------\n");
   printf("%s %d\n", __FUNCTION__, obj->nr);
@@ -3625,6 +3780,21 @@ int rule_run(struct rules_t *obj, int validate) {
     ESP.wdtFeed();
 #endif
 
+    if(++budget.steps > RULE_MAX_STEPS) {
+      rule_stats.aborted_steps++;
+      logprintf_P(F("ERROR: rule #%d exceeded %d steps, aborting"), obj->nr, RULE_MAX_STEPS);
+      return -1;
+    }
+
+    /*
+     * Only check the clock once every 64 steps
+     */
+    if((budget.steps & 0x3F) == 0 && (unsigned long)(budget_millis() - budget.start) > RULE_MAX_TIME) {
+      rule_stats.aborted_time++;
+      logprintf_P(F("ERROR: rule #%d exceeded %d milliseconds, aborting"), obj->nr, RULE_MAX_TIME);
+      return -1;
+    }
+
 /*LCOV_EXCL_START*/
 #ifdef DEBUG
     printf("goto: %d, ret: %d, bytes: %d\n", go, ret, obj->ast.nrbytes);
@@ -3747,6 +3917,7 @@ int rule_run(struct rules_t *obj, int validate) {
 
         obj->cont.ret = go;
         obj->cont.go = node->ret;
+        budget.calling = 1;
 
         /*
          * Tail recursive
@@ -3781,6 +3952,14 @@ int rule_run(struct rules_t *obj, int validate) {
                   ret = go;
                   go = node->go[i+1];
                 } break;
+                case TFUNCTION: {
+                  ret = go;
+                  go = node->go[i+1];
+                } break;
+                case TVAR: {
+                  ret = go;
+                  go = node->go[i+1];
+                } break;
                 /* LCOV_EXCL_START*/
                 default: {
                   logprintf_P(F("FATAL: Internal error in %s #%d"), __FUNCTION__, __LINE__);
@@ -3801,10 +3980,10 @@ int rule_run(struct rules_t *obj, int validate) {
 
         if(go == 0) {
           go = tmp;
-          unsigned int idx = node->token, i = 0, shift = 0;
+          unsigned int idx = node->token, i = 0, x = 0;
           int c = 0;
           uint16_t values[node->nrgo];
-          memset(&values, 0, node->nrgo);
+          memset(&values, 0, sizeof(values));
 
           /* LCOV_EXCL_START*/
           if(idx > nr_rule_functions) {
@@ -3924,12 +4103,26 @@ int rule_run(struct rules_t *obj, int validate) {
             node->value = 0;
           }
 
+          /*
+           * An argument that was computed before the
+           * function was reached lies below the values
+           * pushed for the other arguments. Deleting
+           * from the highest position down leaves the
+           * positions of the others untouched.
+           */
           for(i=0;i<node->nrgo;i++) {
-            switch(obj->varstack.buffer[values[i] - shift]) {
+            unsigned int high = 0;
+            for(x=1;x<node->nrgo;x++) {
+              if(values[x] > values[high]) {
+                high = x;
+              }
+            }
+            switch(obj->varstack.buffer[values[high]]) {
               case VFLOAT:
               case VNULL:
               case VINTEGER: {
-                shift += vm_value_del(obj, values[i] - shift);
+                vm_value_del(obj, values[high]);
+                values[high] = 0;
 
                 /*
                  * Reassign node due to possible reallocs
@@ -3967,6 +4160,25 @@ int rule_run(struct rules_t *obj, int validate) {
             )
            ) {
           int a = 0, b = 0, c = 0, step = 0;
+
+          /*
+           * The validation run sizes the varstack, so it
+           * has to take the regular path that also puts
+           * both operands on the varstack. A variable that
+           * makes the fast path bail out at runtime would
+           * otherwise write past the reserved space.
+           */
+          if(validate == 0 && vm_operator_fast(obj, go) == 0) {
+            /*
+             * Reassign node due to possible reallocs
+             */
+            node = (struct vm_toperator_t *)&obj->ast.buffer[go];
+
+            ret = go;
+            go = node->ret;
+            break;
+          }
+
           step = node->left;
 
           switch(obj->ast.buffer[step]) {
@@ -4425,15 +4637,77 @@ int rule_run(struct rules_t *obj, int validate) {
   }
 
   /*
-   * Tail recursive
+   * The rule_run that runs the caller
+   * continues it, so the stack doesn't
+   * grow with every return.
    */
   if(obj->caller > 0) {
-    return rule_options.event_cb(obj, NULL);
+    if(budget.depth > 0) {
+      budget.depth--;
+    }
+    budget.returning = obj->caller;
+    budget.from = budget.nested;
+    obj->caller = 0;
   }
 
   return 0;
 }
 
+int rule_run(struct rules_t *obj, int validate) {
+  uint8_t call = (budget.calling == 1 && obj->caller > 0 && obj->cont.go == 0);
+  uint8_t level = 0;
+  int ret = 0;
+
+  budget.calling = 0;
+
+  /*
+   * Rules calling other rules recurse through
+   * the event_cb, so the budget is only reset
+   * by the outermost invocation.
+   */
+  if(budget.nested == 0) {
+    budget.steps = 0;
+    budget.start = budget_millis();
+    budget.depth = 0;
+    budget.returning = 0;
+    rule_stats.runs++;
+  }
+
+  /*
+   * A rule called by another rule is one call
+   * deeper until it returns to its caller, a
+   * caller continuing after the call is not.
+   */
+  if(call == 1 && budget.depth >= RULE_MAX_CALL_DEPTH) {
+    rule_stats.aborted_depth++;
+    logprintf_P(F("ERROR: rule #%d exceeded call depth of %d, aborting"), obj->nr, RULE_MAX_CALL_DEPTH);
+    ret = -1;
+  } else {
+    if(call == 1) {
+      budget.depth++;
+    }
+    level = ++budget.nested;
+    ret = vm_run(obj, validate);
+    while(ret != -1 && budget.returning == obj->nr && budget.from > level) {
+      budget.returning = 0;
+      ret = vm_run(obj, validate);
+    }
+    budget.nested--;
+  }
+
+  /*
+   * Make sure an aborted rule starts
+   * from scratch on the next event.
+   */
+  if(ret == -1) {
+    obj->cont.go = 0;
+    obj->cont.ret = 0;
+    obj->caller = 0;
+  }
+
+  return ret;
+}
+
 /*LCOV_EXCL_START*/
 #ifdef DEBUG
 void print_bytecode(struct rules_t *obj) {
@@ -186,6 +186,40 @@ typedef struct rule_options_t {
 
 extern struct rule_options_t rule_options;
 
+/*
+ * Execution budget of a single rule invocation,
+ * including all rules called from it. A rule
+ * exceeding one of these limits is aborted.
+ */
+#ifndef RULE_MAX_STEPS
+  #define RULE_MAX_STEPS 10000
+#endif
+
+/*
+ * In milliseconds
+ */
+#ifndef RULE_MAX_TIME
+  #define RULE_MAX_TIME 250
+#endif
+
+/*
+ * How deep rules may call other rules. A rule
+ * calling two rules one after another is one
+ * deep, a called rule calling another is two.
+ */
+#ifndef RULE_MAX_CALL_DEPTH
+  #define RULE_MAX_CALL_DEPTH 16
+#endif
+
+typedef struct rule_stats_t {
+  uint32_t runs;
+  uint32_t aborted_steps;
+  uint32_t aborted_time;
+  uint32_t aborted_depth;
+} rule_stats_t;
+
+extern struct rule_stats_t rule_stats;
+
 /*
  * Each position field is the closest
  * aligned width of 11 bits.
@@ -213,6 +247,15 @@ typedef struct vm_vfloat_t {
   float value;
 } __attribute__((packed)) vm_vfloat_t;
 
+/*
+ * Operand or result of a type specialized
+ * operator, see rule_operator_t.
+ */
+typedef union vm_number_t {
+  int i;
+  float f;
+} vm_number_t;
+
 typedef struct vm_tgeneric_t {
   VM_GENERIC_FIELDS
 } __attribute__((packed)) vm_tgeneric_t;
@@ -0,0 +1,812 @@
+// Generated by Tools/webassets.py from HeishaMon/webassets/, do not edit.
+#ifndef _WEBASSETS_H_
+#define _WEBASSETS_H_
+
+struct webAssetStruct {
+  char path[24];
+  char mimetype[24];
+  char etag[12];
+  const uint8_t *data;
+  uint16_t len;
+};
+
+static const uint8_t webAsset_heishamon_css[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x5c,0x4b,0x93,0xe3,0x38,
+  0x72,0x3e,0xbb,0x7e,0x05,0xdd,0x1d,0x1d,0xd1,0xd5,0x41,0xa9,0xa9,0x67,0xe9,0x11,
+  0xde,0xd8,0x9d,0xf6,0xac,0xc3,0x7b,0xd8,0x83,0x67,0xd7,0x3e,0x4c,0xf4,0x01,0x22,
+  0x21,0x89,0x5b,0x7c,0x68,0x49,0xaa,0xab,0xd4,0x0c,0xfd,0x77,0xe3,0xcd,0x04,0x90,
+  0x50,0x95,0x1c,0xae,0x8a,0xe9,0x11,0x13,0x89,0xcc,0x44,0x22,0x91,0xf8,0x90,0x84,
+  0xea,0xeb,0x97,0xe8,0x7f,0x66,0xe3,0x6f,0xbf,0xfd,0x16,0xcd,0xc7,0x93,0x45,0xf4,
+  0xef,0x34,0xa5,0xe5,0x8e,0x36,0xd1,0x34,0x99,0x26,0xd1,0xee,0x12,0xfd,0x85,0x54,
+  0xd1,0xaf,0x87,0xbc,0x88,0x48,0x95,0x45,0xbf,0xd4,0xcd,0x81,0x46,0xff,0x45,0xf7,
+  0x6d,0x45,0xdb,0xe8,0xcb,0xd7,0x87,0x63,0x57,0x16,0xfd,0xae,0x7e,0x1d,0xb5,0xf9,
+  0xcf,0xbc,0x3a,0x6c,0x76,0x75,0x93,0xd1,0x66,0xc4,0x28,0xd7,0x2f,0xf1,0x97,0xcd,
+  0x8e,0xee,0xeb,0x86,0xb2,0x0f,0x64,0xdf,0xd1,0x06,0x32,0xe6,0xd5,0x91,0x36,0x79,
+  0x77,0x7d,0xf8,0xfa,0x25,0xfa,0xf5,0xb5,0x6b,0x48,0xda,0x45,0xfb,0xa6,0x2e,0xa3,
+  0xaa,0x6e,0x4a,0x52,0xe4,0x3f,0xe9,0x38,0x6d,0x5b,0x6e,0xc0,0x5f,0xf3,0xb4,0x2e,
+  0x48,0x1b,0xfd,0x07,0x29,0x0a,0x72,0x60,0xbd,0x84,0x25,0x7f,0xa9,0x2b,0xd2,0x1d,
+  0x99,0x6d,0x7f,0xa5,0xa4,0x88,0x0e,0x79,0x37,0xce,0xeb,0xaf,0xa6,0xaf,0x31,0x6d,
+  0x54,0xb6,0xa3,0x8e,0xbe,0x76,0x5c,0x2d,0x1d,0x91,0xec,0x1f,0xe7,0xb6,0xdb,0x4c,
+  0x92,0xe4,0xd3,0x76,0xf4,0x42,0x77,0xcf,0x79,0x87,0xb7,0x5e,0x77,0x75,0x76,0xe9,
+  0x4b,0xd2,0x1c,0xf2,0x6a,0x93,0x5c,0x1f,0x48,0xd3,0xe5,0x69,0x41,0x63,0xd2,0xe6,
+  0x19,0x8d,0x33,0xda,0x91,0xbc,0x68,0xe3,0x7d,0x7e,0x48,0xc9,0xa9,0xcb,0xeb,0x8a,
+  0x7f,0x3c,0xb3,0x81,0xee,0xeb,0x9a,0x8d,0x33,0x3e,0x52,0xc2,0xbc,0x10,0x97,0x24,
+  0xaf,0xe2,0x92,0x56,0xe7,0xb8,0x22,0x3f,0xe2,0x96,0xa6,0x9c,0xb5,0xcf,0xf2,0xf6,
+  0x54,0x90,0xcb,0x66,0x57,0xd4,0xe9,0xf3,0xb5,0x3d,0x97,0x4c,0xcd,0xc5,0x50,0x8b,
+  0xbc,0xed,0x46,0x79,0x47,0x4b,0xa6,0xf4,0x9c,0xe5,0x75,0x9c,0x92,0xea,0x07,0x69,
+  0xe3,0x53,0x53,0x1f,0x1a,0xda,0xb6,0xf1,0x0f,0x66,0x41,0x6d,0xd8,0xf3,0xaa,0xc8,
+  0x2b,0x3a,0x92,0xb2,0x34,0x4f,0xff,0x83,0x72,0x7b,0x49,0x31,0x62,0xce,0x38,0x54,
+  0x9b,0x1d,0x69,0x29,0x67,0x53,0x22,0x37,0x55,0xdd,0x7d,0xfe,0x3d,0xad,0xab,0xae,
+  0xa9,0x8b,0xf6,0xfb,0xa3,0x11,0x56,0xd5,0x15,0xdd,0x1e,0x69,0x7e,0x38,0x76,0x6c,
+  0xd0,0xbf,0x1f,0xf3,0x2c,0xa3,0xd5,0xf7,0x98,0x19,0xc3,0x9a,0x3b,0x6a,0xf1,0x31,
+  0x59,0xfd,0x8e,0xa4,0xcf,0x87,0xa6,0x3e,0x57,0xd9,0x88,0x4d,0x51,0xdd,0x6c,0xd8,
+  0x34,0x56,0xed,0x89,0x34,0xb4,0xea,0xae,0x64,0xc3,0xa6,0x34,0xff,0xc1,0x7c,0xb6,
+  0x39,0xd6,0xcc,0xa0,0xbe,0x3e,0x77,0xc2,0xd6,0x97,0x3c,0xeb,0x8e,0xc2,0xa9,0xbb,
+  0x5d,0xf3,0x7b,0x97,0x77,0x05,0xfd,0xde,0x9b,0xb8,0xe9,0xba,0xba,0x94,0x86,0x88,
+  0x89,0xc9,0x68,0x5a,0x37,0x84,0xfb,0x6d,0xc3,0xd4,0xd0,0x86,0x4b,0x08,0xb7,0x44,
+  0x19,0xeb,0x4f,0xb3,0xeb,0xc3,0x2e,0x6e,0xd9,0xe0,0xaa,0x43,0xbf,0x67,0xa3,0x64,
+  0x33,0x2d,0x86,0xb4,0xab,0x0b,0xc6,0x77,0xcd,0xf6,0x95,0x24,0xb7,0xdd,0xa5,0xa0,
+  0x9b,0xbc,0x63,0x4e,0x4a,0xaf,0x6c,0x12,0x9e,0xc1,0x80,0x36,0x1f,0xf7,0xfb,0x64,
+  0x2b,0x47,0xf5,0x31,0x49,0x98,0xb5,0x2d,0x8b,0xac,0x42,0x75,0x64,0xd1,0xb2,0x59,
+  0xb1,0x28,0x69,0xcf,0x4c,0xd1,0xf9,0x04,0xa8,0x4f,0x8b,0x4f,0x5b,0x31,0x4a,0xed,
+  0xc6,0xed,0xa9,0x6e,0x73,0x61,0x65,0x43,0x99,0x13,0x99,0x43,0xb6,0xc1,0xd9,0x61,
+  0xe2,0x7a,0xe5,0x81,0x51,0x32,0x9e,0x2e,0x58,0x10,0x70,0xe9,0x5d,0x7d,0xe2,0xcf,
+  0xfc,0x51,0x86,0x99,0x0e,0xcc,0x09,0x2d,0xa3,0x79,0x72,0x7a,0xbd,0xe6,0xe5,0x41,
+  0x7b,0x50,0x0e,0x4a,0xce,0x50,0x5a,0xb3,0x60,0x7d,0xde,0x65,0x2c,0x78,0x68,0xdc,
+  0x92,0x52,0x19,0xba,0x27,0x65,0x5e,0x5c,0x36,0x65,0x5d,0xd5,0x6c,0xb2,0x52,0x1a,
+  0x9b,0x4f,0xdb,0x61,0x20,0x4c,0xf6,0xf5,0x68,0xad,0x58,0x1e,0x30,0x6c,0x62,0xf9,
+  0xda,0x36,0x41,0xb2,0xe5,0x33,0xbb,0x2f,0xea,0x97,0xcd,0x8f,0xbc,0xcd,0x77,0x05,
+  0x53,0xba,0x3b,0xb3,0x01,0x54,0x71,0x5e,0x9d,0xce,0x1d,0x8b,0xf9,0x82,0x45,0x7d,
+  0xcc,0x27,0x8c,0x45,0x05,0x89,0xeb,0x53,0xc7,0xfd,0x2b,0x0d,0xd1,0x39,0x60,0x6b,
+  0xd6,0x99,0xd5,0x0c,0xa7,0xcd,0x16,0xdb,0x7b,0x5a,0x55,0xab,0x54,0xd7,0x8b,0xf8,
+  0x10,0xb1,0xc8,0xb2,0x4f,0xa9,0x9c,0xa1,0x58,0x7e,0xef,0x2e,0x27,0xfa,0x6f,0xf2,
+  0xe1,0xbb,0x7a,0x62,0x6b,0x86,0x76,0xfa,0x81,0x4d,0x42,0x99,0x77,0xdf,0x7b,0x9d,
+  0x1f,0xc8,0xe9,0x44,0x09,0x93,0x95,0xd2,0x8d,0xec,0xa5,0x45,0x6d,0x36,0xa3,0xb2,
+  0xfe,0x39,0xda,0xd7,0xe9,0xb9,0x1d,0xe5,0x55,0xc5,0x16,0xbc,0x25,0x3c,0xd8,0x2e,
+  0xd5,0x05,0x9b,0x95,0x01,0x7e,0xbb,0x3f,0xc5,0xdb,0x13,0xc9,0x32,0x3e,0x37,0x89,
+  0x31,0x6a,0xe8,0xd4,0xb0,0x06,0xc7,0x22,0xb4,0x51,0x99,0x83,0xb6,0x69,0x5b,0xec,
+  0x46,0xbd,0x94,0x37,0x93,0xd3,0xab,0x5a,0x72,0xd1,0x2f,0x42,0xc5,0xdf,0x98,0xe7,
+  0xaf,0x0f,0xfb,0x9c,0x16,0x19,0x13,0xaa,0x0c,0x16,0x6c,0x6d,0x5d,0xe4,0x59,0xf4,
+  0x31,0x4d,0xf8,0xaf,0x99,0xf1,0x68,0x7a,0x7a,0x35,0x83,0x18,0xcf,0x58,0x88,0x47,
+  0xe3,0xe5,0x54,0xfc,0xef,0x89,0xc7,0xfb,0x43,0x41,0x0f,0xb4,0xca,0x7a,0xb9,0x10,
+  0x75,0xbc,0xe8,0x3c,0xd4,0x11,0x36,0xf7,0x4c,0xd6,0xab,0xca,0x29,0x22,0xaf,0x1b,
+  0x97,0x6c,0x5f,0x8e,0x2c,0x8f,0x8e,0x44,0x60,0x6f,0xe4,0xce,0x70,0xd5,0x81,0x38,
+  0x44,0x10,0x39,0x77,0xf5,0xf5,0x41,0x8e,0x36,0x3d,0xd2,0xf4,0x99,0x85,0xb7,0x89,
+  0x0b,0xc2,0xb2,0xe5,0xf7,0x1e,0x38,0x59,0xd2,0xab,0x33,0xdf,0x21,0xf9,0x0c,0xa9,
+  0x18,0x11,0xd3,0xc3,0x34,0xe5,0xd5,0xc8,0x0a,0x33,0x8f,0x91,0x39,0xce,0x66,0xec,
+  0xd5,0x4a,0x82,0x66,0xb4,0x2c,0xde,0xd2,0x23,0x1a,0x81,0xdc,0x7e,0xe1,0xdd,0xad,
+  0xce,0xa6,0xf5,0x7e,0xcf,0x3c,0xbd,0x19,0x31,0x47,0x3a,0xfd,0x07,0xad,0x92,0x00,
+  0x32,0x26,0x26,0x5a,0xae,0x92,0xa1,0xd3,0x3e,0x2f,0xe8,0xe8,0x7c,0x2a,0x6a,0x92,
+  0x69,0x5b,0x83,0x4b,0x62,0x0b,0x97,0xb3,0xdc,0xd2,0xd9,0x16,0x4d,0xd5,0xb6,0xae,
+  0xf6,0xe2,0x58,0xec,0xa9,0x30,0x03,0xfd,0x37,0x6d,0x32,0x52,0x11,0x96,0x9a,0xaa,
+  0x96,0x19,0xd9,0xe4,0x7b,0x98,0x80,0x16,0x2c,0x34,0x60,0x2a,0x9d,0x8c,0x17,0x57,
+  0xb1,0xa7,0xeb,0xb9,0x1b,0xbd,0x6e,0xe4,0x16,0x75,0x7d,0x38,0x4e,0x40,0x0e,0x9e,
+  0x2d,0x99,0x2f,0x8e,0x53,0x48,0xe1,0x49,0xf2,0x38,0x03,0x94,0xe9,0x9c,0x53,0xe6,
+  0x90,0x22,0x78,0x16,0x80,0x32,0x59,0x71,0xca,0x12,0x52,0xb8,0xe4,0x87,0xf1,0xcb,
+  0x4c,0x5a,0x6b,0x0d,0x46,0x50,0xae,0xa2,0xcd,0x0c,0xc7,0x66,0x30,0x64,0xc1,0x95,
+  0x9e,0x9b,0x96,0xed,0x06,0x16,0x8b,0xa2,0x89,0x76,0x93,0x94,0xf1,0xa4,0xcd,0xc7,
+  0x1c,0x1f,0xa7,0xf1,0x71,0x16,0x1f,0xe7,0xf1,0x71,0x11,0x6b,0x43,0x15,0xe3,0x87,
+  0xdf,0xe8,0xa1,0xa6,0xd1,0xdf,0xff,0xf3,0x43,0xfc,0xa7,0x26,0x27,0x85,0xe7,0x64,
+  0x95,0x5d,0xe7,0x89,0x59,0x8d,0x13,0xe6,0x81,0x28,0x11,0xca,0xd9,0x7a,0xa2,0x7d,
+  0x41,0x3b,0x19,0xad,0x24,0xe5,0xe1,0xcf,0x3d,0xf6,0x70,0xd4,0x59,0x88,0xad,0x2f,
+  0x95,0x8e,0xf8,0xf6,0x04,0x56,0x38,0xa5,0x54,0x0b,0x9c,0x4a,0x81,0xc2,0x61,0x79,
+  0x49,0x0e,0x7c,0xe3,0xb2,0xd6,0x2a,0x0c,0x7e,0xbe,0x87,0x39,0x3b,0x63,0xc9,0x66,
+  0x97,0x25,0x77,0x62,0x2f,0x7f,0x29,0x4f,0xac,0xfd,0xd8,0x7c,0x1a,0xf1,0xcd,0x59,
+  0x19,0xc4,0xb8,0x0b,0x72,0x6a,0xe9,0x46,0x7f,0xd0,0x96,0xea,0x91,0xb0,0xd4,0x30,
+  0xd8,0x60,0x25,0x93,0x2b,0x26,0xd0,0xca,0x5f,0x69,0x2a,0xf5,0xcb,0x26,0x96,0xf8,
+  0xba,0xc6,0xb6,0x82,0x11,0x1c,0x34,0x03,0xba,0x67,0x59,0x26,0x43,0xa4,0x6b,0xf2,
+  0x13,0xef,0xcc,0xd7,0x04,0xeb,0xb1,0xa9,0xba,0xe3,0x28,0x3d,0xe6,0x45,0xf6,0x99,
+  0xfe,0xa0,0xd5,0xa3,0x0f,0xad,0x3e,0xee,0x27,0xfc,0x17,0x0c,0x5e,0x29,0x03,0x5d,
+  0xeb,0x2c,0x43,0x7b,0xee,0xf7,0xd7,0x1b,0xbd,0xde,0xa3,0x50,0x20,0x38,0xde,0x7d,
+  0xb0,0x58,0x90,0xc4,0xd0,0xcf,0x85,0xcd,0x52,0xe4,0x0a,0xf1,0xf9,0x32,0xb9,0xfb,
+  0x44,0xf0,0x33,0x20,0xa1,0xbc,0x17,0x75,0xc7,0xd8,0x23,0x65,0x72,0x0f,0x97,0x61,
+  0x20,0x5b,0xc0,0xc8,0x59,0x7b,0x0c,0x1e,0x8e,0xee,0x04,0x64,0x2e,0xe1,0x68,0x72,
+  0x38,0x5b,0xd2,0x11,0xfb,0xcf,0x9e,0x75,0xa6,0xbb,0x28,0xb6,0x40,0x63,0x41,0xf7,
+  0x9d,0x0b,0xd3,0x58,0x98,0x5b,0x26,0x1c,0x37,0xfb,0xbc,0x61,0x58,0x5d,0x38,0x11,
+  0x9a,0x93,0xe1,0x0d,0xca,0x92,0x5b,0x8d,0x56,0x4f,0x6d,0xf2,0x88,0x1b,0x03,0x32,
+  0xcf,0xae,0xab,0x44,0x3f,0x95,0x93,0x55,0x88,0x0a,0x34,0x80,0x1d,0x0a,0xb6,0x70,
+  0xe4,0x5c,0xca,0x16,0x5d,0x64,0x03,0x90,0x93,0x29,0xd5,0xc3,0xd8,0x42,0x81,0xbd,
+  0x0d,0x7b,0xd3,0xab,0x1b,0xbc,0xb9,0xdb,0xf2,0xc4,0xc6,0x18,0x4e,0x75,0x2e,0x1e,
+  0xed,0x9d,0xf9,0xa5,0x21,0x27,0x33,0x36,0x1d,0x3a,0x1c,0x77,0x1e,0x49,0xc6,0x0c,
+  0x4a,0x22,0x6d,0x7a,0x94,0x44,0xcd,0x61,0x47,0x3e,0x27,0xb1,0xf8,0x1d,0x4f,0x1f,
+  0xe3,0x24,0xe2,0x74,0x99,0x68,0xec,0xc6,0xc9,0xfa,0x11,0x75,0x98,0x39,0xf7,0xd5,
+  0x67,0xb6,0x27,0x32,0x3f,0x14,0x6c,0x2b,0x95,0xc3,0xd3,0x4d,0xe7,0x96,0x27,0x0b,
+  0x81,0x25,0x55,0xc3,0x33,0xdf,0x78,0x10,0x3a,0x87,0x45,0x08,0xb5,0xf5,0x89,0x2e,
+  0xe1,0x1a,0x45,0x91,0x30,0x8f,0x4d,0x1a,0x8f,0x00,0x19,0x0c,0xdc,0x01,0x36,0x41,
+  0xa2,0x3a,0x4d,0xeb,0x95,0x23,0xd9,0x09,0x8e,0x87,0x4c,0xfd,0x42,0x19,0x12,0xe0,
+  0x59,0xad,0xbb,0x6c,0x92,0xf1,0xec,0x0a,0x05,0x46,0x5f,0xe2,0xcd,0xf0,0xb9,0x57,
+  0xbe,0x1f,0xf1,0xe5,0xde,0xb5,0x6a,0xbb,0x57,0x3a,0x61,0x37,0xb0,0xb0,0xa1,0x35,
+  0xfe,0xbc,0x00,0x09,0x24,0x3b,0xe8,0x5c,0x7c,0x40,0x56,0x3d,0x3b,0x3f,0x6d,0x87,
+  0x5c,0x74,0x33,0x4c,0x65,0xb4,0xaf,0x06,0x54,0x38,0x6a,0xc4,0x16,0xc1,0x29,0x7e,
+  0x4a,0x30,0xca,0x75,0xc6,0xe5,0x88,0xed,0xdc,0x6e,0x16,0xec,0x6c,0xf6,0x20,0x53,
+  0x53,0x2f,0x0e,0xd4,0x02,0x32,0x8f,0x38,0x3a,0x72,0x70,0xf3,0x70,0xf6,0x90,0xec,
+  0x2c,0x79,0xf5,0xde,0x8a,0x79,0x33,0x9d,0x8b,0x7e,0x9b,0x82,0x98,0xb5,0xeb,0x1f,
+  0x67,0x55,0xee,0xa8,0xeb,0xa2,0xcb,0x4f,0xb1,0x72,0x38,0x77,0xc3,0x88,0x9f,0xab,
+  0x48,0xce,0xf1,0xbd,0x77,0x54,0xbc,0x82,0x3e,0x91,0xf8,0xcc,0x5c,0x60,0x1f,0xc3,
+  0x01,0x87,0x9c,0x22,0x9f,0xcf,0xaa,0x11,0x08,0x33,0xd8,0xe6,0x73,0x62,0x47,0x08,
+  0x79,0x40,0xef,0x87,0x00,0x5a,0x5c,0x87,0xd6,0x5e,0x1c,0xa0,0xa4,0x3d,0x8a,0x23,
+  0x4a,0x5a,0xb5,0x99,0x8b,0x53,0x18,0xf0,0xd3,0xd6,0x2a,0x6a,0x6c,0x61,0x52,0x0a,
+  0x3a,0x8f,0xed,0x05,0x60,0x1f,0xd6,0xb0,0x4a,0x1c,0xe0,0xb4,0xe4,0x35,0x5f,0xd6,
+  0x70,0xb3,0x7e,0xaf,0x60,0x29,0x2d,0x6b,0xea,0x13,0x8b,0xd4,0x6a,0x94,0xb2,0x13,
+  0xfe,0x73,0x6c,0x91,0x64,0x38,0xfb,0x87,0x73,0x34,0x38,0xed,0xf4,0xe5,0x08,0x17,
+  0x92,0x80,0xef,0x07,0xad,0xf2,0xc0,0xec,0x14,0x7c,0xb0,0xce,0xee,0x9e,0x60,0x1b,
+  0x7e,0x6b,0x37,0xb5,0x4a,0x14,0x41,0xb3,0xfe,0x10,0x81,0x5c,0xf2,0x1e,0x65,0xc1,
+  0x1e,0xf7,0x5a,0xa1,0x7d,0xa0,0x3c,0xc8,0x91,0x1e,0x60,0xde,0xa2,0x60,0x65,0x6b,
+  0xd5,0xa3,0xcc,0x14,0x91,0x1d,0x9b,0x5f,0x76,0x7e,0xda,0x96,0xec,0xf4,0xa4,0x62,
+  0x62,0xc9,0x12,0xbf,0x59,0xc2,0x60,0x55,0xff,0x64,0x21,0x9a,0xd1,0xd7,0x8d,0x82,
+  0x2f,0xe2,0x60,0x27,0x06,0x2b,0x8e,0x74,0xbd,0xec,0xcd,0xcf,0x00,0x1a,0x82,0x8a,
+  0xcf,0x7e,0x34,0x70,0x6c,0x3b,0x60,0x7e,0x06,0x8a,0x77,0xa4,0xd1,0x47,0x36,0x11,
+  0x90,0x4a,0x52,0xc2,0xed,0xc0,0x07,0x63,0x84,0xee,0xf3,0x57,0x9a,0xfd,0x6b,0x5e,
+  0x9e,0xea,0xa6,0x23,0x55,0x37,0xd8,0xb8,0x75,0x0e,0xa3,0x32,0xab,0x35,0x32,0xf6,
+  0x22,0x7f,0x52,0xe3,0x1b,0x0c,0x62,0x0e,0x7b,0x77,0x59,0xdd,0x92,0x86,0xc6,0xec,
+  0x9b,0x2a,0xf0,0x48,0x07,0x33,0xf3,0x7e,0xdd,0xea,0xc4,0xfc,0x2e,0x8d,0x6a,0x0f,
+  0x07,0x19,0xc1,0x45,0x6d,0x6e,0xf2,0x96,0x46,0x88,0x4a,0xec,0x47,0xfe,0x2f,0x4c,
+  0x6b,0x32,0x70,0xc4,0x96,0x13,0x8d,0xe7,0x2a,0xb7,0x95,0x75,0x46,0x8a,0x5e,0x4f,
+  0xce,0xcc,0x09,0x46,0xb5,0x29,0x89,0x33,0x8f,0x98,0x74,0x7b,0x7a,0xb7,0x62,0xfb,
+  0x4a,0x44,0xdc,0x58,0x89,0x0b,0xc6,0x8c,0x35,0xdd,0x7e,0xd4,0x30,0x14,0x23,0x41,
+  0xcc,0x23,0xda,0x36,0x20,0x9c,0xf9,0x23,0xb0,0x78,0x98,0x03,0xb9,0x1a,0x70,0xd9,
+  0x76,0x44,0x9a,0x30,0x1f,0x16,0x8e,0xae,0xec,0x68,0xe3,0x97,0x7c,0x90,0x66,0x22,
+  0xa1,0xe3,0x1d,0xc0,0x08,0x60,0x7d,0xa4,0xb9,0xd1,0x5c,0x2a,0x45,0x58,0x91,0xae,
+  0x3b,0x88,0xba,0xb7,0xbf,0xfd,0x32,0x2d,0xa4,0x93,0xb3,0x3b,0x74,0xde,0x62,0xc0,
+  0x57,0x6a,0x30,0x63,0xb0,0x15,0xe0,0x8b,0x08,0x5b,0x3e,0xc6,0x41,0x6d,0xc7,0xfc,
+  0x93,0x02,0x03,0x1c,0x93,0x55,0x34,0xfa,0x75,0x26,0x24,0xf2,0xcd,0xf8,0x90,0xb3,
+  0x67,0x00,0xa9,0xbb,0xb1,0x0d,0x87,0xec,0x2b,0x55,0x66,0x8a,0x56,0xdf,0x05,0xd2,
+  0x12,0x7f,0x92,0xa4,0x4d,0x01,0x68,0xc5,0xbb,0xd8,0xdb,0x97,0xb7,0x63,0x37,0xb4,
+  0x3d,0xd5,0x95,0xa8,0x64,0x38,0xb3,0x30,0x54,0x69,0x86,0xc9,0x36,0x58,0x47,0xbe,
+  0x10,0x8a,0x6d,0x9a,0x7a,0x5b,0xc4,0x89,0x27,0x52,0xd1,0x02,0x30,0xc9,0x67,0xc0,
+  0xd0,0xf0,0xf5,0x63,0x9a,0xf9,0x93,0xdd,0x38,0xd2,0xde,0xb4,0x98,0x0c,0x55,0x31,
+  0x4b,0xa3,0xd8,0xe9,0xcf,0x95,0x60,0x68,0xc0,0xce,0x82,0x92,0xc6,0x7b,0x06,0x7d,
+  0x76,0xfe,0xa3,0x7c,0xed,0xa5,0x96,0xe6,0xe6,0xc3,0x07,0xa7,0x74,0xa9,0x44,0xd4,
+  0xdd,0x51,0xbb,0xa7,0x10,0x5d,0x8f,0xa4,0xd8,0x4b,0x3c,0x7d,0xcc,0x1b,0x75,0x4c,
+  0x7c,0xa9,0xc1,0xc3,0xb1,0xa1,0xf4,0x9f,0x67,0xd2,0x68,0x5b,0xd4,0xe7,0xde,0x5b,
+  0x2a,0xc3,0x44,0x31,0xd9,0xe3,0x76,0xa2,0xa2,0x6f,0x35,0x9e,0xf1,0x9f,0x4f,0x57,
+  0xd3,0x32,0xd5,0x71,0xb9,0x1c,0x2f,0xf9,0x0f,0x68,0x9a,0x99,0xfd,0x72,0xbc,0xe6,
+  0x3f,0xa0,0x69,0xae,0x9a,0x66,0x33,0x2d,0x70,0xd0,0xb5,0x50,0x6d,0xf3,0x89,0x27,
+  0x71,0xa9,0x9b,0xd6,0x9e,0xc4,0x27,0xd5,0xb4,0xf0,0x4d,0x5c,0xa9,0xa6,0xa5,0x31,
+  0x71,0x50,0xb6,0x56,0x6d,0x4f,0xbe,0x8d,0x93,0x44,0x0f,0x7a,0xe6,0x89,0x9c,0x68,
+  0x87,0xac,0x7d,0x23,0x27,0xda,0x25,0x6b,0x63,0xe5,0xc3,0x1f,0x4b,0x9a,0xe5,0x24,
+  0xfa,0x3c,0x6c,0x74,0xcb,0x84,0x21,0xcf,0xc7,0x5e,0xf7,0x2a,0x83,0x1e,0x2e,0xc3,
+  0x1e,0x2e,0x67,0xd6,0x24,0x86,0xbc,0x5d,0xce,0x87,0x98,0x08,0xfb,0xbd,0x0c,0xfb,
+  0xbd,0x5c,0x9a,0xe8,0x0a,0x4e,0x40,0x19,0x9e,0x80,0x72,0x65,0x45,0x62,0x78,0x36,
+  0xca,0xb5,0x17,0xa5,0xc1,0xe9,0x29,0x6f,0x4c,0x4f,0x79,0x63,0x7a,0x4a,0x64,0x7a,
+  0xb0,0xf9,0x59,0xaf,0x67,0x70,0x7e,0x8a,0xe0,0xfc,0x14,0xe1,0xf9,0x29,0xc2,0x2b,
+  0xa0,0xb8,0xb1,0x02,0x8a,0xf0,0x4c,0x14,0xe1,0x15,0x50,0x84,0x27,0xa0,0xb8,0xb1,
+  0x02,0x8a,0xf0,0x0a,0x28,0x6e,0xb8,0xb8,0xb8,0xe1,0xe2,0x02,0x75,0xb1,0x4a,0xfa,
+  0xe0,0x25,0x1c,0x00,0x00,0x6d,0xd7,0xd0,0x2e,0x3d,0xf6,0x00,0x59,0x6d,0x46,0x62,
+  0x2f,0x53,0x14,0x79,0x9a,0x1f,0x0d,0xc8,0x0c,0x02,0x4e,0xbe,0x4f,0x58,0x5d,0xc5,
+  0x46,0x6f,0xf5,0x14,0x5b,0x09,0xe8,0x07,0x2a,0xca,0xeb,0x15,0x87,0x2a,0x40,0x8e,
+  0x29,0x35,0x4f,0xe6,0x06,0xc4,0xe8,0xbc,0xde,0xdb,0x89,0x18,0x24,0x4b,0xcd,0xd5,
+  0xfb,0x25,0x42,0x20,0x82,0x01,0xbc,0x1e,0x29,0x10,0x9a,0x76,0x59,0x55,0x0b,0x14,
+  0xb4,0x0d,0x97,0x3c,0xbb,0x7a,0xaf,0xeb,0x05,0x55,0x15,0x5e,0x79,0x21,0x1e,0x42,
+  0xd0,0xe1,0x00,0x21,0x1d,0x7e,0x64,0x9b,0x9a,0xd8,0x70,0x63,0xfd,0x68,0xef,0xc3,
+  0x18,0x3f,0xc4,0x63,0x28,0x48,0x03,0x9d,0x86,0x25,0x35,0xf8,0x73,0x9a,0x2c,0xf4,
+  0x9a,0x72,0x5c,0xbd,0x5e,0x58,0xab,0xd0,0xd0,0x05,0x8c,0x94,0x3d,0x50,0xb4,0x9a,
+  0x44,0xfc,0xe5,0x03,0x80,0x77,0x8e,0xd9,0x12,0x94,0x43,0xf4,0x3d,0x33,0x53,0x6a,
+  0xe3,0x3a,0xc9,0xbd,0xcb,0x0b,0x1a,0x3e,0xd8,0xd8,0x70,0xef,0x8d,0x1e,0x48,0x55,
+  0xe6,0x5f,0xcc,0xd4,0x8c,0xe4,0xad,0x80,0x1b,0x13,0x24,0x25,0x07,0x41,0x94,0xc3,
+  0xad,0x01,0xd9,0xd0,0x33,0xbe,0x35,0xc4,0x9b,0xa3,0x09,0x95,0xd0,0xdf,0x27,0x0c,
+  0x73,0xa6,0xae,0xa4,0xde,0x66,0x1a,0x8e,0x73,0x21,0xcb,0xde,0x9e,0x04,0x4f,0x13,
+  0xca,0xe4,0x1e,0x06,0xd1,0xd0,0x7b,0x5a,0xae,0xf0,0xd0,0x53,0x59,0x36,0xd1,0x59,
+  0xc3,0x8f,0xb1,0x05,0x6f,0x7a,0x63,0x53,0xc1,0x64,0xae,0x8d,0x4c,0x11,0x23,0x05,
+  0x8b,0xf1,0xdb,0x8b,0x58,0x16,0x16,0x54,0xde,0x15,0xaf,0xac,0x82,0x8b,0x18,0x1b,
+  0xe2,0x7a,0x3d,0x65,0xe6,0x88,0x6b,0x51,0x38,0x32,0x11,0x66,0xf0,0x6e,0xe7,0x32,
+  0x64,0x47,0x58,0x6e,0xff,0x96,0x89,0xa6,0x0e,0x29,0xce,0xd7,0x30,0x7f,0x27,0xa0,
+  0xdc,0x61,0xa5,0xf1,0xc4,0xf1,0x80,0x9b,0xb1,0xe5,0x64,0xca,0xda,0xa6,0xac,0x96,
+  0xaa,0x54,0xe9,0x1c,0xb7,0xc1,0x59,0x6a,0x28,0xf9,0xa8,0x6e,0xe2,0xde,0x8c,0xac,
+  0xeb,0xaa,0xce,0xaa,0x54,0xa8,0x0e,0x45,0x3c,0x76,0x99,0xf9,0xae,0x48,0xeb,0xbc,
+  0x1f,0x38,0xc1,0xcb,0xe3,0xbd,0x3a,0xeb,0xab,0x11,0x6d,0xb5,0xf4,0x37,0x4e,0xed,
+  0x8b,0x47,0x63,0xea,0xf4,0xfa,0x00,0x0b,0xc1,0x4c,0x2a,0x17,0xd9,0xfb,0x15,0x2f,
+  0x58,0x55,0xb8,0x3a,0x5d,0x84,0x7a,0xa4,0x8f,0x36,0x4b,0x76,0xb2,0x14,0x49,0x4b,
+  0x6f,0xeb,0x32,0xbe,0xf2,0x3b,0xbe,0xa5,0xd1,0x76,0xb3,0xee,0xab,0x76,0x44,0xbf,
+  0x9b,0x5c,0x69,0x9f,0xa4,0x62,0xfe,0x61,0xb8,0xb9,0x23,0x3e,0xf1,0xab,0x67,0x9f,
+  0x47,0xac,0x21,0xe6,0xff,0x3c,0x8a,0xd7,0x2b,0xb7,0x59,0x6c,0xc5,0x81,0x71,0x5a,
+  0x6a,0x03,0x5a,0xdf,0xd6,0x89,0xab,0x0c,0x79,0x48,0xeb,0x54,0x9e,0xfa,0x3f,0x2a,
+  0xc5,0x75,0x32,0xd9,0x41,0x17,0x0f,0xae,0x15,0x81,0x1b,0xf4,0xde,0x9b,0xee,0xf5,
+  0xb4,0xca,0xb9,0x7e,0x5b,0xb1,0x59,0x1c,0xff,0x8f,0xba,0x87,0xc2,0x01,0x28,0x64,
+  0xaa,0x36,0x59,0x32,0xb7,0x2b,0xef,0xb7,0xfa,0xb6,0x27,0x52,0x85,0xfb,0x5b,0x6f,
+  0x50,0xc2,0x6c,0xc3,0x7b,0x1e,0xdd,0xae,0x3d,0xe2,0xbb,0x46,0x61,0xc9,0xbc,0x49,
+  0x8b,0xe0,0xdb,0x2b,0x99,0x43,0x24,0xc4,0xb0,0x59,0xa6,0x6a,0x7f,0x11,0x1c,0xf1,
+  0xc0,0xab,0x72,0xbc,0xcd,0x3c,0x87,0xcc,0x6a,0x37,0xb2,0x39,0x56,0x16,0xc7,0x2b,
+  0xc6,0x22,0x10,0x3b,0xe0,0x41,0x99,0x66,0x53,0x0d,0xca,0x40,0xad,0xc5,0xad,0xbd,
+  0xfc,0xc1,0xaa,0x70,0xb8,0x0d,0x43,0x91,0xc3,0x6b,0x81,0x15,0x10,0xbf,0x9b,0x53,
+  0x11,0x71,0x19,0x6e,0xb5,0xb1,0x2c,0x3d,0x5c,0xf2,0xe2,0x6f,0x9b,0x9d,0x62,0xd5,
+  0x50,0x81,0x1a,0xd8,0xc6,0x09,0xbf,0x7d,0x69,0xbc,0x22,0x5b,0xd5,0x1e,0x27,0xaa,
+  0xc3,0xe0,0xd0,0xa3,0x5f,0x51,0x81,0x43,0x4f,0xa6,0xca,0x4c,0xec,0x03,0x0f,0x3d,
+  0xeb,0xea,0xce,0xb7,0xba,0x6a,0xf9,0x8d,0xe7,0xf8,0x43,0x5a,0x9f,0x9b,0x9c,0x45,
+  0x67,0x45,0x5f,0x3e,0x6c,0xb1,0x6b,0x48,0xbc,0x7f,0x0f,0x8b,0xa2,0x78,0xc1,0x17,
+  0x16,0x16,0xa7,0xc3,0x0b,0x4d,0xb1,0x3a,0xe7,0xc3,0x8b,0xb3,0xf9,0xb7,0x3f,0xfd,
+  0x79,0x91,0x6c,0x5f,0x58,0xeb,0x88,0xbf,0x94,0xdf,0xec,0x1a,0x4a,0x9e,0x47,0xfc,
+  0x79,0x50,0x27,0xcc,0x95,0xc2,0xd3,0x26,0x2f,0xdb,0xba,0xda,0x86,0xee,0x8e,0xd8,
+  0x2f,0x75,0xe7,0xde,0x4b,0x5d,0x4e,0x01,0xa3,0x9a,0x98,0x52,0x15,0x51,0xb3,0xcc,
+  0x3f,0x8c,0xa6,0xf6,0x65,0x00,0x66,0x7f,0xb4,0x40,0x5e,0xf7,0x2f,0xf9,0x65,0x00,
+  0xde,0x38,0xc1,0x2e,0x03,0x4c,0x1f,0x07,0xd1,0x23,0x59,0x47,0x11,0x6b,0x57,0xcb,
+  0x45,0x6e,0x1d,0xcc,0x03,0xb2,0xc4,0xad,0x83,0xf9,0x5b,0xb7,0x0e,0xf8,0x1d,0xbf,
+  0x9e,0x54,0x79,0x29,0xaf,0x4f,0x28,0x4a,0x34,0x6d,0xa3,0xbc,0xda,0xe7,0x15,0x03,
+  0xf9,0x11,0xcf,0x29,0xa4,0xb9,0xfe,0xf1,0x99,0x5e,0xf6,0x0d,0x29,0x69,0x1b,0xe9,
+  0x7e,0xc9,0xa7,0x7e,0x48,0x83,0x4d,0xdd,0x89,0xac,0x9f,0xd1,0xc3,0xe3,0x95,0xc3,
+  0x0f,0xbf,0x6d,0xb6,0x58,0x8b,0x56,0xa9,0x5a,0x6a,0xa5,0x2c,0x9c,0xb8,0xaf,0x81,
+  0x11,0x92,0xc0,0x06,0x35,0x18,0x01,0xb5,0x2b,0x7e,0xa6,0xc0,0xbc,0x11,0xbe,0x2e,
+  0xc0,0xd3,0x44,0x6a,0x1f,0x1a,0x6d,0x75,0x8a,0x0e,0xf4,0x71,0x4a,0x94,0x8c,0x57,
+  0x2d,0xd4,0xc2,0x89,0x3d,0xbf,0xe9,0x0f,0x04,0x45,0x0c,0xfd,0x0d,0x5a,0x6c,0xb1,
+  0x1c,0xc9,0xf9,0x6f,0x2c,0x06,0x25,0x8a,0x8f,0xb1,0x31,0x55,0x73,0x4b,0xd5,0xd0,
+  0x24,0x15,0x8a,0x8b,0xd4,0x33,0xf1,0xda,0xc6,0xd6,0x2d,0xb7,0xc5,0x90,0x05,0x36,
+  0x80,0x08,0x9b,0x20,0xde,0x23,0x05,0x6c,0x10,0x32,0x84,0x11,0xb2,0x26,0x82,0x59,
+  0xa1,0x90,0x57,0xc8,0x0c,0x07,0x54,0x84,0xed,0x10,0x8c,0x21,0x43,0xa4,0x14,0x61,
+  0x89,0xaa,0xc5,0x60,0xa6,0x68,0x28,0x17,0xb2,0xc5,0x45,0xe3,0x61,0x63,0x24,0x67,
+  0xc8,0x1a,0x25,0x47,0x98,0xa3,0x6f,0xbe,0x63,0xf6,0x18,0xf8,0x10,0x32,0xe8,0x67,
+  0xcd,0x94,0xf4,0x9e,0x76,0x41,0x4e,0xc6,0x4b,0x4c,0x37,0x6f,0x53,0x71,0x61,0xd6,
+  0x53,0x9b,0x92,0x82,0x2d,0xb5,0x47,0x19,0x15,0x0e,0x79,0xe2,0x2e,0x30,0x79,0x0d,
+  0x02,0xbc,0x50,0x14,0x99,0x58,0x8c,0x35,0xa2,0xa4,0xe5,0x0c,0xfc,0xc6,0xef,0xd5,
+  0xeb,0xb3,0x11,0x57,0xa9,0x7b,0xb4,0x0c,0x20,0xcf,0x26,0x72,0x98,0x20,0x4f,0xe9,
+  0x81,0xab,0xef,0x52,0x98,0x2b,0x1b,0x4b,0x89,0xd0,0x15,0x81,0x5f,0x07,0xf6,0x3b,
+  0x71,0xaa,0xd3,0x71,0x62,0xe9,0x61,0x27,0xb7,0x57,0x20,0x73,0xba,0xb0,0x64,0xb2,
+  0x23,0x25,0x68,0x7c,0x5a,0xc8,0xae,0x87,0x86,0x5e,0x84,0x5f,0x78,0xe7,0x58,0x52,
+  0x88,0x43,0x91,0x56,0x18,0x4e,0x70,0xb5,0x48,0xb7,0x10,0xd8,0xd2,0xef,0xf3,0x82,
+  0x45,0xe8,0xc6,0x90,0x3f,0x73,0xdf,0x3c,0x3a,0xfa,0x6c,0x5d,0x7e,0x9f,0xa7,0x05,
+  0xeb,0xe2,0x58,0x98,0x57,0xae,0x85,0x6c,0x4c,0x5e,0xcf,0x01,0x54,0xb7,0xf4,0x94,
+  0x13,0xcd,0x20,0x1e,0x06,0xb1,0xe2,0xd1,0x19,0xa2,0xa0,0xd9,0x83,0x90,0xbd,0xe4,
+  0x00,0x40,0xb7,0x41,0xaf,0x64,0x18,0x74,0x76,0x79,0x75,0x81,0x77,0x8d,0xd9,0x2a,
+  0x70,0xeb,0x04,0xce,0x57,0x50,0xf8,0x5e,0xee,0x96,0x9b,0x24,0x00,0xb4,0xaf,0x51,
+  0x3b,0x3c,0x12,0xb9,0xd9,0xf7,0x9c,0xdd,0x00,0x7c,0x75,0x99,0xf8,0x05,0x09,0x47,
+  0xce,0xab,0xc7,0xc4,0x6f,0x5e,0x7b,0x4c,0x1e,0xd7,0x7c,0xe5,0x71,0xfd,0xe3,0x5c,
+  0xee,0x6a,0xc0,0xb2,0x9c,0xfb,0x26,0xf1,0xf4,0x28,0xcb,0x59,0xbd,0xf3,0x62,0xd4,
+  0x11,0x26,0x92,0x97,0xcf,0x29,0xc8,0x9e,0xde,0xb6,0xcb,0xf7,0x17,0xc8,0xa6,0x48,
+  0x0e,0xa3,0x2c,0xa0,0xf9,0x25,0x35,0xd7,0x48,0x85,0xac,0x12,0x73,0x4b,0xda,0x2d,
+  0xf0,0x09,0x32,0x7e,0xb1,0x38,0x20,0x8b,0x6f,0x5f,0xf8,0x55,0x6b,0xbb,0x0f,0xe8,
+  0x62,0xea,0x1d,0xe1,0x1b,0x52,0x01,0x65,0x62,0x9f,0x82,0xf0,0xf0,0x3d,0xea,0xe4,
+  0x9e,0x02,0x1f,0xde,0x50,0xc6,0xc6,0xc1,0xef,0x07,0x80,0x51,0x2d,0x6f,0xab,0xe1,
+  0x03,0x00,0x3d,0xd4,0x88,0x96,0x37,0x95,0x70,0xf3,0x41,0x1f,0x31,0x9a,0x9b,0x6a,
+  0x84,0xe5,0xa0,0x87,0x1c,0xc9,0x6d,0x25,0xea,0x4b,0x7d,0x06,0xcc,0xbb,0x47,0x00,
+  0xbf,0x00,0x06,0x0e,0x03,0xae,0x30,0xc9,0x61,0xbe,0xdd,0xe5,0x2f,0xa6,0x41,0x78,
+  0x58,0x0f,0x64,0x54,0x71,0xf0,0x5e,0xcd,0x72,0xf6,0x61,0x01,0x2f,0x2c,0x5a,0xce,
+  0xb9,0x55,0xd4,0xc3,0x04,0x6b,0xc0,0x2f,0x53,0x97,0x3e,0x88,0xcc,0xe5,0x2d,0x6c,
+  0x47,0xb2,0x6a,0xf5,0x2e,0x80,0xe0,0x6c,0x2a,0x8d,0x69,0x66,0x9e,0x0b,0xa3,0xe9,
+  0x3c,0x6c,0xc1,0x64,0x69,0xd5,0x76,0x9d,0xc9,0xd1,0x4d,0xb8,0x8f,0xa0,0x9c,0xe9,
+  0xdc,0x92,0x63,0xab,0x74,0xe5,0xdc,0x32,0x68,0x36,0xb5,0x5f,0x68,0x4c,0x6f,0x09,
+  0x9a,0x4d,0x83,0x06,0xcd,0x57,0x96,0x1c,0x3b,0xbb,0xba,0x72,0xe6,0xab,0xb0,0x41,
+  0x4b,0x7b,0x64,0xcb,0x9b,0x23,0x5b,0xde,0x18,0x19,0xeb,0x7d,0x5b,0xd8,0xd5,0xe5,
+  0xbe,0x39,0x06,0x5f,0xf8,0x4d,0xd7,0x79,0xc2,0x6f,0xce,0xd8,0x90,0x2b,0xc0,0xe5,
+  0x09,0x2c,0x31,0xa8,0x66,0x77,0x17,0x79,0x00,0xf7,0x24,0xe5,0xfe,0x3f,0x5c,0x6f,
+  0x04,0xde,0x43,0xaf,0x4d,0x7a,0x69,0x71,0xf8,0xfa,0x2c,0xc0,0x16,0xbc,0xaa,0x14,
+  0xba,0x02,0x0a,0x7a,0xb8,0xc2,0xfc,0xce,0xf6,0xd5,0x6d,0xc8,0xff,0xf5,0x4b,0xf4,
+  0x8d,0xcb,0x13,0x5f,0xe9,0x16,0x68,0x95,0x7f,0x6f,0x0d,0xd8,0x20,0x9e,0xef,0x1b,
+  0xdf,0x7e,0x9f,0x4e,0x92,0x27,0xd7,0x2a,0xf2,0xcf,0x33,0x81,0x72,0xd9,0xe3,0x7d,
+  0x62,0x93,0x64,0xcf,0x7e,0xbc,0x09,0x28,0xce,0x14,0x88,0xe5,0x8f,0xb6,0x58,0xab,
+  0x0f,0x22,0x76,0x3a,0x59,0x2f,0xff,0x3c,0xf3,0xc2,0x42,0x20,0x09,0x47,0xf8,0x40,
+  0xbc,0xcf,0xf2,0xd5,0xd3,0xb7,0x5f,0x7f,0xfd,0xc5,0xb3,0xbc,0xa9,0x5f,0x2a,0x68,
+  0x3a,0x7f,0xbe,0xcf,0xf6,0xa7,0xf5,0x62,0x31,0x5f,0xb9,0x82,0xd3,0x0b,0x81,0x72,
+  0xf9,0xe3,0xbd,0x9e,0xde,0xa5,0xd9,0x1c,0xf3,0xb4,0x40,0xd6,0x8e,0xbb,0x05,0x0d,
+  0x7e,0x77,0x40,0xd2,0x08,0xc2,0x47,0x2e,0xf7,0x8d,0x6f,0x99,0x3c,0x65,0xab,0x9d,
+  0x6b,0x08,0xd3,0x47,0x2b,0xfb,0x94,0x41,0xef,0x74,0x9c,0xac,0x77,0xe1,0x93,0xee,
+  0x8a,0x07,0xd4,0x3b,0xa7,0x7d,0x97,0xce,0xe6,0xc4,0x55,0x92,0x57,0x59,0x7e,0xa8,
+  0x81,0x7c,0x49,0xb8,0xcf,0xfe,0xd9,0x7e,0x31,0xd9,0x2d,0x5c,0xd1,0xcf,0x47,0xf2,
+  0x9c,0x03,0xc9,0xe2,0xf9,0xce,0xb5,0x9b,0xd0,0xe5,0xca,0x07,0x54,0x79,0x69,0xaf,
+  0x83,0xf2,0xce,0x15,0x90,0x66,0x59,0x3a,0x5b,0x7b,0x67,0x5d,0x96,0xc3,0x0e,0x50,
+  0xb0,0x24,0xdc,0x9b,0x6d,0xd6,0xab,0xc4,0x9b,0xca,0x8c,0xd2,0x93,0x2f,0x1f,0x50,
+  0xef,0xf3,0xf7,0x7e,0xbf,0x78,0x9a,0x4e,0xbd,0x8d,0x29,0xaf,0x9e,0x81,0x74,0xfe,
+  0x78,0x9f,0x58,0xba,0x9e,0xd0,0xa5,0x97,0x7b,0x4e,0xe7,0xe6,0x54,0x40,0xb3,0x25,
+  0xe1,0x3e,0xd1,0xeb,0x74,0xfa,0xb4,0xc3,0xdd,0xe2,0xc9,0x07,0xd4,0x3b,0xd7,0xe7,
+  0xd3,0x8c,0xec,0xbc,0x4c,0xdf,0xa8,0x6f,0x30,0x49,0xe1,0x8d,0xf9,0x06,0xd1,0x7b,
+  0x7d,0x3d,0x9f,0xcf,0x66,0x4b,0x0f,0x6e,0x93,0x0a,0x4a,0xe5,0x8f,0x77,0xc6,0x49,
+  0xb6,0x5f,0x50,0x4f,0x6c,0x47,0x49,0x01,0xc4,0xf2,0xc7,0xfb,0xac,0x4d,0x92,0xf5,
+  0x72,0xe5,0xa5,0xe0,0x0b,0xe5,0x5f,0xd1,0x02,0x82,0x25,0xe1,0xde,0xc8,0xa6,0xbb,
+  0x99,0x97,0xfd,0xc4,0xf5,0x5f,0x20,0x59,0x3c,0xdf,0x2b,0x18,0xd9,0x46,0x49,0xfa,
+  0x6c,0x25,0x6c,0x92,0x3e,0xdf,0xeb,0x89,0x04,0xc9,0xd4,0x17,0xa7,0x1c,0x04,0x36,
+  0x0a,0x67,0x8f,0xf0,0xb7,0x87,0xb7,0xc6,0xb1,0xa6,0xfc,0x37,0x98,0xc5,0x2f,0x58,
+  0x12,0x87,0x06,0x68,0x22,0xc1,0x38,0xef,0x35,0x46,0xbe,0xf8,0xf0,0x16,0x1c,0x69,
+  0x9e,0x5d,0x5b,0x0c,0x0d,0x98,0xa2,0x68,0x04,0xe1,0xbb,0x7b,0xd3,0x9c,0xf0,0x5f,
+  0x1f,0x44,0x17,0xd4,0x59,0x99,0x9a,0x74,0x6f,0xf0,0x64,0xec,0x07,0x15,0xef,0xee,
+  0x9c,0x03,0xf1,0x3e,0x15,0x59,0xc6,0x95,0xa0,0x2a,0xbc,0x85,0x05,0xa8,0x77,0x2f,
+  0x82,0xbd,0x0f,0xc4,0x85,0x38,0x07,0xf6,0x19,0xda,0xfd,0xa3,0xf0,0x17,0x9a,0xac,
+  0x23,0x39,0x20,0x7b,0x20,0xba,0x53,0x8d,0x21,0x69,0xc9,0x6d,0xc3,0x69,0x43,0x73,
+  0x6d,0x0c,0xda,0xe0,0x0c,0xd2,0xd0,0x6c,0x01,0x38,0x3a,0x16,0xcc,0x28,0x44,0x76,
+  0x5a,0x6c,0x61,0x38,0x0e,0x96,0x9a,0x1d,0x30,0x3c,0x10,0x6d,0x11,0x38,0xe2,0x15,
+  0xdc,0x0e,0xec,0x35,0x34,0xd7,0x23,0x18,0xb6,0x35,0xa3,0x77,0xd7,0xaa,0xdd,0x00,
+  0x16,0x2c,0x6c,0x20,0xa1,0x1e,0xee,0xd2,0xc5,0xf1,0xac,0xe8,0xe1,0xae,0x9d,0x81,
+  0x68,0x8b,0xc0,0x91,0x2b,0x70,0x3b,0x2a,0x28,0x88,0x61,0x71,0x8c,0x2a,0xfa,0x78,
+  0x40,0x15,0x50,0x6d,0x21,0x38,0x1a,0x15,0xec,0x2e,0x24,0x1d,0x88,0xb6,0x88,0xdd,
+  0x9c,0x90,0xe0,0xb0,0x4a,0x24,0xc2,0x5c,0x04,0x8a,0x23,0x4c,0xc1,0xec,0xc1,0x40,
+  0x40,0x75,0xd7,0x1b,0x86,0x25,0xd5,0x17,0xe2,0x31,0x40,0xe9,0x36,0xb9,0xe2,0x30,
+  0xd4,0x28,0xfa,0x38,0xd0,0xd1,0xd0,0x6c,0x01,0x38,0x3e,0x94,0xcc,0x2e,0x88,0x03,
+  0x54,0x5b,0x08,0x8e,0x04,0x07,0xcb,0x71,0x49,0x41,0x4c,0x88,0x63,0x3e,0xd1,0xc7,
+  0xde,0x5e,0x34,0xc9,0xf1,0x09,0x8a,0xee,0xe4,0x9f,0x62,0xb3,0x21,0x9e,0xa1,0x39,
+  0x02,0x02,0x38,0x8e,0xff,0xe1,0x27,0x17,0xcc,0x29,0x9a,0x9b,0x01,0x30,0xc4,0x26,
+  0x98,0xbd,0xdd,0x05,0x50,0x6d,0x21,0xd9,0x74,0x47,0x13,0x8a,0x0a,0x71,0x01,0xda,
+  0x40,0xbc,0xb1,0x8f,0x5b,0x69,0xc8,0x86,0x62,0x03,0xf1,0xc6,0xfe,0x63,0x67,0x92,
+  0x0b,0x92,0x48,0xbc,0xe4,0x85,0xe5,0x2d,0x3f,0x65,0x3d,0x2d,0xf8,0xef,0xed,0x7c,
+  0x73,0x09,0xa6,0x1b,0x4f,0x29,0x0a,0xb9,0x9c,0x16,0xc7,0x4d,0x28,0xae,0x92,0x31,
+  0x8a,0x80,0x2b,0xbb,0xc1,0x55,0x8f,0xc1,0x2c,0xbb,0xc1,0xc9,0x6c,0x84,0xff,0x06,
+  0xde,0x98,0xb8,0xbb,0x38,0x24,0x9b,0xca,0x9b,0xfe,0xbb,0x34,0xe1,0xed,0x5c,0x77,
+  0xb3,0x37,0x74,0x40,0x45,0x65,0x05,0xaa,0x61,0xea,0x2d,0x89,0x53,0x14,0x1b,0xa8,
+  0xa8,0x2c,0x7c,0x93,0xd7,0x6f,0x4f,0xb0,0x6d,0xde,0x6b,0x43,0xe5,0x06,0xea,0x5e,
+  0xca,0x1a,0xb7,0xfc,0x05,0xc8,0xa8,0x34,0x7c,0xeb,0xd7,0x3c,0xf6,0xe6,0x0f,0xa8,
+  0x01,0xef,0xa1,0x15,0xae,0xc1,0x4f,0x5e,0xa1,0xcb,0x69,0x82,0xf5,0x2e,0xab,0x89,
+  0x84,0x7b,0x99,0xe0,0xb2,0x6d,0xc1,0x41,0x81,0xe2,0x71,0x77,0x73,0x48,0x46,0xa5,
+  0xe1,0xf8,0xc0,0x9a,0xaf,0x80,0x4c,0x1f,0x23,0x38,0xb3,0x89,0x42,0x05,0xc5,0xe3,
+  0x81,0x05,0x8b,0x8e,0xca,0xc3,0x51,0x83,0xe2,0x71,0x71,0x03,0x24,0xe3,0x6b,0x0b,
+  0x2d,0x5c,0x99,0xa1,0x95,0x68,0xf4,0x96,0x78,0xdc,0xe2,0x58,0x42,0xf1,0x78,0x18,
+  0xc0,0xa2,0x07,0xd6,0x3d,0x06,0x2b,0x14,0x0f,0x0e,0x2c,0xfc,0xc6,0x80,0x64,0x0c,
+  0x61,0x28,0x1e,0x07,0x63,0x00,0x2a,0x2a,0x0b,0x07,0x1b,0xba,0x97,0x0b,0x12,0x2c,
+  0x3a,0x2a,0x0f,0xc7,0x1d,0x70,0x60,0x21,0xa1,0x3e,0xf6,0x70,0x56,0x0c,0x0a,0x41,
+  0xf4,0xbb,0x5b,0x0b,0x84,0x0c,0x44,0xdc,0x7f,0x28,0x1a,0xd1,0x7f,0x34,0xcc,0xc6,
+  0x23,0x80,0x8a,0xcb,0x42,0x81,0x89,0x7e,0xd3,0x6d,0x43,0x13,0x40,0x0d,0xe4,0x27,
+  0x0c,0xa3,0x28,0x1e,0x0f,0xa5,0x58,0xf4,0x40,0x9c,0x60,0xa5,0x24,0xc5,0xe3,0x02,
+  0x16,0x48,0x0e,0x48,0x0b,0x6f,0x3c,0x4e,0x19,0x09,0x90,0x03,0x03,0x4d,0xc2,0x99,
+  0xef,0x82,0x26,0x3e,0x24,0xf7,0xe2,0x69,0x37,0x98,0x71,0xf1,0xba,0x91,0x9b,0x06,
+  0x2f,0x37,0x52,0x24,0x62,0x03,0x8a,0x6c,0xbc,0x36,0xdc,0x9f,0x28,0xc4,0xd1,0x8b,
+  0x01,0x01,0x39,0x6e,0x93,0x6f,0x0d,0x06,0x74,0xdc,0x26,0x7c,0x6d,0xa1,0xd5,0x23,
+  0xbd,0xda,0xfd,0x22,0x92,0xd3,0x12,0x8a,0xbe,0x27,0xfa,0x84,0xdf,0x20,0x41,0x0b,
+  0x47,0x5e,0x1b,0x9e,0xb0,0x9e,0xb8,0xe0,0x5b,0xa6,0x86,0x56,0x8a,0x5f,0x34,0xf2,
+  0x02,0x7c,0x1f,0xba,0xf2,0x82,0x55,0x88,0xdc,0xa6,0xa0,0xb9,0x08,0xe4,0x3f,0xd2,
+  0x92,0x46,0xe0,0x4c,0x10,0x81,0xa2,0x52,0x14,0xaa,0x8e,0x47,0xde,0xa8,0xbb,0x2a,
+  0xea,0x23,0xe7,0xba,0x07,0xbf,0x4d,0x19,0xb1,0xf6,0x23,0xcd,0xdb,0x23,0x91,0x7f,
+  0xa4,0xae,0x8f,0xf4,0x77,0x16,0x22,0xf1,0x3d,0x27,0xd6,0xfe,0x31,0x2d,0xf2,0x1e,
+  0xa8,0xda,0x44,0x62,0xbd,0x6e,0x23,0xa9,0x32,0x12,0x89,0x60,0x1b,0xc9,0x3b,0x8b,
+  0x91,0xf8,0x1a,0x54,0xa4,0xbe,0x13,0x15,0xcd,0x13,0xeb,0xb2,0x1a,0x17,0xf7,0xbf,
+  0x2e,0xe6,0x9b,0x2f,0x57,0x5c,0x00,0x00,
+};
+static const char webCSS[] PROGMEM = "<link rel=\"stylesheet\" href=\"/heishamon.css?v=3e6647b2\">";
+
+static const uint8_t webAsset_menu_js[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x7d,0xcc,0x41,0x0a,0xc2,0x30,
+  0x10,0x85,0xe1,0x7d,0x4f,0xf1,0xc8,0x2a,0xdd,0xe4,0x02,0x92,0x8d,0xe0,0x42,0xd0,
+  0x43,0xd4,0x64,0x22,0xc1,0x71,0x52,0x4c,0x52,0x1a,0xc4,0xbb,0x6b,0x6b,0x77,0x82,
+  0x30,0x8b,0x59,0x7c,0xef,0x07,0x42,0x15,0x57,0x62,0x12,0xa4,0x91,0xe4,0x44,0xa1,
+  0x9c,0x49,0xaa,0xee,0xf1,0xec,0x00,0x4c,0xc3,0x03,0x33,0x2c,0x7c,0x72,0xf5,0x4e,
+  0x52,0xcc,0x95,0xca,0x81,0x69,0x79,0xf7,0xed,0xe8,0xb5,0xe2,0x6d,0xa0,0xfa,0xdd,
+  0xe2,0x63,0x80,0x9e,0x4d,0x2e,0x8d,0xc9,0xf8,0x98,0x47,0x1e,0x1a,0xac,0xb5,0x50,
+  0x92,0x84,0xd4,0x16,0x05,0x7e,0x08,0xd4,0x85,0x93,0xbb,0xa9,0x35,0xf2,0x02,0x71,
+  0xa6,0x3f,0x76,0x8d,0x7d,0x69,0xf7,0xb9,0x37,0xd8,0x05,0x3e,0x04,0xc4,0x00,0x00,
+  0x00,
+};
+static const char menuJS[] PROGMEM = "<script src=\"/menu.js?v=2915fcb5\"></script>";
+
+static const uint8_t webAsset_websocket_js[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xa5,0x58,0x6d,0x77,0xd3,0x36,
+  0x14,0xfe,0xce,0xaf,0xd0,0xbc,0xb1,0xda,0x4d,0xea,0xa4,0x8c,0xed,0x74,0x09,0xa5,
+  0x67,0x40,0x0a,0xec,0x94,0x6d,0x67,0x29,0x1b,0xe7,0xb4,0xfd,0xa0,0xd8,0x72,0x6c,
+  0x50,0xac,0x4c,0x92,0x49,0x0a,0xc9,0x7f,0xdf,0xbd,0xf2,0x9b,0xdc,0xb8,0x26,0x1c,
+  0xfa,0xa1,0xb1,0xa4,0xfb,0xf2,0xe8,0xea,0xbe,0xe8,0x8a,0x90,0x8f,0x54,0x92,0xd9,
+  0x73,0x91,0xa6,0x2c,0xd0,0x2c,0x24,0xa7,0x24,0xa2,0x5c,0xb1,0xf1,0x03,0x62,0x56,
+  0xb8,0x98,0x9f,0x0b,0xb9,0xa0,0x5a,0xc1,0x4a,0x9a,0x71,0x6e,0x2d,0xfc,0xc5,0xd2,
+  0x30,0x49,0xe7,0xb0,0x70,0x75,0x33,0x7e,0x00,0xf3,0x83,0x43,0xb2,0x94,0x49,0xaa,
+  0x23,0x12,0x09,0x49,0x74,0xcc,0xc8,0x2c,0x49,0xa9,0xbc,0x45,0x62,0x22,0x59,0x20,
+  0x64,0xa8,0xfa,0x44,0x31,0x46,0x94,0x0c,0x06,0x81,0x58,0x2c,0x44,0x3a,0x80,0x35,
+  0x3f,0x58,0x2e,0xc9,0xe1,0x00,0x24,0x44,0x59,0x1a,0xe8,0x44,0xa4,0x40,0x9d,0x86,
+  0x4c,0x5e,0x88,0xf9,0xdf,0x86,0xcd,0x9d,0x65,0x91,0x47,0x3e,0x03,0x05,0x21,0x9c,
+  0x69,0xf2,0x31,0x61,0x2b,0x04,0x04,0xff,0x5f,0x50,0x4d,0xff,0x81,0xa1,0x21,0x19,
+  0x57,0x14,0x3a,0x59,0x30,0xa0,0x40,0x42,0x7f,0xce,0xf4,0x5b,0x80,0xf5,0xd3,0x23,
+  0xf7,0xb8,0x4f,0xb4,0xcc,0x98,0x45,0xb7,0x48,0x38,0x4f,0xd4,0x2e,0xe5,0xcf,0x3b,
+  0x94,0x49,0xb8,0x4b,0xf5,0xeb,0x0e,0x55,0xb4,0xd0,0x40,0x56,0x9b,0xed,0xca,0x75,
+  0x86,0xf9,0x9f,0x43,0x7a,0x20,0xc3,0xd7,0x62,0xaa,0xc1,0x48,0x73,0xf7,0xf8,0x17,
+  0xcf,0xf3,0x15,0x4f,0x02,0xe6,0x1e,0x9d,0x78,0x37,0xb5,0x88,0xa5,0x40,0x3c,0xc7,
+  0x3f,0xe5,0x33,0x49,0xe4,0x1a,0x99,0xa7,0xa7,0x24,0x03,0x9b,0x44,0x49,0xca,0xc2,
+  0xd2,0x14,0xa4,0x50,0xe7,0x64,0xe9,0x87,0x54,0xac,0x52,0x63,0xe8,0xc8,0x28,0x26,
+  0x2d,0xea,0x72,0x81,0xdb,0x4a,0x51,0xca,0xd6,0xc8,0x5d,0x1a,0xdd,0xd5,0xb7,0x4b,
+  0x56,0x8b,0x36,0x76,0xa6,0x9c,0x58,0x7a,0xc7,0xc5,0x12,0x60,0x42,0x5a,0x00,0x45,
+  0x1c,0xe5,0xd4,0x2c,0x39,0x13,0x1c,0x1d,0x30,0xc1,0x2e,0xc6,0xd5,0xf4,0x2a,0x4e,
+  0x38,0x73,0x71,0xe1,0x09,0x81,0x73,0xf2,0x67,0xb7,0x9a,0x5d,0xb0,0x74,0xae,0x63,
+  0xf2,0xe3,0x8f,0x0d,0xa3,0x9e,0x20,0x95,0x47,0xbe,0x3b,0x25,0x43,0x5b,0x2e,0x41,
+  0xa9,0xbd,0x5e,0x2d,0x71,0x5b,0x7d,0x01,0x18,0xb4,0xd8,0x5d,0xc1,0x4d,0xee,0x7c,
+  0x23,0xe8,0x2f,0x97,0xb0,0xe9,0x17,0xe0,0x54,0xe0,0x5e,0xae,0xe7,0x87,0xe6,0xcb,
+  0xc5,0x05,0xa3,0xfd,0x37,0x29,0xe9,0x2d,0xba,0x52,0x1f,0x37,0xd0,0x37,0x7b,0x39,
+  0xc2,0x4f,0xcf,0x6b,0xd3,0x9d,0x1f,0x15,0x12,0xf5,0xc8,0x71,0x49,0xb0,0x25,0x0c,
+  0x22,0xa8,0x61,0x24,0xce,0x1d,0xdc,0x28,0x92,0xf7,0xc8,0x09,0x79,0x72,0xda,0x01,
+  0x36,0x87,0x5a,0xda,0xe4,0x59,0x32,0x7f,0x9d,0xea,0x5f,0x1e,0xbb,0x06,0x8e,0xe5,
+  0x6c,0xa5,0xfa,0xde,0x29,0x39,0xe9,0xd0,0x1c,0x59,0x8a,0x1f,0x7f,0x8d,0xe2,0x73,
+  0x2e,0x28,0xba,0x78,0x87,0xde,0xc7,0xbb,0x7a,0xbf,0x42,0x51,0x8d,0x31,0x01,0x17,
+  0x3a,0xab,0x14,0xbf,0x4e,0x9b,0x6a,0xc9,0xe8,0x6e,0xd4,0xed,0x05,0xa9,0xf8,0x95,
+  0x4c,0x67,0x32,0x45,0x95,0x85,0xf7,0x5b,0x29,0xa2,0x70,0xff,0x85,0xf6,0x25,0x5b,
+  0x72,0x0a,0x81,0x38,0x78,0xe8,0x5e,0x1d,0xf5,0xc8,0xf7,0xc3,0x9b,0x43,0xcf,0xbd,
+  0x3e,0xdc,0x5c,0x87,0xf0,0x7b,0x36,0xba,0xf6,0xcb,0x81,0x77,0xe6,0xc6,0xf1,0x26,
+  0xde,0x70,0xbe,0xe1,0x9b,0x8b,0xcd,0xa7,0xcd,0xfb,0x8d,0x86,0xb9,0xab,0x30,0xc9,
+  0xd6,0xef,0x44,0xb0,0x8c,0xce,0xd9,0x64,0xfe,0x92,0xfe,0xa6,0xa6,0x0f,0x6f,0xbc,
+  0xc1,0xbc,0x5f,0x86,0x69,0x19,0x62,0x94,0xf3,0x3e,0x89,0x38,0x9d,0xc3,0x0e,0x56,
+  0x49,0xa8,0x63,0xf0,0x33,0xc8,0x8c,0x7d,0x00,0x94,0xf6,0x49,0x20,0xd2,0x8f,0xb6,
+  0xa1,0xc0,0xa0,0x38,0x65,0x8c,0xf4,0xd0,0x69,0x7a,0x74,0xb1,0x31,0x98,0xbf,0x27,
+  0x28,0x8c,0x78,0xc3,0x7a,0x78,0x87,0xb5,0x58,0x31,0xf1,0xef,0xa2,0xf5,0xef,0x0b,
+  0x2b,0x40,0xd6,0x2a,0x20,0x5f,0xe8,0xe6,0xef,0x48,0x1f,0x46,0xb8,0x53,0x9a,0xcc,
+  0xf1,0x13,0x20,0x58,0xff,0x99,0xef,0xd5,0x23,0x4f,0xc9,0xd1,0x71,0x7b,0xf0,0x82,
+  0x36,0x30,0x53,0x15,0x50,0x67,0xf9,0xcf,0x88,0xb8,0xb5,0x95,0x42,0x87,0x6c,0x36,
+  0xa4,0x1a,0xe6,0x9e,0x05,0x3f,0x40,0xe5,0x64,0x4e,0x23,0x88,0x2b,0x9f,0x75,0xd4,
+  0xf4,0xab,0x30,0x60,0xca,0xdb,0x91,0x73,0x1f,0x6d,0x74,0xaf,0x75,0x0d,0x55,0x7b,
+  0x56,0xb7,0xcf,0xf7,0xcc,0xb9,0xcf,0xba,0x4a,0x4b,0xcc,0xfd,0xd6,0xba,0x5a,0x25,
+  0x3a,0x88,0xdd,0xbb,0x6e,0x44,0x48,0x40,0x01,0x22,0x18,0x67,0x54,0x7c,0x25,0xd5,
+  0x57,0xe6,0x8c,0x2c,0x3a,0x52,0x08,0x05,0x6c,0x75,0xe5,0xb0,0x36,0x40,0xc8,0x4c,
+  0x32,0xfa,0x61,0xbc,0x23,0x7a,0x5d,0x09,0x5c,0x7e,0x59,0x60,0x55,0x8a,0x3a,0x45,
+  0xbe,0xdb,0x4b,0x10,0x0c,0xde,0x2e,0x97,0x4c,0x3e,0x07,0x9e,0xbd,0x90,0x8a,0x2f,
+  0x8b,0x3d,0xd9,0x47,0x4e,0xd0,0x2a,0x27,0x97,0xe0,0x47,0x52,0x2c,0x9e,0xc7,0x54,
+  0x3e,0xc7,0xe2,0xf2,0x47,0xb6,0x98,0x41,0xb1,0x01,0x15,0xde,0x3e,0x82,0x55,0x65,
+  0xca,0x69,0xab,0x8a,0x3c,0x2c,0xbf,0xb3,0x3d,0xc7,0xa4,0xf8,0x72,0xd6,0xc9,0xb3,
+  0x29,0x6c,0x48,0x65,0x33,0x60,0x71,0x87,0x79,0x8e,0x31,0x89,0xb4,0x4c,0x83,0x9d,
+  0x08,0x58,0x85,0x60,0xd2,0x61,0xac,0xc9,0x7a,0x29,0x52,0x96,0xea,0x84,0x72,0x77,
+  0x3f,0x4c,0x66,0x38,0x22,0xcd,0xd3,0xaf,0xb6,0x55,0x05,0xed,0xc4,0x10,0xc3,0x6c,
+  0xf3,0x6c,0x81,0x13,0xe6,0xf6,0x80,0x3f,0xaf,0xe0,0xbf,0xec,0x80,0xff,0x17,0x80,
+  0x49,0x14,0xe6,0xe4,0xfd,0xc0,0xbf,0xa1,0x3a,0xf6,0x17,0x74,0xed,0xe6,0xf9,0xfa,
+  0xd8,0x33,0x3b,0xa9,0x2b,0xc7,0xb5,0x7f,0x36,0xec,0xfd,0x30,0xe8,0x23,0x79,0x27,
+  0x48,0x50,0x41,0x33,0xae,0xef,0x47,0x76,0x9e,0xac,0x59,0xf8,0x2d,0x26,0xbd,0xa3,
+  0xb2,0x91,0x75,0x4c,0xed,0xa9,0xb2,0x9d,0xf3,0xbd,0x93,0x27,0x3b,0x14,0x5d,0x9f,
+  0xc0,0xba,0x99,0x45,0xdf,0x01,0x11,0x5e,0xd3,0x20,0x61,0xed,0xde,0xcb,0x8a,0x2c,
+  0x34,0x5c,0xe3,0x85,0xb3,0x71,0x40,0x5d,0x7a,0x7b,0x96,0x5e,0xa8,0x04,0x6c,0x12,
+  0x9d,0xcf,0x5f,0xb6,0x65,0xe1,0x52,0xf1,0xd3,0xfb,0x14,0xf7,0xba,0xf5,0xe6,0xb5,
+  0x6e,0xc7,0x8c,0xf5,0xb4,0x63,0x2e,0x48,0xe8,0x6d,0x3c,0xbf,0x90,0x3e,0xc9,0x17,
+  0x9b,0xca,0x76,0x77,0x70,0xe4,0xb4,0x95,0x89,0x12,0x16,0xca,0x5b,0xd2,0x70,0x92,
+  0x86,0x39,0x82,0xc6,0xf9,0xd4,0xa5,0xe7,0x8e,0xcc,0xa1,0x6d,0x15,0x35,0x0d,0xee,
+  0x1a,0x04,0xe0,0xee,0x2a,0x34,0xa5,0x20,0x99,0xa7,0x18,0x43,0xa0,0xf6,0x6a,0x78,
+  0x63,0x0e,0xed,0xc8,0x9c,0xa1,0x35,0xd1,0x2b,0xc3,0x0a,0x27,0x46,0x8d,0xba,0x61,
+  0xe1,0x46,0x41,0xc6,0x9e,0x65,0xf6,0xc0,0x99,0xc2,0x34,0x1e,0x6e,0x69,0xaa,0xa9,
+  0xd4,0x85,0x59,0x8f,0x88,0xb5,0x0a,0x9e,0x3f,0x74,0xda,0xf6,0xd9,0x61,0x1f,0x4b,
+  0x58,0x93,0xb3,0xe5,0x30,0x8b,0x82,0x68,0x1d,0xf5,0xd6,0xea,0xbb,0x42,0xaa,0x59,
+  0xdd,0x11,0x32,0xd7,0xf4,0x7f,0x87,0xe4,0x18,0x1a,0xaf,0x82,0xaa,0xe0,0x47,0x42,
+  0x08,0xb2,0x0b,0x11,0x50,0xce,0xca,0x0a,0x07,0x5b,0x76,0x88,0x8b,0x9e,0x54,0xf4,
+  0x83,0x30,0xf6,0x46,0xa6,0x87,0xc2,0x5b,0x22,0x0a,0xd8,0x3e,0xb0,0xfb,0x53,0x1a,
+  0x86,0xd0,0x9c,0x5e,0x80,0x3b,0xb9,0x1c,0xfe,0xd9,0xbd,0xa9,0x98,0xbd,0x07,0x20,
+  0xa1,0x08,0xb2,0x05,0x64,0x47,0xbc,0xb6,0x4e,0x38,0xc3,0xcf,0x67,0xb7,0xaf,0x43,
+  0xd7,0x09,0x78,0x75,0x61,0x42,0xea,0x20,0xfe,0xd0,0x45,0x4d,0x33,0x2d,0x54,0x20,
+  0x05,0x5c,0x74,0x0a,0x26,0x10,0xef,0x43,0x40,0x64,0x0c,0xaf,0xbb,0xa8,0x1b,0xb1,
+  0x5e,0xa7,0x4e,0xd5,0x2d,0x82,0x44,0x3f,0x88,0x59,0xf0,0xc1,0xbe,0x51,0x20,0x57,
+  0x2e,0xe7,0x52,0x2c,0x41,0x61,0x3d,0x7e,0xc5,0x92,0x79,0xac,0xeb,0xd6,0xb0,0x6d,
+  0x9f,0xbb,0x4d,0x38,0xe8,0xb1,0x9e,0x06,0x30,0x8e,0xf0,0x71,0xa0,0xd6,0x67,0xd9,
+  0xa7,0xad,0x95,0xaf,0x0e,0x3b,0x3f,0x94,0x46,0x63,0x5a,0x3d,0x2c,0xf8,0xcb,0x4c,
+  0xc5,0x56,0x5b,0x9f,0xeb,0x2c,0x17,0x8b,0x68,0x7d,0x4a,0xac,0x80,0x68,0x91,0x06,
+  0x26,0x96,0xec,0xbf,0x8c,0x29,0x5d,0x78,0xc7,0xbb,0x37,0x17,0xaf,0xb4,0x5e,0xfe,
+  0x9d,0x4f,0xba,0x95,0x73,0x98,0xa1,0x2f,0x52,0xc8,0x9d,0xe1,0xad,0xd2,0xe0,0x25,
+  0x41,0x4c,0xd3,0x39,0xb3,0x1b,0xe4,0x5a,0x13,0x60,0x29,0x59,0x0c,0xc3,0x54,0x1b,
+  0xff,0x03,0x3b,0x3c,0x6e,0xb4,0xc3,0xf6,0xf3,0x49,0xc5,0x81,0xd2,0x33,0x65,0xa8,
+  0x1f,0x81,0x7b,0x42,0x54,0xfe,0x3e,0xfd,0xf3,0x0f,0x88,0x07,0xa9,0x98,0x25,0x56,
+  0x41,0x7d,0x55,0x0c,0xfb,0x55,0xac,0x35,0x9f,0xb7,0x63,0x5b,0x6c,0x69,0x06,0xe8,
+  0xf6,0x27,0x14,0xee,0x7c,0x15,0x46,0x53,0xe9,0xed,0x90,0xeb,0x38,0x0a,0xa4,0xb5,
+  0xaf,0xa7,0x5e,0x9b,0x8a,0xe2,0x7d,0xc7,0x0e,0xc7,0xed,0x1d,0xa3,0x2d,0x59,0xea,
+  0x1e,0xbc,0x9c,0x5c,0x1e,0xf4,0xf3,0xae,0x4e,0x44,0xc8,0x9f,0x3f,0x44,0xa8,0xb7,
+  0x92,0xe7,0x89,0xb6,0x4a,0xc0,0x26,0x11,0x35,0x09,0x46,0xe4,0x60,0x50,0xcf,0xf8,
+  0xef,0x95,0x48,0x0f,0x1a,0x3d,0x5e,0x65,0x3b,0x00,0x95,0x1f,0x5a,0xd3,0x51,0x15,
+  0x66,0x92,0x7f,0xd9,0x4c,0x09,0x70,0x7c,0xad,0x5c,0xcb,0x51,0x0b,0x44,0x6f,0xc4,
+  0x27,0x58,0x9f,0x9a,0x75,0xac,0x63,0x0d,0x3c,0x55,0x9c,0x54,0x22,0x0a,0x77,0xb1,
+  0xb9,0x5c,0x67,0xa5,0x46,0x83,0x01,0x66,0x05,0x0e,0xe9,0x03,0xf5,0xfa,0xb1,0x00,
+  0xcf,0x82,0x08,0x1c,0x9d,0x54,0xc9,0xaf,0xd9,0x85,0x83,0xe6,0x2f,0xab,0x1d,0x1c,
+  0x92,0xcb,0x98,0x41,0x32,0xa0,0x92,0x06,0x9a,0x49,0x45,0x68,0x04,0x3f,0xe6,0x0d,
+  0x4d,0x4b,0x9a,0x70,0x3c,0x07,0xc5,0xa9,0x8a,0x09,0x95,0x0c,0x80,0xb1,0x10,0xea,
+  0x18,0xbe,0xb2,0x51,0xa8,0x56,0x4c,0x86,0xe4,0xf5,0x04,0x72,0x1d,0xf4,0xdc,0xf3,
+  0xfc,0x21,0xad,0x75,0x2f,0xfb,0x6e,0x64,0xb0,0xaa,0x3a,0x1c,0x63,0x64,0x63,0xc5,
+  0x5a,0x5a,0x9b,0xb5,0xfc,0xfc,0xa5,0xef,0xd2,0xb4,0xf4,0xc4,0xa1,0xf8,0x8c,0x02,
+  0x91,0x1b,0x31,0xe9,0x8c,0x1f,0xec,0x52,0x8b,0x14,0x7d,0xc6,0x0e,0x2d,0xf6,0x51,
+  0xdb,0x6e,0xdb,0x78,0x91,0x44,0x37,0x18,0x5b,0x75,0x20,0x82,0xd8,0x88,0x2f,0xe9,
+  0x8c,0x33,0x37,0xc8,0x24,0x38,0xb5,0x36,0x83,0xca,0x7b,0xb7,0xed,0x2a,0x03,0x2e,
+  0x14,0xeb,0xd0,0x09,0x35,0x56,0x09,0xce,0x7c,0xf0,0x43,0xf7,0xa0,0x20,0x07,0xbf,
+  0x04,0xa3,0x20,0xe1,0xb8,0x1d,0x5b,0xf5,0x5a,0xfa,0x8d,0xe0,0x98,0x94,0x42,0xee,
+  0x0f,0xce,0x90,0xef,0x82,0xbb,0x47,0xf8,0x82,0x29,0x45,0xe7,0x5d,0x7b,0x87,0x03,
+  0x86,0x19,0x1f,0x8a,0x23,0x25,0x49,0x0a,0xc1,0x94,0x06,0xe8,0xb9,0xe6,0x39,0xec,
+  0x99,0x39,0xc7,0xb6,0xa4,0x52,0xa4,0x91,0x92,0xb3,0x51,0xc2,0xed,0x5c,0xbc,0x73,
+  0x2b,0x2b,0x39,0x7c,0x13,0xb6,0xea,0xdf,0x44,0xc7,0xee,0xc1,0x67,0xc7,0xd4,0x35,
+  0xe8,0x7f,0x0e,0xbc,0xa6,0xb6,0x6c,0x89,0x55,0xfb,0x1f,0xb3,0xea,0x5a,0xb9,0xb2,
+  0x52,0x9c,0x57,0x44,0xf5,0xcd,0x00,0x42,0x29,0xa0,0xe1,0x08,0x77,0x11,0x0c,0x06,
+  0xa4,0x30,0xa2,0x22,0x2b,0x06,0x21,0xc8,0x31,0x5c,0xb0,0x40,0x42,0x58,0x8a,0x15,
+  0x1e,0x0f,0xba,0x04,0x58,0xb6,0x0f,0x8a,0xb9,0xa0,0x21,0x59,0xc5,0x54,0x13,0xb8,
+  0x4a,0xa8,0x58,0xac,0xd2,0x06,0xae,0x2f,0xb9,0x48,0x37,0x7a,0x2b,0x9f,0xef,0x18,
+  0x7e,0x6b,0x95,0xf1,0xff,0x01,0xba,0xda,0x93,0x6c,0xdb,0x17,0x00,0x00,
+};
+static const char websocketJS[] PROGMEM = "<script src=\"/websocket.js?v=bb745377\"></script>";
+
+static const uint8_t webAsset_refresh_js[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x55,0x5d,0x4f,0xdb,0x30,
+  0x14,0x7d,0xef,0xaf,0x30,0x7d,0x89,0x2b,0xaa,0x2c,0xc0,0x1b,0x59,0x35,0x0d,0x56,
+  0x8d,0x49,0xb0,0x49,0x5b,0xb5,0x4d,0x42,0xd5,0xe4,0xc4,0xb7,0xc4,0xc3,0x75,0x3a,
+  0xdb,0xa1,0x20,0xe8,0x7f,0xdf,0xb5,0x93,0x34,0x6e,0x21,0x93,0x90,0x16,0x29,0x4d,
+  0xd2,0x7b,0xcf,0x39,0xf7,0xc3,0xd7,0x26,0x12,0x2c,0xb1,0x62,0x09,0x65,0x65,0xd3,
+  0x01,0x71,0x5f,0x79,0xa5,0x35,0x28,0x3b,0x63,0x99,0x04,0x32,0x21,0xd1,0x05,0x30,
+  0xbb,0xaa,0x96,0xab,0x08,0xed,0xbc,0xcc,0xab,0x25,0x1a,0xe3,0xac,0xe4,0x0f,0x71,
+  0xa9,0x64,0xc9,0xf8,0x64,0x51,0xa9,0xdc,0x8a,0x52,0xd1,0x11,0x79,0x1c,0x10,0xbc,
+  0xca,0x15,0x28,0x0f,0xa7,0x1d,0x78,0x94,0x7a,0xd3,0x96,0xe0,0x06,0xec,0x54,0x82,
+  0x7b,0x3d,0x7b,0xf8,0xc4,0xe9,0x30,0x97,0x62,0x38,0x8a,0xef,0x98,0xac,0x9c,0xe8,
+  0x70,0x58,0xbb,0x1b,0xcb,0xb4,0xfd,0x01,0x99,0x29,0xf3,0x5b,0xb0,0x86,0x3a,0x96,
+  0x0d,0xde,0xad,0x24,0x71,0x01,0x9c,0x97,0xca,0x22,0x0f,0x15,0x7c,0x4c,0x2a,0x2d,
+  0xc7,0xde,0xda,0xc4,0x72,0xc7,0x34,0xb9,0x2f,0x34,0x52,0x2a,0x58,0x93,0x9f,0x57,
+  0x97,0x17,0xd6,0xae,0xbe,0xc2,0x9f,0x0a,0x8c,0xa5,0x75,0x4c,0x68,0x8e,0x5d,0xc4,
+  0x34,0xfa,0x38,0x9d,0x45,0x2d,0x05,0x93,0x06,0x3a,0xbb,0x01,0xc5,0x43,0x77,0x9f,
+  0x38,0x92,0x3e,0x4b,0x9d,0x88,0x05,0xf5,0x00,0xcb,0x6c,0x65,0xc8,0x64,0x42,0x8e,
+  0x93,0x64,0x6b,0x24,0xbe,0xc0,0x65,0xf6,0x1b,0xa1,0x7d,0x95,0x10,0xbc,0x29,0x55,
+  0x4d,0x86,0xce,0x01,0x9c,0x38,0x70,0x2c,0x94,0x02,0x7d,0x31,0xbb,0xba,0x44,0x1a,
+  0x27,0xa6,0xc1,0xac,0x4a,0x65,0x60,0x06,0xf7,0x36,0xed,0x5c,0x5d,0x70,0xb4,0x23,
+  0xdb,0x0c,0xba,0x07,0xfe,0x6c,0x82,0x2a,0x56,0x2b,0xce,0x2c,0x7c,0x77,0xc5,0x37,
+  0xd4,0xf7,0xc0,0x34,0xa2,0x8b,0x52,0x53,0x17,0xb3,0x40,0xa9,0x24,0xc5,0xc7,0x5b,
+  0x52,0xdb,0x63,0x09,0xea,0xc6,0x16,0xf8,0xd7,0xe1,0xe1,0x36,0x40,0xe7,0xa9,0xcb,
+  0xf5,0x3f,0xb2,0xab,0xc1,0xd7,0x62,0x7e,0x9d,0xcc,0xdb,0xd0,0x30,0xcb,0x03,0x44,
+  0x85,0x55,0x0a,0xba,0x1a,0x15,0x20,0x4c,0xc1,0x6a,0x20,0xb6,0x27,0x7a,0x63,0xdd,
+  0xd2,0xd2,0xb0,0xc0,0xb4,0x8b,0x68,0x1c,0xf4,0xe0,0x71,0xd3,0x65,0xab,0xc1,0x56,
+  0x5a,0xa5,0x83,0x30,0x75,0x14,0x89,0x73,0x90,0xd2,0x5c,0x1f,0xcf,0x77,0x8a,0xd8,
+  0x45,0x75,0x34,0x4f,0xf7,0x7d,0x4f,0xfa,0x7c,0x8f,0x6b,0xdf,0xbd,0x5a,0x36,0x81,
+  0xd5,0xeb,0xdf,0x87,0xfa,0x99,0x2d,0x61,0xe4,0x73,0xdb,0x1b,0xad,0xad,0xd5,0xf3,
+  0x98,0xb5,0xb0,0x79,0x11,0x40,0xda,0x7a,0xe4,0xcc,0x40,0x30,0x86,0xa7,0xff,0xb1,
+  0x4a,0x99,0x06,0x76,0x9b,0x86,0x32,0xdf,0x92,0x1e,0x01,0x93,0xf4,0x90,0xbf,0x33,
+  0xc9,0x2b,0xf8,0xbf,0xe0,0xa4,0xd9,0x02,0xf4,0xb2,0x47,0xa6,0x6c,0xed,0x7d,0x6a,
+  0x5b,0x87,0x57,0x88,0x7e,0x60,0x52,0x32,0xd3,0xa3,0xc8,0xbd,0xb1,0x4f,0xee,0x68,
+  0x2d,0x34,0xec,0x48,0x75,0x03,0x16,0x8c,0x65,0xbd,0xd3,0xd4,0x54,0xbf,0xa0,0x5e,
+  0xf0,0xe6,0xe5,0x39,0x30,0x67,0x0f,0xe7,0xe8,0x65,0x5c,0x8f,0xe9,0xb0,0x81,0x30,
+  0x29,0x98,0x19,0x8e,0xd2,0x90,0x11,0x67,0x8f,0x50,0x47,0x1b,0x0c,0xdf,0x9e,0xc2,
+  0x8b,0x53,0xd8,0x5d,0x7b,0xde,0xb8,0x68,0x63,0xc6,0xf9,0xf4,0x0e,0x3f,0x2e,0x85,
+  0xc1,0xf4,0x41,0xd3,0x28,0x93,0x95,0xc6,0x04,0x6b,0xdf,0xf7,0x2e,0x8e,0x29,0x17,
+  0x76,0x67,0x0b,0x24,0xbb,0x5b,0x88,0x7f,0x7d,0xb9,0xde,0x1c,0x16,0xac,0x92,0xf6,
+  0xf4,0xb9,0xcd,0x61,0x73,0x09,0x4c,0xcf,0xea,0xd3,0x86,0x36,0xa7,0x8e,0xe7,0xc1,
+  0x2d,0x60,0xbb,0xee,0xc9,0x41,0x78,0xe8,0x90,0xa7,0x27,0x72,0x90,0x61,0xb3,0x14,
+  0xe4,0x16,0x78,0x9b,0x64,0x03,0x9e,0x18,0xb0,0x2d,0x5f,0x38,0x78,0x63,0x72,0x92,
+  0xe0,0x35,0xee,0x46,0xcc,0xcb,0x6c,0xfc,0xfd,0x17,0xa0,0x6a,0xcd,0x4e,0xf4,0x06,
+  0x00,0x00,
+};
+static const char refreshJS[] PROGMEM = "<script src=\"/refresh.js?v=d239f425\"></script>";
+
+static const uint8_t webAsset_select_js[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x6d,0x8e,0x31,0x0b,0xc2,0x30,
+  0x10,0x85,0xf7,0xfe,0x8a,0x23,0x53,0xa5,0x10,0xdc,0xab,0x4b,0xc5,0xc1,0xc5,0xc9,
+  0x4d,0x1c,0xd2,0xf6,0x6a,0x0e,0xd3,0xa4,0x24,0xa9,0x34,0x48,0xff,0xbb,0x49,0x45,
+  0x10,0x75,0xb8,0xe3,0x1d,0x8f,0xf7,0xdd,0xeb,0x46,0xdd,0x78,0x32,0x1a,0xcc,0x80,
+  0xfa,0x24,0x6a,0x85,0xb9,0x4f,0xfb,0x28,0x7a,0x5c,0xc1,0x23,0x03,0xb0,0xd8,0x59,
+  0x74,0xf2,0xdb,0x2b,0xa3,0x75,0x17,0x16,0xe8,0x2d,0x26,0xd8,0x42,0x6b,0x9a,0xb1,
+  0x47,0xed,0xf9,0x15,0xfd,0x5e,0x61,0x92,0xae,0x0a,0x3b,0x25,0x9c,0x4b,0xa1,0x9c,
+  0x49,0x24,0x27,0xc5,0x42,0x61,0x0b,0xa2,0x33,0x16,0x72,0x8a,0xd1,0x75,0x09,0x04,
+  0x1b,0x98,0xb8,0x42,0x7d,0xf5,0x32,0x5e,0x45,0xf1,0x2a,0x00,0x30,0x9d,0xe9,0xc2,
+  0x9d,0x0f,0x0a,0x79,0x4b,0x6e,0x50,0x22,0xc4,0x00,0xd3,0x46,0x23,0x4b,0x8c,0x39,
+  0xce,0x9f,0xcf,0x55,0x38,0xb4,0x1f,0x85,0x7f,0x01,0xb5,0x32,0xcd,0x2d,0x12,0xe6,
+  0xec,0x09,0x45,0x8b,0x4c,0xf4,0x06,0x01,0x00,0x00,
+};
+static const char selectJS[] PROGMEM = "<script src=\"/select.js?v=0a63db74\"></script>";
+
+static const uint8_t webAsset_settings_js[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x90,0x4d,0x4b,0xc3,0x40,
+  0x10,0x86,0xef,0xfe,0x8a,0x21,0x97,0x26,0x0a,0x71,0x45,0xf0,0x60,0x11,0x41,0x2c,
+  0x54,0x68,0xf0,0xd0,0x82,0xc7,0xb2,0x66,0xc7,0x66,0xe9,0x76,0x12,0xb2,0x93,0x86,
+  0x20,0xfe,0x77,0xb7,0x49,0x3f,0x12,0x63,0x6b,0xcd,0x61,0x33,0x3b,0xf3,0xce,0x3b,
+  0xf3,0x2c,0x00,0xc0,0x47,0x41,0x31,0xeb,0x94,0x60,0x9a,0xa4,0xe5,0x58,0x2b,0x9c,
+  0x68,0xcb,0x48,0xaf,0x64,0xaa,0x99,0x7c,0x37,0xe8,0x9b,0xfa,0x9e,0xba,0xfb,0x88,
+  0x36,0x09,0x15,0xc0,0xe7,0x05,0x6c,0xbf,0xb5,0xcc,0xe1,0x20,0xb0,0xc8,0xac,0x69,
+  0x61,0xe1,0x01,0x54,0x1a,0x17,0x2b,0x24,0x0e,0x17,0xc8,0x23,0x83,0x9b,0xf0,0xa9,
+  0x7a,0x51,0xbe,0xd7,0x57,0x7b,0xc1,0x70,0xef,0xd7,0xaf,0x86,0x96,0x2b,0x83,0xa1,
+  0xd2,0x36,0x33,0xb2,0x72,0xce,0xbd,0x7d,0xc2,0x38,0xc1,0x78,0x89,0x0a,0x1e,0xc1,
+  0x73,0x79,0xf4,0xe0,0x7e,0x1b,0x34,0xbe,0x5f,0xf5,0xd9,0xe3,0x7c,0x96,0xc6,0x48,
+  0xdb,0x30,0xaa,0x3a,0x3e,0xc2,0xd7,0x14,0xcf,0x61,0xeb,0x2a,0xdb,0x5c,0xdd,0x4a,
+  0x8f,0xa9,0x33,0xbf,0xcd,0xc3,0x9b,0xcc,0x99,0x40,0x53,0xd1,0xc0,0x58,0x81,0xbf,
+  0x83,0x58,0x71,0x0e,0xc4,0x41,0xd5,0x06,0x38,0x64,0x7b,0xcb,0xef,0xe7,0xfd,0x77,
+  0xf1,0x38,0x91,0xb4,0xc0,0x48,0xd3,0x9b,0x64,0xf6,0xb3,0x34,0xe7,0x9f,0x1b,0x67,
+  0xd9,0xb2,0x4c,0x4e,0x2c,0x3b,0xb0,0x62,0x5e,0x6b,0xe6,0x83,0xab,0xba,0x3f,0x5c,
+  0x4b,0x53,0xe0,0xb0,0x63,0xa2,0x89,0x31,0x77,0xf9,0x3f,0x7c,0x76,0xb2,0x63,0x56,
+  0xa7,0x7a,0x57,0x9a,0x4a,0xc7,0xb0,0x6f,0xd5,0x44,0x98,0x8f,0x67,0xd1,0xc4,0xcd,
+  0x8c,0x24,0x27,0x61,0x9e,0x16,0xa4,0x7c,0xff,0xf6,0x4e,0x08,0xb8,0x84,0x1b,0xe1,
+  0x7e,0xd7,0x0d,0x5d,0xe0,0x82,0xdd,0xe8,0x60,0xf7,0x4c,0xdf,0xeb,0x83,0x3a,0xc4,
+  0x99,0x03,0x00,0x00,
+};
+static const char settingsJS[] PROGMEM = "<script src=\"/settings.js?v=6cb2add6\"></script>";
+
+static const uint8_t webAsset_changewifissid_js[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x4b,0x2b,0xcd,0x4b,0x2e,0xc9,
+  0xcc,0xcf,0x53,0x48,0xce,0x48,0xcc,0x4b,0x4f,0x2d,0xcf,0x4c,0xcb,0x2c,0x2e,0xce,
+  0x4c,0xd1,0xd0,0x54,0xa8,0xe6,0x52,0x28,0x4b,0x2c,0x52,0xa8,0x50,0xb0,0x55,0x48,
+  0xc9,0x4f,0x2e,0xcd,0x4d,0xcd,0x2b,0xd1,0x4b,0x4f,0x2d,0x71,0xcd,0x49,0x05,0x31,
+  0x9d,0x2a,0x3d,0x53,0x34,0x94,0x40,0xca,0xe3,0x41,0xea,0xe3,0x8b,0x53,0x73,0x52,
+  0x93,0x4b,0x94,0x34,0xf5,0xca,0x12,0x73,0x4a,0x53,0xad,0xb9,0x88,0xd1,0x93,0x99,
+  0x02,0x53,0x0f,0xb4,0xa3,0xc2,0x9a,0xab,0x96,0x0b,0x00,0x6e,0x54,0x54,0x95,0x8e,
+  0x00,0x00,0x00,
+};
+static const char changewifissidJS[] PROGMEM = "<script src=\"/changewifissid.js?v=c12a9254\"></script>";
+
+static const uint8_t webAsset_populatescanwifi_js[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x93,0x4b,0x6f,0x13,0x31,
+  0x14,0x85,0xf7,0xfc,0x8a,0xab,0x6c,0xec,0xaa,0xad,0x09,0x08,0x56,0x55,0x36,0x94,
+  0xa8,0x14,0x15,0x2a,0x31,0x91,0x60,0x57,0x99,0xf1,0x9d,0x8e,0xa9,0x63,0x0f,0x7e,
+  0xa4,0x44,0x28,0xff,0x1d,0x3f,0x86,0x8c,0x1b,0x5a,0xa4,0x5a,0x4a,0x26,0xb1,0xbf,
+  0xe3,0x7b,0x7c,0x3c,0x77,0xc3,0x2d,0x58,0xec,0x2c,0xba,0xfe,0xab,0xec,0x64,0xd3,
+  0x72,0x0d,0x0b,0xe8,0x82,0x6e,0xbd,0x34,0x1a,0xe8,0x11,0xfc,0x7e,0x01,0x9b,0x08,
+  0x39,0x54,0xd8,0xfa,0x2b,0xe9,0x7c,0x5c,0x17,0xa6,0x0d,0x6b,0xd4,0x9e,0xdd,0xa2,
+  0x5f,0x2a,0x4c,0x3f,0xdf,0x6d,0x2f,0x05,0x25,0xf7,0x71,0x8f,0x1b,0xe7,0xa4,0xb8,
+  0x29,0x3c,0x39,0x3a,0x2b,0x72,0x8b,0x3f,0x03,0x66,0xad,0xc6,0x7b,0xf8,0xf6,0xe9,
+  0xea,0x83,0xf7,0xc3,0x97,0x32,0x49,0x13,0x34,0x02,0xcc,0x68,0x8b,0x5c,0x6c,0x9d,
+  0xe7,0x1e,0xdb,0x9e,0xeb,0x5b,0xac,0xfc,0xd0,0xe8,0x73,0x30,0xda,0x61,0xb6,0x05,
+  0xb2,0x03,0xfa,0x57,0x97,0x55,0x4d,0x52,0xc1,0x62,0xb1,0x80,0x37,0x85,0x78,0x80,
+  0xa4,0x3d,0x83,0xcb,0xcb,0xaf,0xe7,0xf3,0x11,0x88,0x23,0xf9,0xfb,0xe1,0x8c,0xbe,
+  0x1e,0x52,0x8d,0x08,0xc0,0xc7,0xe6,0xfa,0x33,0x1b,0xb8,0x75,0x58,0xed,0x5f,0x2a,
+  0xaf,0xf0,0x97,0x4f,0x7e,0xf3,0x78,0x46,0x0e,0x4c,0x6a,0x8d,0x36,0xa9,0x53,0x06,
+  0x41,0xa9,0xb3,0xaa,0xba,0xc0,0x8e,0x07,0xe5,0x4d,0x36,0x50,0xe7,0xdb,0xc6,0x63,
+  0x79,0x1c,0xb7,0xa6,0xa4,0x00,0x64,0xaa,0x5f,0xeb,0xd8,0x86,0xab,0x90,0xd2,0x22,
+  0xe4,0xf1,0x75,0x5f,0x8a,0x93,0x26,0x5b,0x82,0xa6,0xb9,0x7c,0xff,0x04,0x59,0x4c,
+  0xa3,0x88,0xb4,0xb7,0x01,0x1f,0x87,0x7a,0x29,0x04,0xea,0x03,0x64,0x7a,0x4d,0x18,
+  0x1f,0x06,0xd4,0xe2,0xbc,0x97,0x4a,0xd0,0x07,0xca,0xbd,0xfd,0x2a,0x74,0xd6,0x19,
+  0xbb,0xe4,0x6d,0x4f,0xf7,0x57,0x2d,0x3d,0xae,0xa7,0x3b,0x2a,0x39,0x3d,0x3b,0x20,
+  0x80,0x83,0x6c,0xd2,0xae,0x2c,0x5d,0xcc,0x3f,0xc4,0x98,0xce,0x1e,0x80,0x63,0x98,
+  0xc1,0x69,0xfc,0x1c,0x97,0x39,0x1b,0x27,0x27,0xd1,0x13,0xe7,0x3c,0x38,0xe0,0x6e,
+  0x32,0x52,0x09,0x9c,0xdf,0x2a,0x64,0x42,0xba,0x41,0xf1,0x6d,0x2c,0x39,0xfb,0xae,
+  0x4c,0x7b,0x37,0x1b,0xd1,0x5d,0x7a,0xa6,0xaf,0x5d,0xdd,0x15,0xb1,0x04,0x25,0x17,
+  0xcb,0x15,0x39,0x01,0xf2,0x32,0xbd,0x5d,0x2e,0x76,0x6a,0xfc,0x93,0xb2,0xaf,0xdb,
+  0xc7,0x45,0x2b,0xb9,0x9f,0x1c,0xfa,0x95,0x5c,0xa3,0x09,0x9e,0x1e,0xf4,0xf7,0xc9,
+  0xab,0x79,0x1c,0x91,0x89,0x05,0xfe,0x43,0xbd,0xcd,0xcc,0x1f,0xf3,0xe7,0x81,0xd3,
+  0x20,0x04,0x00,0x00,
+};
+static const char populatescanwifiJS[] PROGMEM = "<script src=\"/populatescanwifi.js?v=4c7dbeb2\"></script>";
+
+static const uint8_t webAsset_populategetsettings_js[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x55,0x5d,0x6f,0xda,0x30,
+  0x14,0x7d,0xdf,0xaf,0xb0,0xf2,0x50,0x82,0xda,0x65,0xa1,0xda,0x5b,0x46,0xa5,0x55,
+  0xab,0xd6,0x4d,0x6d,0x91,0x06,0xd2,0x26,0x55,0x15,0x32,0xf1,0x05,0x3c,0x8c,0x9d,
+  0xd9,0x0e,0x24,0x9a,0xf8,0xef,0xbb,0x4e,0x08,0x0d,0x10,0xa0,0xdd,0x96,0x97,0xf8,
+  0xe3,0xdc,0x73,0xcf,0x3d,0xbe,0xb2,0x17,0x54,0x93,0x09,0xd8,0x3e,0x58,0xcb,0xe5,
+  0xc4,0x90,0x2e,0x19,0xa7,0x32,0xb6,0x5c,0x49,0xbf,0x4d,0x7e,0xbf,0x21,0x64,0x81,
+  0x00,0x0d,0xbf,0x52,0x30,0x16,0x37,0x25,0x2c,0xc9,0x8f,0xfb,0xbb,0x5b,0x6b,0x93,
+  0x6f,0xe5,0xa2,0xdf,0x8e,0x10,0xb5,0x46,0x04,0x4a,0x6a,0xa0,0x2c,0x37,0x96,0x5a,
+  0x88,0xa7,0x54,0x4e,0xa0,0xce,0xa8,0xc1,0x24,0x4a,0x1a,0x28,0x99,0x09,0xe1,0x63,
+  0xbf,0x0a,0x2c,0xc2,0xfa,0x2e,0x8c,0x74,0xbb,0x5d,0xf2,0xbe,0x82,0x6c,0x81,0x1c,
+  0x6d,0x6a,0x0a,0xc0,0x65,0x18,0x3e,0x43,0x4a,0x95,0x3f,0x8d,0x92,0xbd,0xc4,0x25,
+  0x72,0x65,0x7c,0xed,0xf7,0x1e,0x82,0x84,0x6a,0x03,0xb5,0x1c,0x65,0xfa,0x01,0x64,
+  0xb6,0x50,0x5d,0x7e,0x63,0xa5,0x7d,0x17,0x3f,0x83,0x9c,0x70,0x59,0xa7,0xa9,0x67,
+  0x28,0x73,0x80,0x40,0x6a,0xa6,0xe2,0x74,0x0e,0xd2,0x06,0x68,0xdc,0x8d,0x00,0x37,
+  0x34,0xd7,0xf9,0x03,0x9d,0x83,0x8f,0x1c,0x35,0xe6,0x42,0x3c,0x88,0x40,0x80,0x9c,
+  0xd8,0x29,0xb9,0x22,0xe1,0x36,0x63,0xb1,0xff,0x51,0x6b,0x9a,0xfb,0x9e,0x45,0x51,
+  0xde,0x05,0xf1,0x64,0x3a,0x1f,0x81,0x76,0xa3,0x84,0x1a,0xb3,0x54,0x9a,0x79,0xed,
+  0x80,0x4b,0x06,0x59,0xcf,0x71,0x3d,0x86,0x4f,0x81,0xcd,0x13,0xb4,0xf0,0x8a,0xbc,
+  0xed,0xec,0xd2,0x11,0x52,0x22,0x16,0x54,0xa4,0xce,0xf9,0x5a,0x2d,0x8f,0x28,0xed,
+  0x29,0xda,0x42,0xaf,0xa2,0x5d,0x2d,0xcf,0xfc,0x68,0x32,0xf1,0xe2,0x29,0xc4,0xb3,
+  0x91,0xca,0x3c,0x72,0x76,0xb6,0xc7,0xe5,0x10,0x07,0x05,0x14,0x91,0xc0,0x50,0x82,
+  0xd5,0x29,0x44,0x3b,0x18,0xcc,0xe4,0xcc,0x76,0x29,0x04,0x37,0x16,0xa4,0x92,0x22,
+  0xf7,0xf6,0xb9,0x08,0xe9,0x4f,0xd5,0xf2,0x96,0x33,0xb8,0x2b,0x60,0x3d,0x84,0x0d,
+  0xe8,0x48,0x40,0x29,0xb4,0xbd,0xcb,0xbb,0x3a,0x92,0x28,0x35,0x30,0xec,0x2c,0xb9,
+  0x86,0xa3,0x79,0x3e,0x51,0x21,0xa8,0xf9,0x97,0x1c,0x26,0x3c,0x9a,0xa0,0x1f,0xbe,
+  0x82,0xfc,0xe4,0x01,0x69,0xca,0xb8,0x6a,0xc8,0x57,0xb5,0x74,0x86,0x07,0x10,0x46,
+  0xf8,0xfb,0x40,0x36,0x6d,0x88,0xd3,0xf3,0xf3,0x26,0x89,0x25,0x7d,0xb6,0xe9,0x9e,
+  0xfd,0xf6,0x69,0x8a,0x2a,0x4e,0x3c,0x3b,0x75,0xe2,0x0d,0xbe,0xbd,0xa2,0xd6,0x4d,
+  0xff,0x7b,0x06,0x04,0xc4,0xd6,0x3b,0xd4,0xfd,0xae,0xe6,0x78,0xca,0x05,0xd3,0x20,
+  0x51,0x49,0xd5,0x8b,0xb8,0xf0,0xa0,0x18,0x98,0xe8,0xb4,0x4d,0x55,0xf4,0x0b,0xcc,
+  0xaa,0xa0,0x7f,0x61,0x59,0x3d,0xb4,0x2c,0xe9,0x7f,0x39,0x57,0x9b,0xd4,0x86,0x0d,
+  0x37,0xd6,0x75,0xfe,0x85,0xf9,0x9e,0x50,0xd8,0x41,0x72,0x32,0x34,0xeb,0xfb,0x1f,
+  0xef,0x1a,0x63,0x73,0x01,0x01,0xe3,0x26,0x11,0x14,0xdb,0x1a,0x6f,0x24,0x25,0xc1,
+  0x7b,0x01,0x57,0xc5,0x31,0x44,0x5b,0xe7,0x4d,0x44,0x23,0xa1,0xe2,0x59,0x8d,0xa9,
+  0x7c,0x20,0xee,0xb9,0xfc,0x4e,0xad,0xf5,0x3b,0xed,0x43,0x3b,0x97,0x9b,0x9d,0x75,
+  0x49,0xc5,0x6f,0xb5,0xf5,0xee,0x24,0x20,0xfd,0xd6,0xe7,0x9b,0x41,0xeb,0x82,0xb4,
+  0xde,0xa1,0xb2,0x4a,0x0c,0xce,0x9d,0xab,0x5b,0x8f,0x94,0x01,0xc9,0xdc,0xb3,0x85,
+  0x0c,0xb5,0xa7,0xcf,0xad,0xfc,0x01,0xee,0x8d,0xb5,0x47,0x0e,0x07,0x00,0x00,
+};
+static const char populategetsettingsJS[] PROGMEM = "<script src=\"/populategetsettings.js?v=b73cc0de\"></script>";
+
+static const uint8_t webAsset_logformats_json[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x58,0xdb,0x6e,0xdc,0x38,
+  0x12,0x7d,0xcf,0x57,0x70,0xbc,0x30,0x92,0x00,0x59,0x83,0xba,0x50,0x97,0xbc,0x25,
+  0xce,0x66,0x33,0xc0,0x64,0x9c,0x1d,0x77,0x90,0x7d,0xd8,0x97,0x22,0x59,0xec,0x16,
+  0xa2,0x16,0x7b,0x24,0xca,0x97,0x59,0xec,0xbf,0x6f,0x91,0x94,0x64,0x77,0x7b,0xdc,
+  0xe9,0x09,0x1c,0xb8,0xad,0x66,0x55,0xb1,0x6e,0xe7,0x54,0xe9,0xbf,0x2f,0xce,0x38,
+  0x4f,0xb2,0x5a,0x54,0xc9,0xd9,0x5b,0x76,0x76,0xb5,0xc3,0x6e,0xb5,0xc1,0x7e,0xfb,
+  0x96,0x7d,0xfe,0xd7,0x6a,0xc5,0xb6,0x38,0x0c,0xb0,0x46,0xd6,0xa3,0xc2,0xe6,0x06,
+  0x35,0x7b,0xa9,0x36,0xd7,0x0e,0x1c,0xbe,0x3c,0x7b,0x43,0x92,0x69,0x2e,0xa4,0xd0,
+  0xe9,0x69,0x92,0x76,0x74,0x43,0xa3,0x71,0x85,0xdb,0x5d,0x94,0xce,0x25,0x1a,0x2e,
+  0x95,0x97,0xfe,0x75,0xdc,0x4a,0xec,0x99,0x35,0x2c,0xb9,0x6d,0x7a,0x64,0x03,0x76,
+  0x83,0xed,0x07,0x66,0x3b,0x26,0xc7,0xe1,0x2d,0x3b,0xd7,0x41,0x42,0x64,0x8a,0x67,
+  0x1a,0x0f,0xec,0xfd,0x36,0x9b,0xe8,0x11,0x34,0xbb,0xfc,0xc4,0x76,0x3d,0x19,0x1f,
+  0x7b,0x8c,0x32,0x45,0x99,0x89,0xac,0x3c,0xbc,0x23,0x0c,0x8e,0x0c,0x6a,0xbc,0x69,
+  0x14,0xb2,0x1b,0xec,0x87,0xc6,0x76,0x64,0x67,0x08,0x32,0x55,0x6a,0x74,0x99,0x66,
+  0x47,0xed,0xf4,0xb8,0xb5,0x0e,0xd9,0x0e,0x7a,0xd8,0x22,0xe9,0x1a,0xe8,0xd2,0xce,
+  0x35,0xdd,0x3a,0xaa,0xa8,0x05,0xa8,0x24,0x0d,0xa1,0x59,0x59,0xcb,0xb6,0xa3,0xda,
+  0x30,0x65,0xb7,0x5b,0xe8,0xf4,0xc0,0xa0,0xf5,0x2a,0xee,0x59,0xe3,0xdd,0x33,0x06,
+  0xfb,0x0b,0xf6,0xf3,0xba,0xb3,0x3d,0x49,0x33,0xb7,0x69,0x86,0xe5,0xe4,0xc5,0x7f,
+  0xba,0xa0,0x0d,0xb2,0xb2,0x34,0x98,0x7b,0x6d,0x74,0x0b,0xdb,0x75,0xa8,0x5c,0x38,
+  0x4c,0x9a,0x7f,0x77,0x8e,0x4c,0xf7,0xe4,0x03,0xbb,0xb8,0xb8,0x08,0xc7,0x65,0x46,
+  0x6e,0x73,0xf0,0xc7,0xdf,0x4d,0xa6,0x28,0xa2,0xda,0x4b,0x68,0x70,0x70,0xc1,0xde,
+  0x07,0xab,0x8b,0x39,0xff,0x25,0x39,0xf4,0xfb,0x88,0x83,0x0b,0x0a,0x54,0x56,0x64,
+  0xc0,0xe5,0x69,0x89,0xdd,0xc2,0xdd,0xea,0x1a,0x5d,0x48,0x6a,0x52,0x24,0x82,0xfe,
+  0xc9,0xe7,0x42,0x37,0x50,0xf1,0x8c,0xe4,0xdf,0x06,0xd5,0x77,0x9f,0xd6,0x37,0x94,
+  0xaf,0xf8,0xfb,0xc3,0xa7,0x6f,0xd3,0x03,0x6b,0x5b,0xba,0xd9,0x9b,0xf0,0xc7,0xd5,
+  0xea,0x72,0x3e,0x96,0xc6,0x0f,0xd7,0xdf,0x3e,0x5b,0x8d,0x8b,0xcc,0xfb,0xd6,0x46,
+  0x4d,0xc1,0x7a,0x55,0x70,0xad,0x50,0x4c,0x71,0x8a,0x26,0xb7,0x96,0x0a,0xca,0xbb,
+  0x4d,0xbe,0x42,0xc7,0x36,0x14,0x0e,0x0a,0xd5,0x30,0xae,0xd7,0xe4,0xed,0xf0,0xd3,
+  0x41,0xe4,0x61,0x88,0xbf,0xe9,0x47,0x52,0x96,0x43,0xb8,0x82,0x6a,0x69,0x84,0xe6,
+  0x60,0xbc,0xea,0x8f,0x76,0xa4,0x78,0x3d,0xae,0xd4,0xb9,0x72,0x12,0x2c,0x20,0xcf,
+  0x2a,0x7d,0xe0,0xfe,0xd7,0xee,0x7b,0x67,0x6f,0xbb,0x78,0x8b,0x9f,0x3f,0xf8,0xeb,
+  0xb2,0x57,0xe7,0x7f,0xe3,0x09,0xbf,0x7b,0xed,0xc5,0xd2,0xaa,0xd2,0xb2,0x52,0xa1,
+  0xe0,0x7e,0xb5,0x6e,0x49,0xd6,0xe3,0x5a,0xb8,0x60,0x9f,0xb0,0x19,0x36,0xb0,0xa5,
+  0x9e,0xa0,0xba,0x69,0x1b,0x2a,0xe0,0x8e,0x1a,0xa4,0xbd,0x27,0x0f,0x35,0xfe,0x14,
+  0xf4,0x60,0x52,0xca,0xaa,0xae,0xbc,0x9e,0xcf,0x08,0xbe,0x07,0x34,0xfb,0x06,0xce,
+  0x6d,0xec,0xd8,0xfb,0x66,0xba,0xe6,0x6c,0x67,0x7b,0x47,0xf6,0xe9,0x0e,0x17,0xa9,
+  0x09,0x42,0x26,0x97,0x75,0xce,0x43,0x87,0xfc,0x62,0xd7,0x4c,0x51,0x7b,0xaf,0x29,
+  0x22,0x18,0x2a,0xda,0x97,0x18,0xbf,0x3b,0xe7,0xe9,0x5d,0x3c,0x2b,0x64,0x99,0x1a,
+  0x78,0x92,0xde,0x50,0x3a,0x74,0xaf,0x1b,0x68,0x1b,0x1d,0xee,0x92,0xa5,0x35,0xcf,
+  0x75,0x6c,0xbc,0x25,0x17,0x76,0xe7,0xa8,0xcf,0xa0,0x65,0x5f,0x2e,0xdf,0x33,0x50,
+  0xdf,0x19,0x74,0xc3,0xad,0x2f,0xff,0x0f,0x54,0xd5,0x0f,0x2e,0x93,0x7f,0x57,0x5f,
+  0x56,0x64,0x7a,0xd7,0xa8,0x21,0x84,0x3f,0x2b,0xd2,0x82,0xca,0x4a,0x3c,0x2e,0xe9,
+  0x5d,0x6f,0x15,0x15,0xa3,0x97,0x82,0xce,0x3a,0xba,0x4a,0x6c,0x06,0x05,0x6d,0x2b,
+  0x49,0xf9,0x61,0x53,0xd9,0x0e,0xa3,0x2a,0x9d,0xd5,0x65,0x1d,0x32,0xe9,0x13,0x32,
+  0xe7,0x2e,0x2b,0x4c,0x9e,0xc9,0xca,0x1c,0xf8,0xf6,0xad,0x6f,0x1c,0xce,0xcd,0x41,
+  0xb8,0x71,0xc7,0x56,0xf0,0x77,0x1f,0x18,0xfa,0xbf,0xb3,0x4d,0xe7,0x16,0x79,0x4c,
+  0x09,0x34,0x2a,0x71,0x14,0x35,0xa4,0x6d,0x5a,0xba,0xa7,0x69,0xed,0x2d,0x73,0x84,
+  0x84,0xec,0x15,0xc1,0x62,0x8b,0xee,0x75,0xd4,0x00,0x50,0x41,0x5d,0x1e,0xd5,0xb0,
+  0xba,0xfe,0xe2,0xcf,0xe6,0xbc,0x92,0x55,0x22,0xab,0xbd,0xf0,0x02,0x1b,0x36,0x94,
+  0x5e,0x0f,0x6c,0xe4,0xd8,0x9a,0x90,0xe9,0x82,0x5d,0x42,0xf7,0xd2,0x11,0xd0,0x51,
+  0x7c,0x31,0xc6,0xe1,0x1e,0x5d,0x88,0x69,0x9e,0x18,0x63,0x32,0x73,0xfc,0xc2,0xd4,
+  0x62,0xc1,0x5b,0xe9,0x6b,0x3e,0xf8,0x99,0x17,0xb9,0x4c,0xa8,0x66,0x8e,0x8a,0x19,
+  0x18,0x5b,0x37,0x81,0x1b,0x1b,0x9a,0x3f,0x42,0xe4,0x73,0x90,0x52,0x24,0x39,0xdf,
+  0xbb,0xb3,0xef,0xb2,0xd8,0x93,0x87,0xf9,0xf2,0x3e,0x84,0x52,0x12,0x09,0xd6,0x89,
+  0x14,0x01,0xf7,0x17,0xd8,0x59,0x5d,0x7d,0xa1,0x2e,0x3a,0x1f,0xe6,0xf0,0x0b,0x81,
+  0x92,0x17,0x2a,0x1c,0x9a,0xfb,0xa7,0x87,0x5b,0x46,0x15,0x39,0x06,0xeb,0xa2,0xca,
+  0x6a,0x9d,0xd7,0x70,0x34,0xbf,0xe4,0xee,0x93,0xc4,0x8a,0x4a,0xd4,0xa5,0x4c,0xf3,
+  0x27,0x0e,0x83,0x3e,0x56,0x17,0x41,0xb4,0x96,0x15,0x14,0x49,0xa0,0x81,0xeb,0xe9,
+  0x52,0x53,0x3f,0x33,0xd3,0xdb,0xed,0x14,0xa1,0x70,0x54,0x96,0x5c,0xa7,0x79,0x75,
+  0x0a,0xe9,0x58,0x02,0xfb,0x9e,0xb8,0x74,0xdf,0x96,0x51,0x00,0x02,0xc5,0x29,0xa0,
+  0xed,0xcf,0x17,0x19,0x97,0xbc,0x32,0xe9,0x73,0x06,0xa7,0x50,0xc4,0xcc,0x43,0xc0,
+  0x83,0xa7,0x9c,0xf7,0x88,0x34,0x8a,0x3c,0x97,0x2a,0x9f,0xb3,0x1b,0x1e,0x7b,0x77,
+  0x3b,0xbc,0x25,0x81,0x0e,0x06,0xdb,0x35,0x8a,0xe1,0x9d,0xeb,0x21,0x64,0x36,0x88,
+  0x08,0x9e,0xf2,0x32,0xc9,0xa2,0x08,0x10,0x2b,0x10,0x5c,0x53,0x24,0x1f,0x43,0x2b,
+  0xc5,0x6b,0xec,0xdc,0x05,0xbb,0xf2,0x48,0x47,0x19,0x9f,0x47,0x83,0xdb,0xa6,0x6d,
+  0x3d,0x04,0xdc,0xf8,0x38,0x2c,0x30,0x5d,0x14,0xaa,0x90,0xe6,0x09,0x40,0xf9,0xf4,
+  0xf4,0xd8,0x82,0x23,0xcf,0x3c,0x5c,0x8e,0xfe,0x23,0xe1,0x61,0x8b,0x37,0xd8,0x52,
+  0x9e,0x03,0x10,0x16,0xc0,0xd1,0xd4,0x10,0x32,0xf0,0xb5,0x1b,0x46,0x39,0xa8,0xbe,
+  0x91,0x38,0x65,0x8a,0xa0,0xf3,0x76,0x46,0x52,0x9a,0x2f,0x9c,0x67,0x95,0x00,0x50,
+  0x41,0x54,0x41,0x9a,0xe6,0x25,0x3f,0x8d,0x30,0xf5,0xe6,0xf6,0x7a,0x4a,0x5c,0x20,
+  0xcd,0x92,0x27,0x4a,0x62,0xaa,0x9e,0xcb,0x04,0x8d,0x34,0x7f,0x25,0x11,0xa5,0x40,
+  0x52,0x88,0xfc,0x39,0x75,0xbf,0x45,0xe1,0xf7,0x11,0x8a,0x9e,0xd1,0x41,0x84,0x24,
+  0x45,0x59,0x78,0x1d,0x97,0x76,0x6c,0x35,0x23,0x84,0x25,0xf8,0x26,0xca,0x21,0xa0,
+  0x9d,0x86,0x8e,0x1d,0x31,0xb5,0x67,0x15,0xd3,0xc2,0xb0,0x09,0x52,0x52,0x49,0x0e,
+  0x39,0xec,0x35,0xf8,0x5e,0x32,0x3d,0xe6,0x61,0x4f,0x33,0x00,0x3d,0x7a,0x75,0x3e,
+  0xbc,0x7e,0xa0,0xa1,0x92,0xf8,0xb5,0xe4,0x35,0x1c,0x2d,0x9f,0xb9,0x70,0xaa,0x1c,
+  0x12,0x4d,0xe7,0x8f,0x36,0xcb,0xd0,0x02,0x65,0x7b,0x7f,0xc4,0x0b,0xc2,0x82,0x27,
+  0x65,0x52,0xa6,0xd1,0xd2,0xae,0x85,0x7b,0x92,0x38,0x6f,0x47,0x16,0x92,0xaa,0xa3,
+  0x73,0x01,0x36,0x86,0x78,0xbc,0xd2,0x75,0x56,0x3d,0xc9,0x8e,0xa5,0xa2,0xf0,0xee,
+  0xcc,0x30,0x51,0x15,0x32,0x4d,0xaa,0x2a,0xdf,0x43,0x29,0xa2,0xb1,0x3d,0x94,0xaa,
+  0x24,0xe7,0xa5,0x84,0xe3,0xe0,0xb9,0xea,0xd1,0xc5,0xc3,0x80,0x90,0x8b,0xf2,0xf4,
+  0xaa,0x5a,0x46,0xf3,0x0a,0x79,0x91,0x49,0xcd,0x23,0xa9,0x7b,0x80,0xf2,0x42,0xf3,
+  0xe4,0x68,0xbb,0x80,0xab,0xb5,0xa0,0x64,0x71,0x5d,0xfb,0x43,0x5f,0xc6,0x76,0x08,
+  0x8c,0x1f,0x86,0x8a,0xbd,0x41,0xe1,0x9f,0xd6,0xfa,0x71,0x81,0x02,0xf4,0x1e,0xa6,
+  0x0f,0xef,0x28,0x9c,0xde,0xfa,0x9a,0xbe,0x62,0x3b,0x2f,0x4a,0xfd,0xa8,0xdd,0x86,
+  0xbe,0x6d,0x82,0xe6,0x42,0x28,0x42,0xdb,0x3d,0xdc,0xdb,0xe3,0xfe,0x39,0x91,0x75,
+  0x55,0x28,0x6e,0xa4,0x3c,0x21,0x91,0x74,0x79,0xd3,0xac,0x83,0x50,0x4d,0x58,0x99,
+  0x69,0x75,0x72,0x5c,0x96,0x9d,0xa3,0x06,0x91,0xe8,0x32,0x62,0xde,0x72,0xe2,0xdf,
+  0x87,0x54,0x52,0xeb,0xa4,0x34,0xca,0x14,0x7b,0x65,0xec,0xb9,0x84,0x78,0xca,0xed,
+  0x46,0x62,0xed,0x30,0xc8,0x05,0x58,0xf0,0x46,0xbd,0x0c,0x10,0x8e,0x95,0x79,0x71,
+  0x7c,0x67,0x98,0x18,0xe2,0x81,0x4b,0x21,0x45,0x94,0x32,0x85,0xa3,0x52,0x9d,0xdd,
+  0x36,0x3e,0x6e,0x37,0xd8,0xb9,0x66,0x02,0xae,0x85,0xd5,0x28,0x81,0x06,0x44,0x44,
+  0x9e,0x8f,0x4d,0xeb,0xe2,0x54,0x7f,0xb4,0xe7,0xfc,0xb4,0xd5,0xfa,0x71,0xd8,0xb2,
+  0x4d,0xb3,0xde,0xd0,0x88,0x30,0xf6,0x3d,0x06,0xbe,0xa3,0x5e,0x64,0xbf,0xd0,0x6a,
+  0xf4,0xd0,0x96,0x40,0x65,0xa4,0xa0,0x92,0x11,0x14,0xe3,0x18,0xdb,0xd2,0x94,0x38,
+  0x23,0x67,0x74,0xa3,0x46,0x43,0x40,0x59,0x4e,0xdc,0x4b,0x1e,0xde,0x3b,0x0c,0x6b,
+  0x1b,0x8d,0x72,0xaa,0x1d,0x23,0xef,0xf9,0x99,0x7f,0x18,0xb7,0xf1,0xee,0xe1,0xcb,
+  0x20,0x0b,0x98,0xe6,0x3a,0x79,0x96,0x86,0xb6,0x71,0x53,0x8b,0xd9,0x9f,0x56,0x80,
+  0x2d,0xf4,0x04,0x9f,0x34,0x38,0xce,0x83,0x3f,0xb1,0x33,0x2f,0x91,0xe7,0x27,0x6f,
+  0xa2,0x34,0x72,0x2d,0x45,0x21,0x69,0xaa,0x55,0x98,0x87,0xa1,0xfd,0x72,0xbe,0xe4,
+  0x72,0xda,0x00,0x55,0x77,0x68,0x17,0x59,0x88,0x0c,0x30,0xc7,0xbd,0x73,0x9e,0xc9,
+  0xa7,0x95,0x62,0x11,0xb1,0xdf,0xa7,0xf3,0x14,0x3b,0x81,0x66,0x7f,0x44,0xeb,0xd8,
+  0x38,0x85,0xd1,0x8c,0xc4,0x60,0x7e,0x36,0x3a,0x69,0x5a,0xf3,0xe3,0x81,0xc9,0xaa,
+  0x1f,0x4e,0x6b,0x21,0xdd,0x51,0x20,0xd3,0x06,0xcb,0x13,0x97,0xb8,0xa6,0xdb,0x0b,
+  0x49,0x2d,0x64,0xad,0x31,0xfd,0x4b,0xc3,0x88,0x19,0xbb,0x80,0x2d,0x41,0x01,0x98,
+  0x84,0xa7,0x90,0x1d,0x96,0xcd,0xc3,0x72,0x31,0xd7,0x8e,0x44,0x21,0x4a,0x55,0x14,
+  0x7b,0x3b,0x8b,0xb3,0x8e,0x0a,0xfe,0x47,0x9b,0x8b,0x2a,0x94,0x4c,0x6a,0x53,0x1f,
+  0xdc,0xd2,0x03,0xce,0xb4,0x68,0xbe,0x5d,0xd6,0xcb,0x8f,0x2d,0xb1,0xdc,0xdb,0x47,
+  0x8b,0x66,0x50,0x50,0x52,0x82,0x32,0xfd,0xa3,0x99,0xeb,0x99,0xb9,0x21,0x68,0xa8,
+  0x14,0x6d,0x5c,0x22,0x3b,0x36,0x1b,0x3e,0x9e,0x29,0xa3,0x8c,0x41,0x5a,0xb8,0xcc,
+  0x51,0xab,0xd3,0xdb,0x92,0x25,0x9b,0xca,0x64,0x5c,0x95,0xc9,0x89,0x6f,0x69,0x8c,
+  0xf7,0xf6,0x81,0x0d,0x08,0xcb,0x50,0x8a,0x42,0xcc,0x2b,0x5e,0xb8,0xfe,0xbc,0xdd,
+  0xc5,0x50,0xe8,0x2a,0x2b,0x8a,0x42,0x8b,0x3f,0xa1,0xdf,0x08,0x26,0x8f,0x50,0x24,
+  0xe4,0x4d,0x1b,0x42,0x61,0x93,0x1c,0x8f,0xdd,0xd5,0x6a,0x02,0xef,0x47,0xf4,0x8b,
+  0x1c,0x40,0x65,0xf0,0xa7,0x7c,0x7a,0x38,0x7a,0xa3,0xc8,0x28,0xc7,0x75,0x7d,0x3c,
+  0x41,0x93,0xe4,0x43,0x25,0xce,0x41,0x43,0xa1,0x75,0x9e,0x16,0x91,0xe0,0x7a,0x1a,
+  0x04,0xec,0x38,0x44,0x99,0x00,0xe0,0x54,0x5e,0x74,0xd0,0x51,0x8b,0xd3,0x24,0x44,
+  0xcf,0x46,0x3f,0xd1,0x31,0xd7,0x6c,0x91,0xa2,0x1f,0x5a,0x18,0xeb,0xba,0x52,0xf9,
+  0x3c,0x2a,0x2c,0x51,0x69,0xba,0xc6,0x35,0x54,0xa0,0x54,0x64,0x54,0x92,0xf4,0xb8,
+  0xbf,0x8f,0xa7,0x4d,0x59,0x0b,0xc8,0xf7,0x1a,0x9e,0x60,0x2e,0xa0,0xe1,0x42,0x79,
+  0x48,0x1b,0xb4,0x2a,0xcd,0xe1,0x78,0x46,0x00,0xe7,0x7a,0xdb,0x2e,0x21,0x60,0xfe,
+  0x9d,0xca,0x12,0x07,0x54,0xa5,0x50,0x4f,0x0a,0x95,0xc2,0x3b,0xbd,0xc8,0x3a,0x78,
+  0x83,0x65,0x12,0x89,0x59,0x1d,0x77,0xdc,0x4b,0x68,0x95,0xaf,0xdb,0xe9,0x55,0xc0,
+  0x93,0x66,0x1a,0x83,0x40,0x66,0xa0,0x86,0x88,0xc2,0xff,0xe8,0x7b,0x62,0x8d,0x3d,
+  0x0a,0xb1,0xc6,0xb4,0x4d,0x87,0x8b,0x7a,0x9d,0x16,0x09,0x8a,0xe4,0x68,0x5a,0xde,
+  0x5d,0x7f,0xf4,0x93,0xe1,0x7a,0x92,0x10,0x1c,0xf3,0x22,0x10,0xdd,0xd7,0x5d,0x6b,
+  0x41,0xcf,0xd5,0x65,0x9a,0x7e,0x7b,0x0b,0x7d,0x20,0x84,0xf3,0xf3,0xb3,0x17,0xff,
+  0x7b,0xf1,0x7f,0xbf,0x66,0xf3,0xd3,0x94,0x14,0x00,0x00,
+};
+static const char logformatsJS[] PROGMEM = "<script>var logformatsUrl = \"/logformats.json?v=bd71562b\";</script>";
+
+const webAssetStruct webAssets[] PROGMEM = {
+  { "/heishamon.css", "text/css", "3e6647b2", webAsset_heishamon_css, sizeof(webAsset_heishamon_css) },
+  { "/menu.js", "application/javascript", "2915fcb5", webAsset_menu_js, sizeof(webAsset_menu_js) },
+  { "/websocket.js", "application/javascript", "bb745377", webAsset_websocket_js, sizeof(webAsset_websocket_js) },
+  { "/refresh.js", "application/javascript", "d239f425", webAsset_refresh_js, sizeof(webAsset_refresh_js) },
+  { "/select.js", "application/javascript", "0a63db74", webAsset_select_js, sizeof(webAsset_select_js) },
+  { "/settings.js", "application/javascript", "6cb2add6", webAsset_settings_js, sizeof(webAsset_settings_js) },
+  { "/changewifissid.js", "application/javascript", "c12a9254", webAsset_changewifissid_js, sizeof(webAsset_changewifissid_js) },
+  { "/populatescanwifi.js", "application/javascript", "4c7dbeb2", webAsset_populatescanwifi_js, sizeof(webAsset_populatescanwifi_js) },
+  { "/populategetsettings.js", "application/javascript", "b73cc0de", webAsset_populategetsettings_js, sizeof(webAsset_populategetsettings_js) },
+  { "/logformats.json", "application/json", "bd71562b", webAsset_logformats_json, sizeof(webAsset_logformats_json) },
+};
+
+#define NUMBER_OF_WEBASSETS (sizeof(webAssets) / sizeof(webAssets[0]))
+
+#endif
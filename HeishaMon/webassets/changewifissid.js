@@ -0,0 +1,4 @@
+function changewifissid() {
+ var x = document.getElementById("wifi_ssid_select").value;
+ document.getElementById("wifi_ssid_id").value = x;
+}
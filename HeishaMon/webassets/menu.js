@@ -0,0 +1,8 @@
+  function openLeftMenu() {
+   var x = document.getElementById("leftMenu");
+   if (x.style.display === "none") {
+     x.style.display = "block";
+   } else {
+     x.style.display = "none";
+   }
+ }
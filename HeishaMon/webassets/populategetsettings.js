@@ -0,0 +1,52 @@
+var getSettings = function() {
+  var request = new XMLHttpRequest();
+  request.onreadystatechange = function(response) {
+    if(request.readyState === 4) {
+      if(request.status === 200) {
+        var jsonOptions = JSON.parse(request.responseText);
+        for(var key in jsonOptions) {
+          var el = document.getElementsByName(key);
+          if(el.length > 0) {
+            if(Array("text", "number", "password").indexOf(el[0].type) > -1) {
+              el[0].value = jsonOptions[key];
+            };
+            if(el[0].type == "checkbox" && jsonOptions[key] == 1) {
+              el[0].checked = true;
+              if(key == "listenonly") {
+                ShowHideListenOnlyTable(el[0]);
+              };
+              if(key == "use_1wire") {
+                ShowHideDallasTable(el[0]);
+              };
+              if(key == "use_s0") {
+                ShowHideS0Table(el[0]);
+              };
+            };
+            if(el[0].type == "radio") {
+              for(var x = 0; x < el.length; x++) {
+                if(el[x].value == jsonOptions[key]) {
+                  el[x].checked = true;
+                };
+              };
+            };
+            if(el[0].type.indexOf("select") > -1) {
+              var children = el[0].childNodes;
+              for(var x = 0; x < children.length; x++) {
+                if(children[x].value == jsonOptions[key]) {
+                  children[x].selected = true;
+                };
+              };
+            };
+          };
+        };
+        document.getElementById("loading_settings").style.display = "none";
+        document.getElementById("settings_form").style.display = "block";
+        changeMinWatt(1);
+        changeMinWatt(2);
+      };
+    };
+  };
+  request.open('GET', '/getsettings', true);
+  request.send();
+};
+getSettings();
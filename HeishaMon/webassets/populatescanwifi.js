@@ -0,0 +1,29 @@
+var refreshWifiScan = function () {
+ var selectList = document.getElementById('wifi_ssid_select');
+ var request = new XMLHttpRequest();
+ request.onreadystatechange = function(response) {
+  if (request.readyState === 4) {
+   if (request.status === 200) {
+      var jsonOptions = JSON.parse(request.responseText);
+      document.getElementById('wifi_ssid_select').innerText = null;
+      var defaultoption = document.createElement('option');
+      defaultoption.value = '';
+      defaultoption.text = 'Select SSID';
+      defaultoption.selected = true;
+      defaultoption.hidden = true;
+      selectList.appendChild(defaultoption);
+      jsonOptions.forEach(function(item) {
+        var option = document.createElement('option');
+        option.value = item.ssid;
+        option.text = item.ssid + " - " + item.rssi;
+        selectList.appendChild(option);
+      });
+       selectList.style.display = "block";
+     };
+  };
+ };
+ request.open('GET', '/wifiscan', true);
+ request.send();
+ setTimeout(refreshWifiScan,10000);
+};
+setTimeout(refreshWifiScan,500);
@@ -0,0 +1,61 @@
+ let timeout;
+ let currentTable = 'Heatpump';
+ document.body.onload=function() {
+    openTable('Heatpump');
+    document.getElementById("cli").value = "";
+    startWebsockets();
+ };
+ function loadContent(id, url, func) {
+   var xhr = new XMLHttpRequest();
+   xhr.open('GET', url, false);
+   xhr.send();
+   xhr.onload = function() {
+     if(xhr.status == 200) {
+       let obj = document.getElementById(id);
+       if(obj) {
+         obj.innerHTML = xhr.responseText;
+         func();
+       }
+     }
+   }
+ }
+ function updateValues(values) {
+   for(let i = 0; i < values.length; i++) {
+     let row = document.getElementById(values[i][0]);
+     if(!row) {
+       loadContent('heishavalues', '/tablerefresh', function(){});
+       return;
+     }
+     row.cells[2].innerHTML = values[i][1];
+     row.cells[3].innerHTML = values[i][2];
+   }
+ }
+ function refreshTable(tableName){
+   currentTable = tableName;
+   switch(tableName) {
+     case 'Heatpump':
+       loadContent('heishavalues', '/tablerefresh', function(){});
+       break;
+     case 'S0':
+       loadContent('s0values', '/tablerefresh?s0', function(){});
+       break;
+     case 'Opentherm':
+       loadContent('openthermvalues', '/tablerefresh?opentherm', function(){});
+       break;
+     case 'Dallas':
+       loadContent('dallasvalues', '/tablerefresh?1wire', function()
+         {
+           var dallas_elements = document.getElementsByClassName("dallas_alias");
+           for (var i = 0; i < dallas_elements.length; i++) {
+               dallas_elements[i].addEventListener('blur', dallasAliasEdit, false);
+           }
+         });
+       break;
+     default:
+       break;
+   }
+  clearTimeout(timeout);
+  if(tableName != 'Heatpump' || !bConnected) {
+    timeout=setTimeout(refreshTable, 30000, tableName);
+  }
+  }
@@ -0,0 +1,9 @@
+function openTable(tableName) {
+  refreshTable(tableName);
+  var i;
+  var x = document.getElementsByClassName("heishatable");
+  for (i = 0; i < x.length; i++) {
+    x[i].style.display = "none";
+  }
+  document.getElementById(tableName).style.display = "block";
+}
@@ -0,0 +1,17 @@
+    function ShowHideListenOnlyTable(listenonlyEnabled) {
+        var listenonlysettings = document.getElementById("listenonlysettings");
+        listenonlysettings.style.display = listenonlyEnabled.checked ? "none" : "none";
+    }
+    function ShowHideDallasTable(dallasEnabled) {
+        var dallassettings = document.getElementById("dallassettings");
+        dallassettings.style.display = dallasEnabled.checked ? "table" : "none";
+    }
+    function ShowHideS0Table(s0enabled) {
+        var s0settings = document.getElementById("s0settings");
+        s0settings.style.display = s0enabled.checked ? "table" : "none";
+    }
+    function changeMinWatt(port) {
+        var ppkwh = document.getElementById('s0_ppkwh_'+port).value;
+        var interval = document.getElementById('s0_interval_'+port).value;
+        document.getElementById('s0_minwatt_'+port).innerHTML = Math.round((3600 * 1000 / ppkwh) / interval);
+    }
@@ -0,0 +1,189 @@
+  var bConnected = false;
+  var logFormats = null;
+  var logPending = [];
+
+  /* printf for the binary log records, see src/common/log.cpp */
+  function renderLogRecord(buf) {
+    let view = new DataView(buf);
+    let time = view.getUint32(1, true);
+    let millis = view.getUint32(5, true);
+    let id = view.getUint32(9, true);
+    let fmt = logFormats[("0000000" + id.toString(16)).slice(-8)];
+    let pos = 13;
+    if(fmt === undefined) {
+      fmt = "unknown log format " + id.toString(16);
+    }
+    let next = function(type) {
+      let val = undefined;
+      if(type == "s") {
+        let end = pos;
+        while(end < buf.byteLength && view.getUint8(end) != 0) {
+          end++;
+        }
+        if(pos < buf.byteLength) {
+          val = new TextDecoder().decode(new Uint8Array(buf, pos, end - pos));
+        }
+        pos = end + 1;
+      } else if(type == "ll" && pos + 8 <= buf.byteLength) {
+        val = view.getBigInt64(pos, true);
+        pos += 8;
+      } else if(type == "f" && pos + 4 <= buf.byteLength) {
+        val = view.getFloat32(pos, true);
+        pos += 4;
+      } else if(pos + 4 <= buf.byteLength) {
+        val = (type == "i") ? view.getInt32(pos, true) : view.getUint32(pos, true);
+        pos += 4;
+      }
+      return val;
+    };
+    let text = fmt.replace(/%([-+ #0]*)(\*|\d*)(?:\.(\*|\d*))?(hh|h|ll|l|L|z|j|t)?([diuxXocpfFeEgGaAsS%])/g,
+      function(all, flags, width, prec, len, conv) {
+        if(conv == "%") {
+          return "%";
+        }
+        if(width == "*") {
+          width = next("i");
+        }
+        if(prec == "*") {
+          prec = next("i");
+        }
+        let val = undefined;
+        if("diuxXocp".indexOf(conv) > -1) {
+          val = next(len == "ll" ? "ll" : ((conv == "d" || conv == "i") ? "i" : "u"));
+        } else if("sS".indexOf(conv) > -1) {
+          val = next("s");
+        } else {
+          val = next("f");
+        }
+        if(val === undefined) {
+          return "?";
+        }
+        let str = "";
+        switch(conv) {
+          case "d": case "i": case "u":
+            str = val.toString();
+          break;
+          case "x": case "p":
+            str = val.toString(16);
+          break;
+          case "X":
+            str = val.toString(16).toUpperCase();
+          break;
+          case "o":
+            str = val.toString(8);
+          break;
+          case "c":
+            str = String.fromCharCode(Number(val));
+          break;
+          case "s": case "S":
+            str = (prec !== undefined && prec !== "") ? val.substr(0, prec) : val;
+          break;
+          case "e": case "E":
+            str = val.toExponential((prec !== undefined && prec !== "") ? prec : 6);
+            str = (conv == "E") ? str.toUpperCase() : str;
+          break;
+          case "g": case "G":
+            str = val.toPrecision((prec !== undefined && prec !== "") ? Math.max(prec, 1) : 6).replace(/\.?0+$/, "");
+          break;
+          default:
+            str = val.toFixed((prec !== undefined && prec !== "") ? prec : 6);
+          break;
+        }
+        if(flags.indexOf("#") > -1 && (conv == "x" || conv == "X") && val != 0) {
+          str = "0x" + str;
+        }
+        if(flags.indexOf("+") > -1 && "dieEfFgG".indexOf(conv) > -1 && val >= 0) {
+          str = "+" + str;
+        }
+        if(width !== undefined && width !== "" && str.length < width) {
+          if(flags.indexOf("-") > -1) {
+            str = str.padEnd(width);
+          } else if(flags.indexOf("0") > -1 && "sSc".indexOf(conv) == -1) {
+            let sign = (str[0] == "-" || str[0] == "+") ? str[0] : "";
+            str = sign + str.substr(sign.length).padStart(width - sign.length, "0");
+          } else {
+            str = str.padStart(width);
+          }
+        }
+        return str;
+      });
+    let date = new Date(time * 1000);
+    return date.toLocaleString() + " (" + millis + "): " + text;
+  }
+
+  function addLogLine(line) {
+    let obj = document.getElementById("cli");
+    let chk = document.getElementById("autoscroll");
+    obj.value += line + "\n";
+    if(chk.checked) {
+      obj.scrollTop = obj.scrollHeight;
+    }
+  }
+
+  function addLogRecord(buf) {
+    if(logFormats !== null) {
+      addLogLine(renderLogRecord(buf));
+      return;
+    }
+    logPending.push(buf);
+    if(logPending.length > 1) {
+      return;
+    }
+    let request = new XMLHttpRequest();
+    request.onreadystatechange = function() {
+      if(request.readyState === 4) {
+        logFormats = (request.status === 200) ? JSON.parse(request.responseText) : {};
+        logPending.forEach(function(rec) {
+          addLogLine(renderLogRecord(rec));
+        });
+        logPending = [];
+      }
+    };
+    request.open('GET', (typeof logformatsUrl !== "undefined") ? logformatsUrl : '/logformats.json', true);
+    request.send();
+  }
+
+  function startWebsockets() {
+    if(typeof MozWebSocket != "undefined") {
+      oWebsocket = new MozWebSocket("ws://" + location.host + ":80");
+    } else if(typeof WebSocket != "undefined") {
+      /* The characters after the trailing slash are needed for a wierd IE 10 bug */
+      oWebsocket = new WebSocket("ws://" + location.host + ":80/ws");
+    }
+
+    if(oWebsocket) {
+      oWebsocket.binaryType = "arraybuffer";
+
+      oWebsocket.onopen = function(evt) {
+        bConnected = true;
+        refreshTable(currentTable);
+      };
+
+      oWebsocket.onclose = function(evt) {
+        console.log('onclose: ' + evt);
+        bConnected = false;
+        refreshTable(currentTable);
+      };
+
+      oWebsocket.onerror = function(evt) {
+        console.log('onerror: ' + evt);
+      };
+
+      oWebsocket.onmessage = function(evt) {
+        if(evt.data instanceof ArrayBuffer) {
+          addLogRecord(evt.data);
+          return;
+        }
+        if(evt.data.startsWith('{"values":')) {
+          updateValues(JSON.parse(evt.data).values);
+          return;
+        }
+        if(evt.data.startsWith('{"dropped":')) {
+          // messages were lost on a slow connection, reload what is shown
+          refreshTable(currentTable);
+          return;
+        }
+        addLogLine(evt.data);
+      }
+    }
+  }
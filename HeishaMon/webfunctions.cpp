@@ -3,9 +3,14 @@
 #include "version.h"
 #include "htmlcode.h"
 #include "commands.h"
+#include "mqtttopics.h"
 #include "src/common/progmem.h"
 #include "src/common/webserver.h"
 #include "src/common/timerqueue.h"
+#include "src/common/log.h"
+#include "src/common/outbox.h"
+#include "src/common/spool.h"
+#include "src/rules/rules.h"
 
 #include "lwip/apps/sntp.h"
 #include "lwip/dns.h"
@@ -23,6 +28,15 @@ static uint8_t ntpservers = 0;
 void log_message(char* string);
 void log_message(const __FlashStringHelper *msg);
 
+extern unsigned long goodreads;
+extern unsigned long totalreads;
+extern unsigned long badcrcread;
+extern unsigned long badheaderread;
+extern unsigned long tooshortread;
+extern unsigned long toolongread;
+extern unsigned long timeoutread;
+extern loopStatsStruct loopStats;
+
 int dBmToQuality(int dBm) {
   if (dBm == 31)
     return -1;
@@ -205,9 +219,18 @@ void loadSettings(settingsStruct *heishamonSettings) {
           heishamonSettings->use_s0 = ( jsonDoc["use_s0"] == "enabled" ) ? true : false;
           heishamonSettings->listenonly = ( jsonDoc["listenonly"] == "enabled" ) ? true : false;
           heishamonSettings->listenmqtt = ( jsonDoc["listenmqtt"] == "enabled" ) ? true : false;
+          heishamonSettings->mqttSpool = ( jsonDoc["mqttSpool"] == "enabled" ) ? true : false;
+          heishamonSettings->mqttShortTopics = ( jsonDoc["mqttShortTopics"] == "enabled" ) ? true : false;
           heishamonSettings->logMqtt = ( jsonDoc["logMqtt"] == "enabled" ) ? true : false;
           heishamonSettings->logHexdump = ( jsonDoc["logHexdump"] == "enabled" ) ? true : false;
           heishamonSettings->logSerial1 = ( jsonDoc["logSerial1"] == "enabled" ) ? true : false;
+          heishamonSettings->logBinary = ( jsonDoc["logBinary"] == "enabled" ) ? true : false;
+          if ( jsonDoc.containsKey("logCategories")) heishamonSettings->logCategories = jsonDoc["logCategories"];
+          if ( jsonDoc.containsKey("logLevel")) heishamonSettings->logLevel = jsonDoc["logLevel"];
+          if (heishamonSettings->logLevel > LOG_DEBUG) heishamonSettings->logLevel = LOG_DEBUG;
+          log_categories = heishamonSettings->logCategories;
+          log_level = heishamonSettings->logLevel;
+          log_binary = heishamonSettings->logBinary;
           heishamonSettings->optionalPCB = ( jsonDoc["optionalPCB"] == "enabled" ) ? true : false;
           heishamonSettings->opentherm = ( jsonDoc["opentherm"] == "enabled" ) ? true : false;
           if ( jsonDoc["waitTime"]) heishamonSettings->waitTime = jsonDoc["waitTime"];
@@ -376,6 +399,23 @@ void settingsToJson(DynamicJsonDocument &jsonDoc, settingsStruct *heishamonSetti
   } else {
     jsonDoc["logSerial1"] = "disabled";
   }
+  if (heishamonSettings->logBinary) {
+    jsonDoc["logBinary"] = "enabled";
+  } else {
+    jsonDoc["logBinary"] = "disabled";
+  }
+  if (heishamonSettings->mqttSpool) {
+    jsonDoc["mqttSpool"] = "enabled";
+  } else {
+    jsonDoc["mqttSpool"] = "disabled";
+  }
+  if (heishamonSettings->mqttShortTopics) {
+    jsonDoc["mqttShortTopics"] = "enabled";
+  } else {
+    jsonDoc["mqttShortTopics"] = "disabled";
+  }
+  jsonDoc["logCategories"] = heishamonSettings->logCategories;
+  jsonDoc["logLevel"] = heishamonSettings->logLevel;
   if (heishamonSettings->optionalPCB) {
     jsonDoc["optionalPCB"] = "enabled";
   } else {
@@ -421,6 +461,10 @@ int saveSettings(struct webserver_t *client, settingsStruct *heishamonSettings)
   jsonDoc["logMqtt"] = String("");
   jsonDoc["logHexdump"] = String("");
   jsonDoc["logSerial1"] = String("");
+  jsonDoc["logBinary"] = String("");
+  jsonDoc["mqttSpool"] = String("");
+  jsonDoc["mqttShortTopics"] = String("");
+  jsonDoc["logCategories"] = 0;
   jsonDoc["optionalPCB"] = String("");
   jsonDoc["opentherm"] = String("");
   jsonDoc["use_1wire"] = String("");
@@ -459,6 +503,19 @@ int saveSettings(struct webserver_t *client, settingsStruct *heishamonSettings)
       jsonDoc["logHexdump"] = tmp->value;
     } else if (strcmp(tmp->name.c_str(), "logSerial1") == 0) {
       jsonDoc["logSerial1"] = tmp->value;
+    } else if (strcmp(tmp->name.c_str(), "logBinary") == 0) {
+      jsonDoc["logBinary"] = tmp->value;
+    } else if (strcmp(tmp->name.c_str(), "mqttSpool") == 0) {
+      jsonDoc["mqttSpool"] = tmp->value;
+    } else if (strcmp(tmp->name.c_str(), "mqttShortTopics") == 0) {
+      jsonDoc["mqttShortTopics"] = tmp->value;
+    } else if (strncmp(tmp->name.c_str(), "logCat_", 7) == 0) {
+      int16_t mask = log_categories_parse(&tmp->name.c_str()[7]);
+      if (mask > 0 && strcmp(tmp->value.c_str(), "enabled") == 0) {
+        jsonDoc["logCategories"] = (uint8_t)jsonDoc["logCategories"] | mask;
+      }
+    } else if (strcmp(tmp->name.c_str(), "logLevel") == 0) {
+      jsonDoc["logLevel"] = tmp->value.toInt();
     } else if (strcmp(tmp->name.c_str(), "optionalPCB") == 0) {
       jsonDoc["optionalPCB"] = tmp->value;
     } else if (strcmp(tmp->name.c_str(), "opentherm") == 0) {
@@ -539,6 +596,14 @@ int saveSettings(struct webserver_t *client, settingsStruct *heishamonSettings)
 
   saveJsonToConfig(jsonDoc); //save to config file
   loadSettings(heishamonSettings); //load config file to current settings
+  mqttTopicsInit(heishamonSettings->mqtt_topic_base, heishamonSettings->mqttShortTopics); //queued values are sent under the new topics
+  if (heishamonSettings->mqttSpool) {
+    if (spool_init() < 0) {
+      log_message(_F("Could not open the mqtt spool on flash"));
+    }
+  } else {
+    spool_disable();
+  }
 
   while (client->userdata) {
     tmp = (struct websettings_t *)client->userdata;
@@ -706,6 +771,16 @@ int getSettings(struct webserver_t *client, settingsStruct *heishamonSettings) {
         itoa(heishamonSettings->updateAllTime, str, 10);
         webserver_send_content(client, str, strlen(str));
 
+        webserver_send_content_P(client, PSTR(",\"mqttSpool\":"), 13);
+
+        itoa(heishamonSettings->mqttSpool, str, 10);
+        webserver_send_content(client, str, strlen(str));
+
+        webserver_send_content_P(client, PSTR(",\"mqttShortTopics\":"), 19);
+
+        itoa(heishamonSettings->mqttShortTopics, str, 10);
+        webserver_send_content(client, str, strlen(str));
+
         webserver_send_content_P(client, PSTR(",\"listenonly\":"), 14);
 
         itoa(heishamonSettings->listenonly, str, 10);
@@ -739,6 +814,23 @@ int getSettings(struct webserver_t *client, settingsStruct *heishamonSettings) {
         itoa(heishamonSettings->logSerial1, str, 10);
         webserver_send_content(client, str, strlen(str));
 
+        webserver_send_content_P(client, PSTR(",\"logBinary\":"), 13);
+        itoa(heishamonSettings->logBinary, str, 10);
+        webserver_send_content(client, str, strlen(str));
+
+        webserver_send_content_P(client, PSTR(",\"logLevel\":"), 12);
+        itoa(heishamonSettings->logLevel, str, 10);
+        webserver_send_content(client, str, strlen(str));
+
+        {
+          char cats[192];
+          int len = 0;
+          for (uint8_t i = 0; i < LOG_NR_CATEGORIES; i++) {
+            len += snprintf_P(&cats[len], sizeof(cats) - len, PSTR(",\"logCat_%S\":%d"), log_category_name(i), (heishamonSettings->logCategories >> i) & 1);
+          }
+          webserver_send_content(client, cats, len);
+        }
+
         webserver_send_content_P(client, PSTR(",\"optionalPCB\":"), 15);
         itoa(heishamonSettings->optionalPCB, str, 10);
         webserver_send_content(client, str, strlen(str));
@@ -990,6 +1082,7 @@ int handleRoot(struct webserver_t *client, float readpercentage, int mqttReconne
     case 6: {
         webserver_send_content_P(client, refreshJS, strlen_P(refreshJS));
         webserver_send_content_P(client, selectJS, strlen_P(selectJS));
+        webserver_send_content_P(client, logformatsJS, strlen_P(logformatsJS));
         webserver_send_content_P(client, websocketJS, strlen_P(websocketJS));
         webserver_send_content_P(client, webFooter, strlen_P(webFooter));
       } break;
@@ -1020,12 +1113,15 @@ int handleTableRefresh(struct webserver_t *client, char* actData, char* actDataE
       webserver_send(client, 200, (char *)"text/html", 0);
     }
     if (client->content < NUMBER_OF_TOPICS) {
-      for (uint8_t topic = client->content; topic < NUMBER_OF_TOPICS && topic < client->content + 4; topic++) {
-
-        webserver_send_content_P(client, PSTR("<tr><td>TOP"), 11);
+      uint16_t end = client->content + 4; // content is increased in the loop
+      for (uint8_t topic = client->content; topic < NUMBER_OF_TOPICS && topic < end; topic++) {
 
         char str[12];
         itoa(topic, str, 10);
+
+        webserver_send_content_P(client, PSTR("<tr id=\"TOP"), 11);
+        webserver_send_content(client, str, strlen(str));
+        webserver_send_content_P(client, PSTR("\"><td>TOP"), 9);
         webserver_send_content(client, str, strlen(str));
 
         webserver_send_content_P(client, PSTR("</td><td>"), 9);
@@ -1058,12 +1154,15 @@ int handleTableRefresh(struct webserver_t *client, char* actData, char* actDataE
       }
       client->content--; // The webserver also increases by 1
     } else if (client->content - NUMBER_OF_TOPICS < extraTopics ) {
-      for (uint8_t topic = client->content  - NUMBER_OF_TOPICS ; topic < extraTopics && topic < (client->content - NUMBER_OF_TOPICS + 4 ); topic++) {
-
-        webserver_send_content_P(client, PSTR("<tr><td>XTOP"), 12);
+      uint16_t end = client->content - NUMBER_OF_TOPICS + 4;
+      for (uint8_t topic = client->content  - NUMBER_OF_TOPICS ; topic < extraTopics && topic < end; topic++) {
 
         char str[12];
         itoa(topic, str, 10);
+
+        webserver_send_content_P(client, PSTR("<tr id=\"XTOP"), 12);
+        webserver_send_content(client, str, strlen(str));
+        webserver_send_content_P(client, PSTR("\"><td>XTOP"), 10);
         webserver_send_content(client, str, strlen(str));
 
         webserver_send_content_P(client, PSTR("</td><td>"), 9);
@@ -1103,98 +1202,180 @@ int handleTableRefresh(struct webserver_t *client, char* actData, char* actDataE
 
 
 
-int handleJsonOutput(struct webserver_t *client, char* actData, char* actDataExtra, settingsStruct *heishamonSettings, bool extraDataBlockAvailable) {
-  int extraTopics = extraDataBlockAvailable ? NUMBER_OF_TOPICS_EXTRA : 0; //set to 0 if there is no datablock so we don't run json data for it
-  if (client->content == 0) {
-    webserver_send(client, 200, (char *)"application/json", 0);
-    webserver_send_content_P(client, PSTR("{\"heatpump\":["), 13);
-  } else if ((client->content - 1) < NUMBER_OF_TOPICS) {
-    for (uint8_t topic = client->content - 1; topic < NUMBER_OF_TOPICS && topic < client->content + 4 ; topic++) {  //5 TOPS per webserver run (because content was 1 at start, so makes 5)
-
-      webserver_send_content_P(client, PSTR("{\"Topic\":\"TOP"), 13);
+/*
+ * Snapshot of the dynamic parts of the /json document. It is
+ * rendered once per received frame and all /json clients are
+ * served from it. The values are stored as consecutive
+ * "<topic>\0<value>\0" strings. Clients reference the snapshot
+ * while they are being served, so it is only rebuilt when no
+ * client is reading from it.
+ */
+static struct jsoncache_t {
+  uint32_t seq;
+  uint32_t built;
+  uint8_t readers;
+  uint8_t extraTopics;
+  char *values;
+  uint16_t size;
+  uint16_t offset[NUMBER_OF_TOPICS + NUMBER_OF_TOPICS_EXTRA];
+  uint8_t description[NUMBER_OF_TOPICS + NUMBER_OF_TOPICS_EXTRA];
+} jsonCache = { 1, 0, 0, 0, NULL, 0 };
+
+void jsonFrameReceived(void) {
+  jsonCache.seq++;
+}
 
-      {
-        char str[12];
-        itoa(topic, str, 10);
-        webserver_send_content(client, str, strlen(str));
-      }
+/*
+ * The 1wire, s0 and opentherm sections are rendered live,
+ * so the frame sequence only identifies the document when
+ * none of them are enabled.
+ */
+static bool jsonHasETag(settingsStruct *heishamonSettings) {
+  return !heishamonSettings->use_1wire && !heishamonSettings->use_s0 && !heishamonSettings->opentherm;
+}
 
-      webserver_send_content_P(client, PSTR("\",\"Name\":\""), 10);
+bool jsonNotModified(settingsStruct *heishamonSettings, char *etag, uint16_t len) {
+  char str[14];
+  if (!jsonHasETag(heishamonSettings)) {
+    return false;
+  }
+  uint8_t n = snprintf_P(str, sizeof(str), PSTR("\"%lu\""), (unsigned long)jsonCache.seq);
+  return (len == n && strncmp(etag, str, n) == 0);
+}
 
-      webserver_send_content_P(client, topics[topic], strlen_P(topics[topic]));
+uint16_t jsonETagHeader(settingsStruct *heishamonSettings, char *buf, uint16_t size, bool notModified) {
+  if (!jsonHasETag(heishamonSettings)) {
+    return 0;
+  }
+  return snprintf_P(buf, size, PSTR("ETag: \"%lu\"\r\n"), (unsigned long)(notModified ? jsonCache.seq : jsonCache.built));
+}
 
-      webserver_send_content_P(client, PSTR("\",\"Value\":\""), 11);
+static void jsonCacheAppend(uint16_t *pos, const char *str) {
+  uint16_t len = strlen(str) + 1;
+  if (*pos + len > jsonCache.size) {
+    uint16_t size = jsonCache.size > 0 ? jsonCache.size : 512;
+    while (*pos + len > size) {
+      size *= 2;
+    }
+    if ((jsonCache.values = (char *)realloc(jsonCache.values, size)) == NULL) {
+      Serial1.printf(PSTR("Out of memory %s:#%d\n"), __FUNCTION__, __LINE__);
+      ESP.restart();
+      exit(-1);
+    }
+    jsonCache.size = size;
+  }
+  memcpy(&jsonCache.values[*pos], str, len);
+  *pos += len;
+}
 
-      {
-        String dataValue = getDataValue(actData, topic);
-        char* str = (char *)dataValue.c_str();
-        webserver_send_content(client, str, strlen(str));
-      }
+static void jsonCacheBuild(char* actData, char* actDataExtra, bool extraDataBlockAvailable) {
+  uint16_t pos = 0;
+  char str[12];
 
-      webserver_send_content_P(client, PSTR("\",\"Description\":\""), 17);
+  jsonCache.extraTopics = extraDataBlockAvailable ? NUMBER_OF_TOPICS_EXTRA : 0;
+  for (uint8_t topic = 0; topic < NUMBER_OF_TOPICS + jsonCache.extraTopics; topic++) {
+    bool extra = topic >= NUMBER_OF_TOPICS;
+    uint8_t nr = extra ? topic - NUMBER_OF_TOPICS : topic;
 
-      int maxvalue = atoi(topicDescription[topic][0]);
-      int value = actData[0] == '\0' ? 0 : getDataValue(actData, topic).toInt();
-      if (maxvalue == 0) { //this takes the special case where the description is a real value description instead of a mode, so value should take first index (= 0 + 1)
-        value = 0;
-      }
-      if ((value < 0) || (value > maxvalue)) {
-        webserver_send_content_P(client, _unknown, strlen_P(_unknown));
-      }
-      else {
-        webserver_send_content_P(client, topicDescription[topic][value + 1], strlen_P(topicDescription[topic][value + 1]));
-      }
+    jsonCache.offset[topic] = pos;
+    itoa(nr, str, 10);
+    jsonCacheAppend(&pos, str);
 
-      webserver_send_content_P(client, PSTR("\"}"), 2);
+    String dataValue = extra ? getDataValueExtra(actDataExtra, nr) : getDataValue(actData, nr);
+    jsonCacheAppend(&pos, dataValue.c_str());
 
-      if (topic < NUMBER_OF_TOPICS - 1) {
-        webserver_send_content_P(client, PSTR(","), 1);
-      }
-      client->content++;
+    int maxvalue = atoi(extra ? xtopicDescription[nr][0] : topicDescription[nr][0]);
+    int value = (extra ? actDataExtra[0] : actData[0]) == '\0' ? 0 : dataValue.toInt();
+    if (maxvalue == 0) { //this takes the special case where the description is a real value description instead of a mode, so value should take first index (= 0 + 1)
+      value = 0;
     }
-    client->content--; // The webserver also increases by 1
-  } else if ((client->content - NUMBER_OF_TOPICS - 1) < extraTopics) {
-    if (client->content == NUMBER_OF_TOPICS + 1) {
-      webserver_send_content_P(client, PSTR("],\"heatpump extra\":["), 20);
+    if ((value < 0) || (value > maxvalue)) {
+      jsonCache.description[topic] = 0;
+    } else {
+      jsonCache.description[topic] = value + 1;
     }
-    for (uint8_t topic = (client->content - NUMBER_OF_TOPICS - 1); topic < extraTopics && topic < (client->content - NUMBER_OF_TOPICS + 4) ; topic++) {
+  }
+  jsonCache.built = jsonCache.seq;
+}
 
-      webserver_send_content_P(client, PSTR("{\"Topic\":\"XTOP"), 14);
+static void jsonCacheRelease(struct webserver_t *client) {
+  if (client->userdata == &jsonCache) {
+    jsonCache.readers--;
+    client->userdata = NULL;
+  }
+}
 
-      {
-        char str[12];
-        itoa(topic, str, 10);
-        webserver_send_content(client, str, strlen(str));
-      }
+void handleJsonClose(struct webserver_t *client) {
+  jsonCacheRelease(client);
+}
 
-      webserver_send_content_P(client, PSTR("\",\"Name\":\""), 10);
+static void jsonSendTopic(struct webserver_t *client, uint8_t topic) {
+  bool extra = topic >= NUMBER_OF_TOPICS;
+  uint8_t nr = extra ? topic - NUMBER_OF_TOPICS : topic;
+  char *str = &jsonCache.values[jsonCache.offset[topic]];
+  uint16_t len = strlen(str);
 
-      webserver_send_content_P(client, xtopics[topic], strlen_P(xtopics[topic]));
+  if (extra) {
+    webserver_send_content_P(client, PSTR("{\"Topic\":\"XTOP"), 14);
+  } else {
+    webserver_send_content_P(client, PSTR("{\"Topic\":\"TOP"), 13);
+  }
+  webserver_send_content_P(client, str, len);
 
-      webserver_send_content_P(client, PSTR("\",\"Value\":\""), 11);
+  webserver_send_content_P(client, PSTR("\",\"Name\":\""), 10);
+  if (extra) {
+    webserver_send_content_P(client, xtopics[nr], strlen_P(xtopics[nr]));
+  } else {
+    webserver_send_content_P(client, topics[nr], strlen_P(topics[nr]));
+  }
 
-      {
-        String dataValue = getDataValueExtra(actDataExtra, topic);
-        char* str = (char *)dataValue.c_str();
-        webserver_send_content(client, str, strlen(str));
-      }
+  webserver_send_content_P(client, PSTR("\",\"Value\":\""), 11);
+  str += len + 1;
+  webserver_send_content_P(client, str, strlen(str));
 
-      webserver_send_content_P(client, PSTR("\",\"Description\":\""), 17);
+  webserver_send_content_P(client, PSTR("\",\"Description\":\""), 17);
+  uint8_t description = jsonCache.description[topic];
+  if (description == 0) {
+    webserver_send_content_P(client, _unknown, strlen_P(_unknown));
+  } else if (extra) {
+    webserver_send_content_P(client, xtopicDescription[nr][description], strlen_P(xtopicDescription[nr][description]));
+  } else {
+    webserver_send_content_P(client, topicDescription[nr][description], strlen_P(topicDescription[nr][description]));
+  }
 
-      int maxvalue = atoi(xtopicDescription[topic][0]);
-      int value = actDataExtra[0] == '\0' ? 0 : getDataValueExtra(actDataExtra, topic).toInt();
-      if (maxvalue == 0) { //this takes the special case where the description is a real value description instead of a mode, so value should take first index (= 0 + 1)
-        value = 0;
-      }
-      if ((value < 0) || (value > maxvalue)) {
-        webserver_send_content_P(client, _unknown, strlen_P(_unknown));
-      }
-      else {
-        webserver_send_content_P(client, xtopicDescription[topic][value + 1], strlen_P(xtopicDescription[topic][value + 1]));
-      }
+  webserver_send_content_P(client, PSTR("\"}"), 2);
+}
 
-      webserver_send_content_P(client, PSTR("\"}"), 2);
+int handleJsonOutput(struct webserver_t *client, char* actData, char* actDataExtra, settingsStruct *heishamonSettings, bool extraDataBlockAvailable) {
+  if (client->content == 0) {
+    if ((jsonCache.values == NULL || jsonCache.built != jsonCache.seq) && jsonCache.readers == 0) {
+      jsonCacheBuild(actData, actDataExtra, extraDataBlockAvailable);
+    }
+    jsonCache.readers++;
+    client->userdata = &jsonCache;
+    webserver_send(client, 200, (char *)"application/json", 0);
+    webserver_send_content_P(client, PSTR("{\"heatpump\":["), 13);
+    return 0;
+  }
 
+  int extraTopics = jsonCache.extraTopics; //0 if there is no datablock so we don't run json data for it
+  if ((client->content - 1) < NUMBER_OF_TOPICS) {
+    uint16_t end = client->content + 4; // content is increased in the loop
+    for (uint8_t topic = client->content - 1; topic < NUMBER_OF_TOPICS && topic < end; topic++) {  //5 TOPS per webserver run (because content was 1 at start, so makes 5)
+      jsonSendTopic(client, topic);
+      if (topic < NUMBER_OF_TOPICS - 1) {
+        webserver_send_content_P(client, PSTR(","), 1);
+      }
+      client->content++;
+    }
+    client->content--; // The webserver also increases by 1
+  } else if ((client->content - NUMBER_OF_TOPICS - 1) < extraTopics) {
+    if (client->content == NUMBER_OF_TOPICS + 1) {
+      webserver_send_content_P(client, PSTR("],\"heatpump extra\":["), 20);
+    }
+    uint16_t end = client->content - NUMBER_OF_TOPICS + 4;
+    for (uint8_t topic = (client->content - NUMBER_OF_TOPICS - 1); topic < extraTopics && topic < end; topic++) {
+      jsonSendTopic(client, NUMBER_OF_TOPICS + topic);
       if (topic < (extraTopics - 1)) {
         webserver_send_content_P(client, PSTR(","), 1);
       }
@@ -1202,6 +1383,8 @@ int handleJsonOutput(struct webserver_t *client, char* actData, char* actDataExt
     }
     client->content--; // The webserver also increases by 1
   } else if (client->content == (NUMBER_OF_TOPICS + extraTopics + 1)) {
+    // All snapshot content has been sent once the webserver calls us again
+    jsonCacheRelease(client);
     webserver_send_content_P(client, PSTR("]"), 1);
     if (heishamonSettings->use_1wire) {
       webserver_send_content_P(client, PSTR(",\"1wire\":"), 9);
@@ -1220,6 +1403,402 @@ int handleJsonOutput(struct webserver_t *client, char* actData, char* actDataExt
   return 0;
 }
 
+/*
+ * The /metrics page in the OpenMetrics text format. The heatpump
+ * values come from the same snapshot as /json, so a scrape only
+ * streams the stored values between the PROGMEM metric names.
+ */
+static void metricsType(struct webserver_t *client, PGM_P name, PGM_P type) {
+  webserver_send_content_P(client, PSTR("# TYPE "), 7);
+  webserver_send_content_P(client, name, strlen_P(name));
+  webserver_send_content_P(client, PSTR(" "), 1);
+  webserver_send_content_P(client, type, strlen_P(type));
+  webserver_send_content_P(client, PSTR("\n"), 1);
+}
+
+// a metric family with a single sample, counters get the _total suffix
+static void metricsSingle(struct webserver_t *client, PGM_P name, PGM_P type, const char *value) {
+  metricsType(client, name, type);
+  webserver_send_content_P(client, name, strlen_P(name));
+  if (strcmp_P("counter", type) == 0) {
+    webserver_send_content_P(client, PSTR("_total"), 6);
+  }
+  webserver_send_content_P(client, PSTR(" "), 1);
+  webserver_send_content(client, (char *)value, strlen(value));
+  webserver_send_content_P(client, PSTR("\n"), 1);
+}
+
+// a labeled sample, fmt is the whole line with a %lu for the value
+static void metricsSample(struct webserver_t *client, PGM_P fmt, unsigned long value) {
+  char line[80];
+  int len = snprintf_P(line, sizeof(line), fmt, value);
+  webserver_send_content(client, line, len);
+}
+
+static void metricsSendTopic(struct webserver_t *client, uint8_t topic) {
+  bool extra = topic >= NUMBER_OF_TOPICS;
+  uint8_t nr = extra ? topic - NUMBER_OF_TOPICS : topic;
+  char *str = &jsonCache.values[jsonCache.offset[topic]];
+  uint16_t len = strlen(str);
+  char *value = str + len + 1;
+  char *end = NULL;
+
+  // only numeric values can be exposed
+  strtod(value, &end);
+  if (end == value || *end != '\0') {
+    return;
+  }
+
+  if (extra) {
+    webserver_send_content_P(client, PSTR("heishamon_topic{topic=\"XTOP"), 27);
+  } else {
+    webserver_send_content_P(client, PSTR("heishamon_topic{topic=\"TOP"), 26);
+  }
+  webserver_send_content_P(client, str, len);
+  webserver_send_content_P(client, PSTR("\",name=\""), 8);
+  if (extra) {
+    webserver_send_content_P(client, xtopics[nr], strlen_P(xtopics[nr]));
+  } else {
+    webserver_send_content_P(client, topics[nr], strlen_P(topics[nr]));
+  }
+  webserver_send_content_P(client, PSTR("\"} "), 3);
+  webserver_send_content_P(client, value, strlen(value));
+  webserver_send_content_P(client, PSTR("\n"), 1);
+}
+
+static void metricsSystemOutput(struct webserver_t *client, int mqttReconnects) {
+  char str[24];
+
+  snprintf_P(str, sizeof(str), PSTR("%lu"), (unsigned long)(millis() / 1000));
+  metricsSingle(client, PSTR("heishamon_uptime_seconds"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%u"), ESP.getFreeHeap());
+  metricsSingle(client, PSTR("heishamon_heap_free_bytes"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%u"), ESP.getMaxFreeBlockSize());
+  metricsSingle(client, PSTR("heishamon_heap_max_block_bytes"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%u"), ESP.getHeapFragmentation());
+  metricsSingle(client, PSTR("heishamon_heap_fragmentation_percent"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%d"), WiFi.RSSI());
+  metricsSingle(client, PSTR("heishamon_wifi_rssi_dbm"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%d"), mqttReconnects);
+  metricsSingle(client, PSTR("heishamon_mqtt_reconnects"), PSTR("counter"), str);
+
+  dtostrf((double)loopStats.count, 0, 0, str);
+  metricsSingle(client, PSTR("heishamon_loops"), PSTR("counter"), str);
+  dtostrf(loopStats.total / 1000000.0, 0, 6, str);
+  metricsSingle(client, PSTR("heishamon_loop_seconds"), PSTR("counter"), str);
+  dtostrf(loopStats.max / 1000000.0, 0, 6, str);
+  metricsSingle(client, PSTR("heishamon_loop_max_seconds"), PSTR("gauge"), str);
+
+  snprintf_P(str, sizeof(str), PSTR("%lu"), totalreads);
+  metricsSingle(client, PSTR("heishamon_serial_reads"), PSTR("counter"), str);
+  metricsType(client, PSTR("heishamon_serial_read_errors"), PSTR("counter"));
+  metricsSample(client, PSTR("heishamon_serial_read_errors_total{error=\"bad_crc\"} %lu\n"), badcrcread);
+  metricsSample(client, PSTR("heishamon_serial_read_errors_total{error=\"bad_header\"} %lu\n"), badheaderread);
+  metricsSample(client, PSTR("heishamon_serial_read_errors_total{error=\"too_short\"} %lu\n"), tooshortread);
+  metricsSample(client, PSTR("heishamon_serial_read_errors_total{error=\"too_long\"} %lu\n"), toolongread);
+  metricsSample(client, PSTR("heishamon_serial_read_errors_total{error=\"timeout\"} %lu\n"), timeoutread);
+  snprintf_P(str, sizeof(str), PSTR("%lu"), goodreads);
+  metricsSingle(client, PSTR("heishamon_serial_good_reads"), PSTR("counter"), str);
+
+  snprintf_P(str, sizeof(str), PSTR("%lu"), (unsigned long)rule_stats.runs);
+  metricsSingle(client, PSTR("heishamon_rule_runs"), PSTR("counter"), str);
+  metricsType(client, PSTR("heishamon_rule_aborts"), PSTR("counter"));
+  metricsSample(client, PSTR("heishamon_rule_aborts_total{reason=\"steps\"} %lu\n"), rule_stats.aborted_steps);
+  metricsSample(client, PSTR("heishamon_rule_aborts_total{reason=\"time\"} %lu\n"), rule_stats.aborted_time);
+  metricsSample(client, PSTR("heishamon_rule_aborts_total{reason=\"depth\"} %lu\n"), rule_stats.aborted_depth);
+
+  metricsType(client, PSTR("heishamon_log_dropped_lines"), PSTR("counter"));
+  metricsSample(client, PSTR("heishamon_log_dropped_lines_total{sink=\"serial\"} %lu\n"), log_dropped(0));
+  metricsSample(client, PSTR("heishamon_log_dropped_lines_total{sink=\"mqtt\"} %lu\n"), log_dropped(1));
+  metricsSample(client, PSTR("heishamon_log_dropped_lines_total{sink=\"web\"} %lu\n"), log_dropped(2));
+
+  struct outbox_stats_t outbox;
+  outbox_stats(&outbox);
+  snprintf_P(str, sizeof(str), PSTR("%u"), outbox.depth);
+  metricsSingle(client, PSTR("heishamon_mqtt_outbox_messages"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%u"), outbox.bytes);
+  metricsSingle(client, PSTR("heishamon_mqtt_outbox_bytes"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%u"), outbox.peak);
+  metricsSingle(client, PSTR("heishamon_mqtt_outbox_peak_bytes"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%lu"), (unsigned long)outbox.sent);
+  metricsSingle(client, PSTR("heishamon_mqtt_outbox_sent"), PSTR("counter"), str);
+  snprintf_P(str, sizeof(str), PSTR("%lu"), (unsigned long)outbox.coalesced);
+  metricsSingle(client, PSTR("heishamon_mqtt_outbox_coalesced"), PSTR("counter"), str);
+  snprintf_P(str, sizeof(str), PSTR("%lu"), (unsigned long)outbox.dropped);
+  metricsSingle(client, PSTR("heishamon_mqtt_outbox_dropped"), PSTR("counter"), str);
+  dtostrf(outbox.latency_avg / 1000.0, 0, 3, str);
+  metricsSingle(client, PSTR("heishamon_mqtt_outbox_latency_avg_seconds"), PSTR("gauge"), str);
+  dtostrf(outbox.latency_max / 1000.0, 0, 3, str);
+  metricsSingle(client, PSTR("heishamon_mqtt_outbox_latency_max_seconds"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%u"), outbox.spool_segments);
+  metricsSingle(client, PSTR("heishamon_mqtt_spool_segments"), PSTR("gauge"), str);
+  snprintf_P(str, sizeof(str), PSTR("%lu"), (unsigned long)outbox.spooled);
+  metricsSingle(client, PSTR("heishamon_mqtt_spool_stored"), PSTR("counter"), str);
+  snprintf_P(str, sizeof(str), PSTR("%lu"), (unsigned long)outbox.replayed);
+  metricsSingle(client, PSTR("heishamon_mqtt_spool_replayed"), PSTR("counter"), str);
+  snprintf_P(str, sizeof(str), PSTR("%lu"), (unsigned long)outbox.spool_dropped);
+  metricsSingle(client, PSTR("heishamon_mqtt_spool_dropped_segments"), PSTR("counter"), str);
+}
+
+int handleMetrics(struct webserver_t *client, char* actData, char* actDataExtra, settingsStruct *heishamonSettings, bool extraDataBlockAvailable, int mqttReconnects) {
+  if (client->content == 0) {
+    if ((jsonCache.values == NULL || jsonCache.built != jsonCache.seq) && jsonCache.readers == 0) {
+      jsonCacheBuild(actData, actDataExtra, extraDataBlockAvailable);
+    }
+    jsonCache.readers++;
+    client->userdata = &jsonCache;
+    webserver_send(client, 200, (char *)"application/openmetrics-text; version=1.0.0; charset=utf-8", 0);
+    metricsType(client, PSTR("heishamon_topic"), PSTR("gauge"));
+    return 0;
+  }
+
+  // the heatpump and extra topics share one metric family, 10 of them per webserver run
+  uint8_t topics = NUMBER_OF_TOPICS + jsonCache.extraTopics;
+  if ((client->content - 1) < topics) {
+    uint16_t end = client->content + 9; // content is increased in the loop
+    for (uint8_t topic = client->content - 1; topic < topics && topic < end; topic++) {
+      metricsSendTopic(client, topic);
+      client->content++;
+    }
+    client->content--; // The webserver also increases by 1
+  } else if (client->content == topics + 1) {
+    jsonCacheRelease(client);
+    if (heishamonSettings->use_1wire) {
+      dallasMetricsOutput(client);
+    }
+    if (heishamonSettings->use_s0) {
+      s0MetricsOutput(client);
+    }
+  } else if (client->content == topics + 2) {
+    metricsSystemOutput(client, mqttReconnects);
+    webserver_send_content_P(client, PSTR("# EOF\n"), 6);
+  }
+  return 0;
+}
+
+
+/*
+ * Routes of the webserver, sorted on path so they can be found
+ * with a binary search. Each path has the route used for a GET
+ * and for a POST request, 0 when that method is not allowed.
+ */
+struct webRouteStruct {
+  char path[24];
+  uint8_t get;
+  uint8_t post;
+};
+
+static const webRouteStruct webRoutes[] PROGMEM = {
+  { "/", 1, 0 },
+  { "/command", 100, 0 },
+  { "/debug", 40, 0 },
+  { "/events", 200, 0 },
+  { "/factoryreset", 90, 0 },
+  { "/firmware", 140, 150 },
+  { "/fwlink", 80, 0 },
+  { "/gen_204", 80, 0 },
+  { "/generate_204", 80, 0 },
+  { "/getsettings", 130, 0 },
+  { "/hotspot-detect.html", 80, 0 },
+  { "/json", 20, 0 },
+  { "/metrics", 210, 0 },
+  { "/popup", 80, 0 },
+  { "/reboot", 30, 0 },
+  { "/rules", 160, 0 },
+  { "/saverules", 0, 170 },
+  { "/savesettings", 0, 110 },
+  { "/settings", 120, 0 },
+  { "/stats", 190, 0 },
+  { "/tablerefresh", 10, 0 },
+  { "/togglehexdump", 3, 0 },
+  { "/togglelog", 2, 0 },
+  { "/wifiscan", 50, 0 },
+};
+
+#define NUMBER_OF_WEBROUTES (sizeof(webRoutes) / sizeof(webRoutes[0]))
+
+// statistics of the static assets, unknown urls and wrong methods are kept after those of the routes
+#define WEBROUTE_ASSETS NUMBER_OF_WEBROUTES
+#define WEBROUTE_NOTFOUND (NUMBER_OF_WEBROUTES + 1)
+#define WEBROUTE_NOTALLOWED (NUMBER_OF_WEBROUTES + 2)
+#define NUMBER_OF_WEBROUTE_STATS (NUMBER_OF_WEBROUTES + 3)
+
+struct webRouteStatStruct {
+  uint32_t hits;
+  uint32_t max;
+  uint64_t total;
+};
+
+static webRouteStatStruct webRouteStats[NUMBER_OF_WEBROUTE_STATS];
+
+static struct {
+  struct webserver_t *client;
+  unsigned long start;
+  uint8_t index;
+} webRouteTimers[WEBSERVER_MAX_CLIENTS];
+
+static void webRouteStart(struct webserver_t *client, uint8_t index) {
+  uint8_t slot = WEBSERVER_MAX_CLIENTS;
+  for (uint8_t i = 0; i < WEBSERVER_MAX_CLIENTS; i++) {
+    if (webRouteTimers[i].client == client) {
+      slot = i;
+      break;
+    }
+    if (webRouteTimers[i].client == NULL && slot == WEBSERVER_MAX_CLIENTS) {
+      slot = i;
+    }
+  }
+  if (slot < WEBSERVER_MAX_CLIENTS) {
+    webRouteTimers[slot].client = client;
+    webRouteTimers[slot].start = micros();
+    webRouteTimers[slot].index = index;
+  }
+}
+
+/*
+ * Returns the route of the requested url. Unknown urls get route 0
+ * (404), a known url requested with the wrong method gets route 4
+ * or 5 (405, allowing GET or POST).
+ */
+int webRouteLookup(struct webserver_t *client, char *uri) {
+  int16_t low = 0, high = NUMBER_OF_WEBROUTES - 1, mid = 0;
+  webRouteStruct tmp;
+  int route = 0;
+
+  while (low <= high) {
+    mid = (low + high) / 2;
+    memcpy_P(&tmp, &webRoutes[mid], sizeof(tmp));
+    int cmp = strcmp(uri, tmp.path);
+    if (cmp == 0) {
+      route = (client->method == 1) ? tmp.post : tmp.get;
+      if (route == 0) {
+        webRouteStart(client, WEBROUTE_NOTALLOWED);
+        return (tmp.get != 0) ? 4 : 5;
+      }
+      webRouteStart(client, mid);
+      return route;
+    } else if (cmp < 0) {
+      high = mid - 1;
+    } else {
+      low = mid + 1;
+    }
+  }
+
+  if ((route = webAssetRoute(client, uri)) != 0) {
+    if (client->method == 1) {
+      client->userdata = NULL;
+      webRouteStart(client, WEBROUTE_NOTALLOWED);
+      return 4;
+    }
+    webRouteStart(client, WEBROUTE_ASSETS);
+    return route;
+  }
+  webRouteStart(client, WEBROUTE_NOTFOUND);
+  return 0;
+}
+
+// called when a request is finished to account the time it took
+void webRouteDone(struct webserver_t *client) {
+  for (uint8_t i = 0; i < WEBSERVER_MAX_CLIENTS; i++) {
+    if (webRouteTimers[i].client == client) {
+      uint32_t elapsed = micros() - webRouteTimers[i].start;
+      webRouteStatStruct *stat = &webRouteStats[webRouteTimers[i].index];
+      stat->hits++;
+      stat->total += elapsed;
+      if (elapsed > stat->max) {
+        stat->max = elapsed;
+      }
+      webRouteTimers[i].client = NULL;
+      break;
+    }
+  }
+}
+
+int handleRouteStats(struct webserver_t *client) {
+  if (client->content == 0) {
+    webserver_send(client, 200, (char *)"application/json", 0);
+    webserver_send_content_P(client, PSTR("{\"routes\":["), 11);
+  }
+  if (client->content < NUMBER_OF_WEBROUTE_STATS) {
+    char path[24];
+    char str[128];
+    webRouteStatStruct *stat = &webRouteStats[client->content];
+    if (client->content == WEBROUTE_ASSETS) {
+      strcpy_P(path, PSTR("assets"));
+    } else if (client->content == WEBROUTE_NOTFOUND) {
+      strcpy_P(path, PSTR("notfound"));
+    } else if (client->content == WEBROUTE_NOTALLOWED) {
+      strcpy_P(path, PSTR("notallowed"));
+    } else {
+      strcpy_P(path, webRoutes[client->content].path);
+    }
+    int len = snprintf_P(str, sizeof(str), PSTR("%s{\"path\":\"%s\",\"hits\":%u,\"avg_us\":%u,\"max_us\":%u}"),
+                         client->content == 0 ? "" : ",", path, stat->hits,
+                         stat->hits == 0 ? 0 : (uint32_t)(stat->total / stat->hits), stat->max);
+    webserver_send_content(client, str, len);
+  } else if (client->content == NUMBER_OF_WEBROUTE_STATS) {
+    struct outbox_stats_t outbox;
+    outbox_stats(&outbox);
+    char str[448];
+    int len = snprintf_P(str, sizeof(str), PSTR("],\"dropped_frames\":%u,\"sendpool_peak\":%u,\"queue_peak\":%u,\"log_dropped\":{\"serial\":%lu,\"mqtt\":%lu,\"web\":%lu},"
+                                                "\"mqtt_outbox\":{\"depth\":%u,\"bytes\":%u,\"peak\":%u,\"sent\":%lu,\"coalesced\":%lu,\"dropped\":%lu,\"latency_avg_ms\":%lu,\"latency_max_ms\":%lu},"
+                                                "\"mqtt_spool\":{\"segments\":%u,\"stored\":%lu,\"replayed\":%lu,\"dropped_segments\":%lu}}"),
+                         webserver_dropped(), webserver_sendpool_peak(), webserver_queue_peak(),
+                         (unsigned long)log_dropped(0), (unsigned long)log_dropped(1), (unsigned long)log_dropped(2),
+                         outbox.depth, outbox.bytes, outbox.peak, (unsigned long)outbox.sent, (unsigned long)outbox.coalesced,
+                         (unsigned long)outbox.dropped, (unsigned long)outbox.latency_avg, (unsigned long)outbox.latency_max,
+                         outbox.spool_segments, (unsigned long)outbox.spooled, (unsigned long)outbox.replayed, (unsigned long)outbox.spool_dropped);
+    webserver_send_content(client, str, len);
+  }
+  return 0;
+}
+
+/*
+ * The static assets are stored gzipped and referenced with their
+ * ETag in the url, so browsers can cache them until the next
+ * firmware changes them.
+ */
+int webAssetRoute(struct webserver_t *client, char *uri) {
+  for (uint8_t i = 0; i < NUMBER_OF_WEBASSETS; i++) {
+    if (strcmp_P(uri, webAssets[i].path) == 0) {
+      client->userdata = (void *)&webAssets[i];
+      return 180;
+    }
+  }
+  return 0;
+}
+
+bool webAssetNotModified(struct webserver_t *client, char *etag, uint16_t len) {
+  webAssetStruct tmp;
+  memcpy_P(&tmp, client->userdata, sizeof(tmp));
+  uint8_t n = strlen(tmp.etag);
+  return (len == n + 2 && etag[0] == '"' && strncmp(&etag[1], tmp.etag, n) == 0 && etag[n + 1] == '"');
+}
+
+uint16_t webAssetHeader(struct webserver_t *client, char *buf) {
+  webAssetStruct tmp;
+  memcpy_P(&tmp, client->userdata, sizeof(tmp));
+  uint16_t len = 0;
+  if (client->route == 180) {
+    len += sprintf_P(&buf[len], PSTR("Content-Encoding: gzip\r\n"));
+  }
+  len += sprintf_P(&buf[len], PSTR("Cache-Control: public, max-age=31536000, immutable\r\nETag: \"%s\"\r\n"), tmp.etag);
+  return len;
+}
+
+int handleWebAsset(struct webserver_t *client) {
+  if (client->content == 0) {
+    webAssetStruct tmp;
+    memcpy_P(&tmp, client->userdata, sizeof(tmp));
+    if (client->route == 181) {
+      webserver_send(client, 304, tmp.mimetype, 0);
+    } else {
+      webserver_send(client, 200, tmp.mimetype, tmp.len);
+      webserver_send_content_P(client, (PGM_P)tmp.data, tmp.len);
+    }
+  }
+  return 0;
+}
 
 int showRules(struct webserver_t *client) {
   uint16_t len = 0, len1 = 0;
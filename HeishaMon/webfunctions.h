@@ -7,6 +7,7 @@
 #include <ArduinoJson.h>
 #include <LittleFS.h>
 #include "src/common/webserver.h"
+#include "src/common/log.h"
 #include "dallas.h"
 #include "s0.h"
 #include "HeishaOT.h"
@@ -14,6 +15,12 @@
 
 #define HEATPUMP_VALUE_LEN    16
 
+// event types of the /events stream, selected with its query arguments
+#define EVENTS_VALUES 0x01
+#define EVENTS_STATS  0x02
+#define EVENTS_RULES  0x04
+#define EVENTS_LOG    0x08
+
 void log_message(char* string);
 
 
@@ -46,15 +53,27 @@ struct settingsStruct {
   bool optionalPCB = false; //do we emulate an optional PCB?
   bool use_1wire = false; //1wire enabled?
   bool use_s0 = false; //s0 enabled?
+  bool mqttSpool = false; //keep mqtt values on flash while the broker is unreachable
+  bool mqttShortTopics = false; //publish heatpump values as TOP<n>, XTOP<n> and OPT<n> instead of their names
   bool logMqtt = false; //log to mqtt from start
   bool logHexdump = false; //log hexdump from start
   bool logSerial1 = true; //log to serial1 (gpio2) from start
+  uint8_t logCategories = LOG_CATEGORIES; //log message categories from start
+  uint8_t logLevel = LOG_LEVEL_MAX; //highest log level from start
+  bool logBinary = false; //send binary log records to the web console
   bool opentherm = false; //opentherm enable flag
 
   s0SettingsStruct s0Settings[NUM_S0_COUNTERS];
   gpioSettingsStruct gpioSettings;
 };
 
+// how often and how long loop() ran, in microseconds
+struct loopStatsStruct {
+  uint64_t count = 0;
+  uint64_t total = 0;
+  uint32_t max = 0;
+};
+
 struct websettings_t {
   String name;
   String value;
@@ -75,6 +94,11 @@ void getWifiScanResults(int numSsid);
 int handleRoot(struct webserver_t *client, float readpercentage, int mqttReconnects, settingsStruct *heishamonSettings);
 int handleTableRefresh(struct webserver_t *client, char* actData, char* actDataExtra, bool extraDataBlockAvailable);
 int handleJsonOutput(struct webserver_t *client, char* actData, char* actDataExtra, settingsStruct *heishamonSettings, bool extraDataBlockAvailable);
+void handleJsonClose(struct webserver_t *client);
+int handleMetrics(struct webserver_t *client, char* actData, char* actDataExtra, settingsStruct *heishamonSettings, bool extraDataBlockAvailable, int mqttReconnects);
+void jsonFrameReceived(void);
+bool jsonNotModified(settingsStruct *heishamonSettings, char *etag, uint16_t len);
+uint16_t jsonETagHeader(settingsStruct *heishamonSettings, char *buf, uint16_t size, bool notModified);
 int handleFactoryReset(struct webserver_t *client);
 int handleReboot(struct webserver_t *client);
 int handleDebug(struct webserver_t *client, char *hex, byte hex_len);
@@ -88,6 +112,13 @@ int settingsReconnectWifi(struct webserver_t *client, settingsStruct *heishamonS
 int settingsNewPassword(struct webserver_t *client, settingsStruct *heishamonSettings);
 int cacheSettings(struct webserver_t *client, struct arguments_t * args);
 int handleWifiScan(struct webserver_t *client);
+int webRouteLookup(struct webserver_t *client, char *uri);
+void webRouteDone(struct webserver_t *client);
+int handleRouteStats(struct webserver_t *client);
+int webAssetRoute(struct webserver_t *client, char *uri);
+bool webAssetNotModified(struct webserver_t *client, char *etag, uint16_t len);
+uint16_t webAssetHeader(struct webserver_t *client, char *buf);
+int handleWebAsset(struct webserver_t *client);
 void webSocketEvent(uint8_t num, WStype_t type, uint8_t *payload, size_t length);
 int showRules(struct webserver_t *client);
 int showFirmware(struct webserver_t *client);
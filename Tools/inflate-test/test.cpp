@@ -0,0 +1,229 @@
+/*
+  Host tests of the gzip decoder in src/common/inflate.cpp.
+
+  Data is compressed with zlib at several levels and fed to the
+  decoder in parts of random size, like it arrives from the
+  webserver. The inflated output is compared with the original,
+  back references beyond INFLATE_WINDOW_SIZE are read from it
+  through the history callback. See README.md for how to build
+  and run it.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zlib.h>
+
+#include "inflate.h"
+
+#define DATA_SIZE (64 * 1024)
+
+static unsigned char data[DATA_SIZE];
+static unsigned char gz[DATA_SIZE * 2];
+
+/*
+ * What the decoder wrote so far, a damaged stream
+ * that inflates to more than this is refused.
+ */
+static unsigned char output[DATA_SIZE];
+static uint32_t outlen = 0;
+static int histories = 0;
+
+static int failed = 0;
+
+static void check(const char *name, int ok) {
+  printf("%s: %s\n", ok ? "ok" : "FAIL", name);
+  if(!ok) {
+    failed++;
+  }
+}
+
+static int8_t write_cb(void *userdata, unsigned char *buf, uint16_t len) {
+  if(outlen + len > DATA_SIZE) {
+    return -1;
+  }
+  memcpy(&output[outlen], buf, len);
+  outlen += len;
+  return 0;
+}
+
+static int8_t history_cb(void *userdata, uint32_t offset, unsigned char *buf, uint16_t len) {
+  if(offset + len > outlen) {
+    return -1;
+  }
+  memcpy(buf, &output[offset], len);
+  histories++;
+  return 0;
+}
+
+/*
+ * Text made of a few words, with a block of random
+ * bytes that comes back every 10 kB. Its copies are
+ * further apart than the window, so the compressor
+ * refers back to them at up to 32 kB.
+ */
+static void make_data(void) {
+  const char *words[] = { "heatpump ", "outside ", "temp ", "pump ", "flow ", "23.5 ", "\n" };
+  unsigned char block[1024];
+  unsigned int i = 0, x = 0;
+
+  srand(1);
+  for(i=0;i<sizeof(block);i++) {
+    block[i] = rand() & 0xFF;
+  }
+  i = 0;
+  while(i < DATA_SIZE) {
+    if((i % 10240) < 64) {
+      x = DATA_SIZE - i < sizeof(block) ? DATA_SIZE - i : sizeof(block);
+      memcpy(&data[i], block, x);
+      i += x;
+    } else {
+      const char *word = words[rand() % (sizeof(words) / sizeof(words[0]))];
+      x = strlen(word);
+      x = DATA_SIZE - i < x ? DATA_SIZE - i : x;
+      memcpy(&data[i], word, x);
+      i += x;
+    }
+  }
+}
+
+static unsigned long compress_gzip(unsigned char *in, unsigned long len, int level) {
+  z_stream strm;
+
+  memset(&strm, 0, sizeof(strm));
+  if(deflateInit2(&strm, level, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+    return 0;
+  }
+  strm.next_in = in;
+  strm.avail_in = len;
+  strm.next_out = gz;
+  strm.avail_out = sizeof(gz);
+  if(deflate(&strm, Z_FINISH) != Z_STREAM_END) {
+    deflateEnd(&strm);
+    return 0;
+  }
+  deflateEnd(&strm);
+  return strm.total_out;
+}
+
+/*
+ * Feed len bytes of buf in parts of 1 up to maxpart
+ * bytes. Returns what the last inflate_feed returned.
+ */
+static int inflate_parts(unsigned char *buf, unsigned long len, uint16_t maxpart, inflate_history_cb_t *history) {
+  struct inflate_t *inf = inflate_init(write_cb, history, NULL);
+  unsigned long pos = 0;
+  uint16_t part = 0;
+  int ret = 0;
+
+  outlen = 0;
+  histories = 0;
+  if(inf == NULL) {
+    return -1;
+  }
+  while(pos < len && ret == 0) {
+    part = 1 + rand() % maxpart;
+    if(part > len - pos) {
+      part = len - pos;
+    }
+    ret = inflate_feed(inf, &buf[pos], part);
+    pos += part;
+  }
+  inflate_free(inf);
+  return ret;
+}
+
+static void test_levels(void) {
+  int levels[] = { 0, 1, 6, 9 };
+  unsigned int i = 0;
+  unsigned long len = 0;
+  char name[128];
+
+  for(i=0;i<sizeof(levels)/sizeof(levels[0]);i++) {
+    len = compress_gzip(data, DATA_SIZE, levels[i]);
+    snprintf(name, sizeof(name), "compress at level %d", levels[i]);
+    check(name, len > 0);
+
+    snprintf(name, sizeof(name), "inflate level %d in parts of up to 7 bytes", levels[i]);
+    check(name, inflate_parts(gz, len, 7, history_cb) == 1 && outlen == DATA_SIZE && memcmp(output, data, DATA_SIZE) == 0);
+
+    snprintf(name, sizeof(name), "inflate level %d in parts of up to 1460 bytes", levels[i]);
+    check(name, inflate_parts(gz, len, 1460, history_cb) == 1 && outlen == DATA_SIZE && memcmp(output, data, DATA_SIZE) == 0);
+
+    if(levels[i] >= 6) {
+      snprintf(name, sizeof(name), "level %d refers back beyond the window", levels[i]);
+      check(name, histories > 0);
+
+      snprintf(name, sizeof(name), "level %d without a history callback is rejected", levels[i]);
+      check(name, inflate_parts(gz, len, 1460, NULL) == -1);
+    }
+  }
+
+  /*
+   * Random bytes end up in stored blocks
+   */
+  for(i=0;i<DATA_SIZE;i++) {
+    data[i] = rand() & 0xFF;
+  }
+  len = compress_gzip(data, DATA_SIZE, 6);
+  check("inflate random bytes", len > 0 && inflate_parts(gz, len, 1460, history_cb) == 1 &&
+        outlen == DATA_SIZE && memcmp(output, data, DATA_SIZE) == 0);
+  make_data();
+}
+
+/*
+ * A stream that is cut short never completes and a
+ * damaged one never completes with the wrong output.
+ */
+static void test_damaged(void) {
+  unsigned long len = compress_gzip(data, DATA_SIZE, 9);
+  unsigned long cut = 0, pos = 0;
+  int complete = 0, wrong = 0, ret = 0;
+  unsigned int i = 0;
+
+  for(cut=0;cut<len;cut+=1 + rand() % 997) {
+    if(inflate_parts(gz, cut, 1460, history_cb) == 1) {
+      complete++;
+    }
+  }
+  for(i=1;i<=8;i++) {
+    if(inflate_parts(gz, len - i, 1460, history_cb) == 1) {
+      complete++;
+    }
+  }
+  check("truncated streams never complete", complete == 0);
+
+  for(i=0;i<200;i++) {
+    pos = rand() % len;
+    gz[pos] ^= 1 << (rand() % 8);
+    ret = inflate_parts(gz, len, 1460, history_cb);
+    if(ret == 1 && (outlen != DATA_SIZE || memcmp(output, data, DATA_SIZE) != 0)) {
+      wrong++;
+    }
+    /* restore the stream */
+    len = compress_gzip(data, DATA_SIZE, 9);
+  }
+  check("corrupt streams never complete with wrong output", wrong == 0);
+
+  gz[len - 8] ^= 0x55;
+  check("wrong crc is rejected", inflate_parts(gz, len, 1460, history_cb) == -1);
+  gz[len - 8] ^= 0x55;
+
+  gz[len - 4] ^= 0x01;
+  check("wrong size is rejected", inflate_parts(gz, len, 1460, history_cb) == -1);
+  gz[len - 4] ^= 0x01;
+
+  gz[0] = 0x1e;
+  check("wrong magic is rejected", inflate_parts(gz, len, 1460, history_cb) == -1);
+}
+
+int main(int argc, char **argv) {
+  make_data();
+
+  test_levels();
+  test_damaged();
+
+  printf("%d test(s) failed\n", failed);
+  return (failed > 0);
+}
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+# Collects the format strings of all logcat_P() and logcatln_P()
+# calls in HeishaMon/ and writes them to
+# HeishaMon/webassets/logformats.json, keyed by the id the firmware
+# uses for them in binary log records (see src/common/log.h). The
+# web console loads this table to render binary records.
+#
+# Run it by hand after changing log messages, or let platformio run
+# it as pre build script (see platformio.ini), before webassets.py.
+#
+# It can also render the binary log of a running HeishaMon:
+#
+#   Tools/logformats.py decode heishamon.local
+#
+
+import base64
+import json
+import os
+import re
+import socket
+import struct
+import sys
+import time
+
+CALL = re.compile(r'\blogcat(?:ln)?_P\s*\(\s*\w+\s*,\s*\w+\s*,\s*((?:"(?:[^"\\]|\\.)*"\s*)+)')
+LITERAL = re.compile(r'"((?:[^"\\]|\\.)*)"')
+ESCAPES = { "n": "\n", "r": "\r", "t": "\t", "\\": "\\", "\"": "\"", "'": "'", "0": "\0" }
+SPEC = re.compile(r'%([-+ #0]*)(\*|\d*)(?:\.(\*|\d*))?(hh|h|ll|l|L|z|j|t)?([diuxXocpfFeEgGaAsS%])')
+
+def unescape(text):
+  return re.sub(r'\\(x[0-9a-fA-F]{2}|.)', lambda m: chr(int(m.group(1)[1:], 16)) if m.group(1)[0] == "x" else ESCAPES.get(m.group(1), m.group(1)), text)
+
+def fnv1a(data):
+  h = 2166136261
+  for b in data:
+    h = ((h ^ b) * 16777619) & 0xffffffff
+  return h
+
+def collect(srcdir):
+  formats = {}
+  for base, dirs, files in os.walk(srcdir):
+    for name in sorted(files):
+      if not name.endswith((".cpp", ".ino", ".h")):
+        continue
+      with open(os.path.join(base, name), encoding="utf-8", errors="replace") as f:
+        src = f.read()
+      for m in CALL.finditer(src):
+        fmt = "".join(unescape(s) for s in LITERAL.findall(m.group(1)))
+        formats["%08x" % fnv1a(fmt.encode("utf-8"))] = fmt
+  return formats
+
+def generate(root):
+  srcdir = os.path.join(root, "HeishaMon")
+  target = os.path.join(srcdir, "webassets", "logformats.json")
+
+  formats = collect(srcdir)
+  content = json.dumps(dict(sorted(formats.items())), indent=0, ensure_ascii=False) + "\n"
+
+  old = None
+  if os.path.exists(target):
+    with open(target, encoding="utf-8") as f:
+      old = f.read()
+  if old != content:
+    with open(target, "w", encoding="utf-8") as f:
+      f.write(content)
+
+def render(formats, rec):
+  _, stamp, millis, fid = struct.unpack_from("<BIII", rec)
+  fmt = formats.get("%08x" % fid, "unknown log format %08x" % fid)
+  pos = [13]
+
+  def take(kind):
+    if kind == "s":
+      if pos[0] >= len(rec):
+        return None
+      end = rec.find(b"\0", pos[0])
+      end = len(rec) if end < 0 else end
+      val = rec[pos[0]:end].decode("utf-8", "replace")
+      pos[0] = end + 1
+      return val
+    size = 8 if kind == "q" else 4
+    if pos[0] + size > len(rec):
+      return None
+    val = struct.unpack_from("<" + kind, rec, pos[0])[0]
+    pos[0] += size
+    return val
+
+  def spec(m):
+    flags, width, prec, length, conv = m.groups()
+    if conv == "%":
+      return "%"
+    if width == "*":
+      width = str(take("i"))
+    if prec == "*":
+      prec = str(take("i"))
+    if conv in "diuxXocp":
+      val = take("q" if length == "ll" else ("i" if conv in "di" else "I"))
+      conv = "x" if conv == "p" else ("d" if conv == "u" else conv)
+    elif conv in "sS":
+      val = take("s")
+      conv = "s"
+    else:
+      val = take("f")
+      conv = "e" if conv in "aA" else conv
+    if val is None:
+      return "?"
+    return ("%" + flags + (width or "") + ("." + prec if prec is not None else "") + conv) % val
+
+  text = SPEC.sub(spec, fmt)
+  return "%s (%d): %s" % (time.strftime("%c", time.localtime(stamp)), millis, text)
+
+def decode(host, formats):
+  sock = socket.create_connection((host, 80))
+  key = base64.b64encode(os.urandom(16)).decode()
+  sock.sendall(("GET /ws HTTP/1.1\r\nHost: %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n" % (host, key)).encode())
+  buf = b""
+  while b"\r\n\r\n" not in buf:
+    data = sock.recv(1024)
+    if not data:
+      return
+    buf += data
+  buf = buf[buf.index(b"\r\n\r\n") + 4:]
+
+  def read(n):
+    nonlocal buf
+    while len(buf) < n:
+      data = sock.recv(4096)
+      if not data:
+        raise EOFError
+      buf += data
+    out, buf = buf[:n], buf[n:]
+    return out
+
+  try:
+    while True:
+      head = read(2)
+      opcode, size = head[0] & 0x0f, head[1] & 0x7f
+      if size == 126:
+        size = struct.unpack(">H", read(2))[0]
+      elif size == 127:
+        size = struct.unpack(">Q", read(8))[0]
+      payload = read(size)
+      if opcode == 0x1 and not payload.startswith(b"{"):
+        print(payload.decode("utf-8", "replace"), flush=True)
+      elif opcode == 0x2 and len(payload) >= 13 and payload[0] == 0x01:
+        print(render(formats, payload), flush=True)
+      elif opcode == 0x9:
+        mask = os.urandom(4)
+        sock.sendall(bytes([0x8a, 0x80 | len(payload)]) + mask + bytes(b ^ mask[i % 4] for i, b in enumerate(payload)))
+      elif opcode == 0x8:
+        break
+  except (EOFError, KeyboardInterrupt):
+    pass
+
+try:
+  Import("env")
+  generate(env.subst("$PROJECT_DIR"))
+except NameError:
+  root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+  if len(sys.argv) == 3 and sys.argv[1] == "decode":
+    decode(sys.argv[2], collect(os.path.join(root, "HeishaMon")))
+  elif len(sys.argv) == 1:
+    generate(root)
+  else:
+    print("usage: %s [decode <host>]" % sys.argv[0])
+    sys.exit(1)
@@ -0,0 +1,40 @@
+/*
+  Just enough of the ESP8266 Arduino core to run the
+  rules engine on a Linux host, see ../README.md
+*/
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+
+/*
+ * rules.h defines F() away on a host, so flash
+ * strings are plain strings here.
+ */
+typedef char __FlashStringHelper;
+#define PROGMEM
+#define PSTR(x) (x)
+#define PGM_P const char *
+
+#define pgm_read_byte(a) (*(const uint8_t *)(a))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcasecmp_P strcasecmp
+#define strncasecmp_P strncasecmp
+#define snprintf_P snprintf
+
+unsigned long millis(void);
+unsigned long micros(void);
+
+#endif
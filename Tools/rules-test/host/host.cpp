@@ -0,0 +1,37 @@
+/*
+  Host implementation of the Arduino shim, see ../README.md
+*/
+
+#include <time.h>
+
+#include "Arduino.h"
+#include "log.h"
+
+static uint64_t host_now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint64_t host_boot_us = host_now_us();
+
+unsigned long millis(void) {
+  return (unsigned long)((host_now_us() - host_boot_us) / 1000);
+}
+
+unsigned long micros(void) {
+  return (unsigned long)(host_now_us() - host_boot_us);
+}
+
+void _logprintf_P(const char *file, unsigned int line, const __FlashStringHelper *fmt, ...) {
+  va_list ap;
+  fprintf(stderr, "%s:%u: ", file, line);
+  va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  va_end(ap);
+  fputc('\n', stderr);
+}
+
+void _logprintln_P(const char *file, unsigned int line, const __FlashStringHelper *msg) {
+  fprintf(stderr, "%s:%u: %s\n", file, line, msg);
+}
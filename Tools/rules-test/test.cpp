@@ -0,0 +1,380 @@
+/*
+  Host tests of the HeishaMon rules engine.
+
+  The engine of src/rules is linked with a minimal set of variable
+  callbacks instead of the firmware glue in rules.cpp: @Value is a
+  topic whose type can be switched between integer and float and
+  $out stores what a rule assigned. See README.md for how to build
+  and run it.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+
+#include "rules.h"
+#include "mem.h"
+#include "timerqueue.h"
+#include "functions/window.h"
+
+struct rule_options_t rule_options;
+struct timerqueue_t **timerqueue = NULL;
+int timerqueue_size = 0;
+
+void timer_cb(int nr) {
+}
+
+/*
+ * Value of the @Value topic
+ */
+static int value_type = VINTEGER;
+static float value = 0;
+
+/*
+ * Last value assigned to $out
+ */
+static int out_type = VNULL;
+static float out = 0;
+
+static unsigned char mempool[MEMPOOL_SIZE];
+
+#define CANARY 0xA5
+
+static int failed = 0;
+
+static int is_variable(char *text, unsigned int *pos, unsigned int size) {
+  if(size == 6 && strncasecmp(&text[*pos], "@Value", 6) == 0) {
+    return 6;
+  }
+  if(size == 4 && strncasecmp(&text[*pos], "$out", 4) == 0) {
+    return 4;
+  }
+  return -1;
+}
+
+static int is_event(char *text, unsigned int *pos, unsigned int size) {
+  return size;
+}
+
+/*
+ * The rules of the last rule_load
+ */
+static struct rules_t **rules = NULL;
+static int nrrules = 0;
+
+/*
+ * How often a rule was called by another rule
+ */
+static int calls = 0;
+
+/*
+ * Like the firmware: run the rule that is called,
+ * or continue the caller when there is none.
+ */
+static int event_cb(struct rules_t *obj, char *name) {
+  struct vm_tstart_t *start = NULL;
+  struct rules_t *called = NULL;
+  int x = 0;
+
+  for(x=0;x<nrrules;x++) {
+    start = (struct vm_tstart_t *)&rules[x]->ast.buffer[0];
+    if(rules[x]->ast.buffer[start->go] == TEVENT &&
+       strcasecmp(name, (char *)((struct vm_tevent_t *)&rules[x]->ast.buffer[start->go])->token) == 0) {
+      called = rules[x];
+      break;
+    }
+  }
+  if(called != NULL) {
+    calls++;
+    called->caller = obj->nr;
+    return rule_run(called, 0);
+  }
+  return rule_run(obj, 0);
+}
+
+static unsigned char *vm_value_get(struct rules_t *obj, uint16_t token) {
+  struct vm_tvar_t *node = (struct vm_tvar_t *)&obj->ast.buffer[token];
+  static struct vm_vinteger_t vinteger;
+  static struct vm_vfloat_t vfloat;
+  static struct vm_vnull_t vnull;
+
+  if(node->token[0] == '@') {
+    if(value_type == VINTEGER) {
+      memset(&vinteger, 0, sizeof(struct vm_vinteger_t));
+      vinteger.type = VINTEGER;
+      vinteger.value = (int)value;
+      return (unsigned char *)&vinteger;
+    } else {
+      memset(&vfloat, 0, sizeof(struct vm_vfloat_t));
+      vfloat.type = VFLOAT;
+      vfloat.value = value;
+      return (unsigned char *)&vfloat;
+    }
+  }
+
+  memset(&vnull, 0, sizeof(struct vm_vnull_t));
+  vnull.type = VNULL;
+  vnull.ret = token;
+  return (unsigned char *)&vnull;
+}
+
+static void vm_value_cpy(struct rules_t *obj, uint16_t token) {
+}
+
+static void vm_value_clr(struct rules_t *obj, uint16_t token) {
+  struct vm_tvar_t *var = (struct vm_tvar_t *)&obj->ast.buffer[token];
+  var->value = 0;
+}
+
+static void vm_value_set(struct rules_t *obj, uint16_t token, uint16_t val) {
+  out_type = obj->varstack.buffer[val];
+  switch(out_type) {
+    case VINTEGER: {
+      out = ((struct vm_vinteger_t *)&obj->varstack.buffer[val])->value;
+    } break;
+    case VFLOAT: {
+      out = ((struct vm_vfloat_t *)&obj->varstack.buffer[val])->value;
+    } break;
+  }
+}
+
+static void vm_value_prt(struct rules_t *obj, char *out, int size) {
+  out[0] = 0;
+}
+
+/*
+ * Parse the rules the way the firmware does: the
+ * text at the end of the mempool and the rules
+ * with their bytecode and varstack at the start.
+ * Everything between the reserved space and the
+ * text is filled with a canary value. Returns the
+ * first rule.
+ */
+static struct rules_t *rule_load(const char *text, unsigned int *end, unsigned int *txtoffset) {
+  struct pbuf mem, input;
+  size_t len = strlen(text);
+  int ret = 0;
+
+  memset(mempool, 0, MEMPOOL_SIZE);
+  *txtoffset = alignedbuffer(MEMPOOL_SIZE-len-5);
+  memcpy(&mempool[*txtoffset], text, len);
+
+  memset(&mem, 0, sizeof(struct pbuf));
+  memset(&input, 0, sizeof(struct pbuf));
+  mem.payload = mempool;
+  mem.len = 0;
+  mem.tot_len = MEMPOOL_SIZE;
+  input.payload = &mempool[*txtoffset];
+  input.len = *txtoffset;
+  input.tot_len = len;
+
+  rules = NULL;
+  nrrules = 0;
+  while((ret = rule_initialize(&input, &rules, &nrrules, &mem, NULL)) == 0) {
+    input.payload = &mempool[input.len];
+  }
+  if(ret == -1 || nrrules == 0) {
+    return NULL;
+  }
+  *end = alignedbuffer(mem.len);
+  memset(&mempool[*end], CANARY, *txtoffset - *end);
+  return rules[0];
+}
+
+static int canary_intact(unsigned int end, unsigned int txtoffset) {
+  unsigned int i = 0;
+  for(i=end;i<txtoffset;i++) {
+    if(mempool[i] != CANARY) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void check(const char *name, int ok) {
+  printf("%s: %s\n", ok ? "ok" : "FAIL", name);
+  if(!ok) {
+    failed++;
+  }
+}
+
+/*
+ * The validation run sizes the varstack. When a
+ * topic is an integer at that moment, an operator
+ * on two integers takes the fast path that only
+ * reserves the result. At runtime the topic can be
+ * a float, so the regular path with both operands
+ * on the varstack has to fit as well.
+ */
+static void test_operator_types(void) {
+  const char *rules[] = {
+    "on Test then $out = @Value + 1; end",
+    "on Test then $out = @Value * 2 + @Value; end",
+    "on Test then $out = 2 * (@Value + 1); end",
+    "on Test then if @Value * 2 > 3 then $out = @Value * 3 - 1; end end",
+    "on Test then if @Value > 3 && @Value < 100 then $out = @Value - 1; end end",
+  };
+  float expect[] = { 3.5 + 1, 3.5 * 2 + 3.5, 2 * (3.5 + 1), 3.5 * 3 - 1, 3.5 - 1 };
+  unsigned int end = 0, txtoffset = 0, i = 0;
+  char name[128];
+
+  for(i=0;i<sizeof(rules)/sizeof(rules[0]);i++) {
+    value_type = VINTEGER;
+    value = 2;
+
+    struct rules_t *obj = rule_load(rules[i], &end, &txtoffset);
+    snprintf(name, sizeof(name), "parse \"%s\"", rules[i]);
+    check(name, obj != NULL);
+    if(obj == NULL) {
+      continue;
+    }
+
+    value_type = VFLOAT;
+    value = 3.5;
+    out_type = VNULL;
+
+    snprintf(name, sizeof(name), "run with a float \"%s\"", rules[i]);
+    check(name, rule_run(obj, 0) == 0 && out_type == VFLOAT && fabs(out - expect[i]) < EPSILON);
+
+    snprintf(name, sizeof(name), "varstack within reserved space \"%s\"", rules[i]);
+    check(name, canary_intact(end, txtoffset));
+  }
+}
+
+/*
+ * The sample of a window function can be any
+ * expression. The samples added while validating
+ * are dropped, like the firmware does.
+ */
+static void test_window_samples(void) {
+  const char *rules[] = {
+    "on Test then $out = movingAvg(1, @Value); end",
+    "on Test then $out = slope(2, @Value * 2); end",
+  };
+  float expect[] = { 2, 2 };
+  unsigned int end = 0, txtoffset = 0, i = 0, x = 0;
+  char name[128];
+
+  for(i=0;i<sizeof(rules)/sizeof(rules[0]);i++) {
+    value_type = VINTEGER;
+    value = 2;
+
+    struct rules_t *obj = rule_load(rules[i], &end, &txtoffset);
+    snprintf(name, sizeof(name), "parse \"%s\"", rules[i]);
+    check(name, obj != NULL);
+    if(obj == NULL) {
+      continue;
+    }
+    rule_windows_clear();
+
+    int ret = 0;
+    for(x=1;x<=3;x++) {
+      value = x;
+      out_type = VNULL;
+      ret |= rule_run(obj, 0);
+    }
+
+    snprintf(name, sizeof(name), "run \"%s\"", rules[i]);
+    check(name, ret == 0 && out_type == VFLOAT && fabs(out - expect[i]) < EPSILON);
+
+    snprintf(name, sizeof(name), "varstack within reserved space \"%s\"", rules[i]);
+    check(name, canary_intact(end, txtoffset));
+  }
+  rule_windows_free();
+}
+
+/*
+ * Arguments a function can't compute a result
+ * for give NULL instead of stopping the rule.
+ */
+static void test_null_results(void) {
+  const char *rules[] = {
+    "on Test then $out = map(@Value, 5, 5, 0, 10); end",
+    "on Test then $out = curve(@Value, 10, 1, 0, 2); end",
+  };
+  unsigned int end = 0, txtoffset = 0, i = 0;
+  char name[128];
+
+  for(i=0;i<sizeof(rules)/sizeof(rules[0]);i++) {
+    value_type = VINTEGER;
+    value = 20;
+
+    struct rules_t *obj = rule_load(rules[i], &end, &txtoffset);
+    snprintf(name, sizeof(name), "parse \"%s\"", rules[i]);
+    check(name, obj != NULL);
+    if(obj == NULL) {
+      continue;
+    }
+
+    out_type = VINTEGER;
+    snprintf(name, sizeof(name), "NULL from \"%s\"", rules[i]);
+    check(name, rule_run(obj, 0) == 0 && out_type == VNULL);
+
+    snprintf(name, sizeof(name), "varstack within reserved space \"%s\"", rules[i]);
+    check(name, canary_intact(end, txtoffset));
+  }
+}
+
+/*
+ * A called rule counts against RULE_MAX_CALL_DEPTH
+ * until it returns, so a rule can call more rules
+ * one after another than the limit allows nested.
+ * Deeper nesting is aborted, a rule calling
+ * itself runs out of steps while validating.
+ */
+static void test_call_depth(void) {
+  const char *text =
+    "on Test then Sub(); Sub(); Sub(); Sub(); Sub(); Sub(); Sub(); Sub(); Sub(); Sub(); $out = 1; end "
+    "on Sub then Deeper(); end "
+    "on Deeper then $out = 2; end";
+  unsigned int end = 0, txtoffset = 0, len = 0, i = 0;
+  uint32_t aborted = rule_stats.aborted_depth;
+  char chain[1024];
+
+  struct rules_t *obj = rule_load(text, &end, &txtoffset);
+  check("parse ten sequential calls", obj != NULL && nrrules == 3);
+  if(obj != NULL) {
+    calls = 0;
+    out_type = VNULL;
+    check("run ten sequential calls", rule_run(obj, 0) == 0 && calls == 20 &&
+          rule_stats.aborted_depth == aborted && out_type == VINTEGER && out == 1);
+    check("varstack within reserved space of ten sequential calls", canary_intact(end, txtoffset));
+  }
+
+  len = snprintf(chain, sizeof(chain), "on Test then R1(); end ");
+  for(i=1;i<=RULE_MAX_CALL_DEPTH;i++) {
+    len += snprintf(&chain[len], sizeof(chain) - len, "on R%d then R%d(); end ", i, i + 1);
+  }
+  len += snprintf(&chain[len], sizeof(chain) - len, "on R%d then $out = 1; end", i);
+
+  obj = rule_load(chain, &end, &txtoffset);
+  check("parse calls nested too deep", obj != NULL);
+  if(obj != NULL) {
+    check("abort calls nested too deep", rule_run(obj, 0) == -1 && rule_stats.aborted_depth == aborted + 1);
+  }
+
+  aborted = rule_stats.aborted_steps;
+  obj = rule_load("on Test then Test(); end", &end, &txtoffset);
+  check("reject a rule calling itself", obj == NULL && rule_stats.aborted_steps == aborted + 1);
+}
+
+int main(int argc, char **argv) {
+  memset(&rule_options, 0, sizeof(struct rule_options_t));
+  rule_options.is_token_cb = is_variable;
+  rule_options.is_event_cb = is_event;
+  rule_options.set_token_val_cb = vm_value_set;
+  rule_options.get_token_val_cb = vm_value_get;
+  rule_options.prt_token_val_cb = vm_value_prt;
+  rule_options.cpy_token_val_cb = vm_value_cpy;
+  rule_options.clr_token_val_cb = vm_value_clr;
+  rule_options.event_cb = event_cb;
+
+  test_operator_types();
+  test_window_samples();
+  test_null_results();
+  test_call_depth();
+
+  printf("%d test(s) failed\n", failed);
+  return (failed > 0);
+}
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+#
+# Compresses the static web assets in HeishaMon/webassets/ and
+# writes them to HeishaMon/webassets.h as gzipped PROGMEM arrays.
+#
+# Run it by hand after changing one of the assets, or let
+# platformio run it as pre build script (see platformio.ini).
+# The generated header is committed so the Arduino IDE build
+# keeps working without it.
+#
+
+import gzip
+import hashlib
+import os
+import re
+
+ASSETS = [
+  # file, mimetype, symbol holding the html tag referencing it
+  ("heishamon.css", "text/css", "webCSS"),
+  ("menu.js", "application/javascript", "menuJS"),
+  ("websocket.js", "application/javascript", "websocketJS"),
+  ("refresh.js", "application/javascript", "refreshJS"),
+  ("select.js", "application/javascript", "selectJS"),
+  ("settings.js", "application/javascript", "settingsJS"),
+  ("changewifissid.js", "application/javascript", "changewifissidJS"),
+  ("populatescanwifi.js", "application/javascript", "populatescanwifiJS"),
+  ("populategetsettings.js", "application/javascript", "populategetsettingsJS"),
+  # generated by Tools/logformats.py
+  ("logformats.json", "application/json", "logformatsJS"),
+]
+
+def generate(root):
+  srcdir = os.path.join(root, "HeishaMon", "webassets")
+  target = os.path.join(root, "HeishaMon", "webassets.h")
+
+  out = []
+  out.append("// Generated by Tools/webassets.py from HeishaMon/webassets/, do not edit.")
+  out.append("#ifndef _WEBASSETS_H_")
+  out.append("#define _WEBASSETS_H_")
+  out.append("")
+  out.append("struct webAssetStruct {")
+  out.append("  char path[24];")
+  out.append("  char mimetype[24];")
+  out.append("  char etag[12];")
+  out.append("  const uint8_t *data;")
+  out.append("  uint16_t len;")
+  out.append("};")
+  out.append("")
+
+  table = []
+  for name, mimetype, symbol in ASSETS:
+    with open(os.path.join(srcdir, name), "rb") as f:
+      data = gzip.compress(f.read(), compresslevel=9, mtime=0)
+    etag = hashlib.sha1(data).hexdigest()[:8]
+    array = "webAsset_" + re.sub(r"[^A-Za-z0-9]", "_", name)
+    path = "/" + name
+
+    out.append("static const uint8_t %s[] PROGMEM = {" % array)
+    for i in range(0, len(data), 16):
+      out.append("  " + ",".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    out.append("};")
+    if mimetype == "text/css":
+      tag = "<link rel=\\\"stylesheet\\\" href=\\\"%s?v=%s\\\">" % (path, etag)
+    elif mimetype == "application/json":
+      # scripts find the current version of the data through this variable
+      var = re.sub(r"[^A-Za-z0-9]", "_", os.path.splitext(name)[0]) + "Url"
+      tag = "<script>var %s = \\\"%s?v=%s\\\";</script>" % (var, path, etag)
+    else:
+      tag = "<script src=\\\"%s?v=%s\\\"></script>" % (path, etag)
+    out.append("static const char %s[] PROGMEM = \"%s\";" % (symbol, tag))
+    out.append("")
+    table.append("  { \"%s\", \"%s\", \"%s\", %s, sizeof(%s) }," % (path, mimetype, etag, array, array))
+
+  out.append("const webAssetStruct webAssets[] PROGMEM = {")
+  out.extend(table)
+  out.append("};")
+  out.append("")
+  out.append("#define NUMBER_OF_WEBASSETS (sizeof(webAssets) / sizeof(webAssets[0]))")
+  out.append("")
+  out.append("#endif")
+  content = "\n".join(out) + "\n"
+
+  old = None
+  if os.path.exists(target):
+    with open(target) as f:
+      old = f.read()
+  if old != content:
+    with open(target, "w") as f:
+      f.write(content)
+
+try:
+  Import("env")
+  generate(env.subst("$PROJECT_DIR"))
+except NameError:
+  generate(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
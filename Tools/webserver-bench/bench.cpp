@@ -0,0 +1,630 @@
+/*
+  Load test of the HeishaMon webserver on a Linux host.
+
+  The sync webserver of src/common/webserver.cpp runs in its own
+  thread on top of the socket backend in host/, while a number of
+  client threads request /json and /tablerefresh, upload firmware
+  and receive websocket frames. See README.md for how to build it.
+*/
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "webserver.h"
+
+#define NUMBER_OF_TOPICS 119
+
+static int port = 8080;
+static int nrclients = 4;
+static int nrrequests = 200;
+static int uploadsize = 64 * 1024;
+static int nrwebsockets = 3;
+static int nrframes = 500;
+static int verbose = 0;
+
+static std::atomic<bool> running(true);
+static std::atomic<bool> started(false);
+static std::atomic<int> broadcast(0);
+static std::atomic<uint64_t> uploaded(0);
+
+static std::string boundary = "----HeishaMonBenchBoundary7MA4YWxk";
+static std::string payload;
+
+/*
+ * How far an upload got, per client. Only the server
+ * thread uses it.
+ */
+struct upload_t {
+  size_t offset;
+  bool mismatch;
+};
+static std::map<struct webserver_t *, struct upload_t> uploads;
+
+void log_message(char *string) {
+  if(verbose) {
+    fprintf(stderr, "%lu: %s\n", millis(), string);
+  }
+}
+
+void log_message(const __FlashStringHelper *msg) {
+  log_message((char *)msg);
+}
+
+/*
+ * Send a piece of a response, or append it to out when
+ * building the body a client should receive. Literals go
+ * through webserver_send_content_P like in the firmware.
+ */
+static void bench_content(struct webserver_t *client, std::string *out, const char *str, int len, bool literal) {
+  if(out != NULL) {
+    out->append(str, len);
+  } else if(literal) {
+    webserver_send_content_P(client, str, len);
+  } else {
+    webserver_send_content(client, (char *)str, len);
+  }
+}
+
+/*
+ * A /json topic is sent in the same pieces as jsonSendTopic
+ * of the firmware does, a table row in one piece.
+ */
+static void bench_topic(struct webserver_t *client, std::string *out, int route, int topic) {
+  char str[160];
+  int len = 0;
+
+  if(route == 20) {
+    if(topic > 0) {
+      bench_content(client, out, ",", 1, true);
+    }
+    bench_content(client, out, "{\"Topic\":\"TOP", 13, true);
+    len = snprintf(str, sizeof(str), "%d", topic);
+    bench_content(client, out, str, len, false);
+    bench_content(client, out, "\",\"Name\":\"", 10, true);
+    len = snprintf(str, sizeof(str), "Topic_Name_%d", topic);
+    bench_content(client, out, str, len, false);
+    bench_content(client, out, "\",\"Value\":\"", 11, true);
+    len = snprintf(str, sizeof(str), "%d", topic * 7);
+    bench_content(client, out, str, len, false);
+    bench_content(client, out, "\",\"Description\":\"", 17, true);
+    bench_content(client, out, "Value", 5, true);
+    bench_content(client, out, "\"}", 2, true);
+  } else {
+    len = snprintf(str, sizeof(str), "<tr><td>TOP%d</td><td>Topic_Name_%d</td><td>%d</td><td>Value</td></tr>", topic, topic, topic * 7);
+    bench_content(client, out, str, len, false);
+  }
+}
+
+// the body a client should receive from a route
+static std::string bench_body(int route) {
+  std::string body;
+
+  if(route == 150) {
+    return "OK";
+  }
+  if(route == 20) {
+    body = "{\"heatpump\":[";
+  }
+  for(int topic = 0; topic < NUMBER_OF_TOPICS; topic++) {
+    bench_topic(NULL, &body, route, topic);
+  }
+  if(route == 20) {
+    body += "]}";
+  }
+  return body;
+}
+
+/*
+ * The routes mimic what the firmware serves: a /json
+ * document streamed five topics per callback, a table
+ * of the same topics and a multipart firmware upload.
+ */
+static int8_t bench_cb(struct webserver_t *client, void *dat) {
+  switch(client->step) {
+    case WEBSERVER_CLIENT_REQUEST_URI: {
+      if(strcmp((char *)dat, "/json") == 0) {
+        client->route = 20;
+      } else if(strcmp((char *)dat, "/tablerefresh") == 0) {
+        client->route = 10;
+      } else if(strcmp((char *)dat, "/firmware") == 0 && client->method == 1) {
+        client->route = 150;
+        uploads[client] = { 0, false };
+      } else {
+        client->route = 0;
+      }
+    } break;
+    case WEBSERVER_CLIENT_ARGS: {
+      struct arguments_t *args = (struct arguments_t *)dat;
+      if(client->route == 150) {
+        struct upload_t *upload = &uploads[client];
+        if(upload->offset + args->len > payload.size() ||
+           payload.compare(upload->offset, args->len, (char *)args->value, args->len) != 0) {
+          upload->mismatch = true;
+        }
+        upload->offset += args->len;
+        uploaded += args->len;
+      }
+    } break;
+    case WEBSERVER_CLIENT_WRITE: {
+      switch(client->route) {
+        case 10:
+        case 20: {
+          if(client->content == 0) {
+            webserver_send(client, 200, (char *)(client->route == 20 ? "application/json" : "text/html"), 0);
+            if(client->route == 20) {
+              webserver_send_content_P(client, PSTR("{\"heatpump\":["), 13);
+            }
+          } else if((client->content - 1) * 5 < NUMBER_OF_TOPICS) {
+            for(int topic = (client->content - 1) * 5; topic < NUMBER_OF_TOPICS && topic < client->content * 5; topic++) {
+              bench_topic(client, NULL, client->route, topic);
+            }
+          } else if((client->content - 1) * 5 < NUMBER_OF_TOPICS + 5 && client->route == 20) {
+            webserver_send_content_P(client, PSTR("]}"), 2);
+          }
+        } break;
+        case 150: {
+          if(client->content == 0) {
+            struct upload_t *upload = &uploads[client];
+            webserver_send(client, 200, (char *)"text/plain", 2);
+            if(upload->mismatch || upload->offset != payload.size()) {
+              webserver_send_content_P(client, PSTR("NO"), 2);
+            } else {
+              webserver_send_content_P(client, PSTR("OK"), 2);
+            }
+          }
+        } break;
+        default: {
+          if(client->content == 0) {
+            webserver_send(client, 404, (char *)"text/plain", 13);
+            webserver_send_content_P(client, PSTR("404 Not found"), 13);
+          }
+        } break;
+      }
+    } break;
+  }
+  return 0;
+}
+
+static void *server_thread(void *) {
+  char values[512];
+  int len = snprintf(values, sizeof(values), "{\"values\":[");
+
+  while(len < 480) {
+    len += snprintf(&values[len], sizeof(values) - len, "%s[\"TOP%d\",\"%d\",\"Value\"]", len > 11 ? "," : "", len, len);
+  }
+  len += snprintf(&values[len], sizeof(values) - len, "]}");
+
+  webserver_start(port, &bench_cb, 0);
+  started = true;
+  while(running) {
+    webserver_loop();
+    if(broadcast > 0) {
+      websocket_write_all(values, len);
+      broadcast--;
+    }
+  }
+  return NULL;
+}
+
+static double now_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static int bench_connect(int timeout) {
+  struct sockaddr_in addr;
+  struct timeval tv = { timeout / 1000, (timeout % 1000) * 1000 };
+  int fd = socket(AF_INET, SOCK_STREAM, 0), on = 1;
+
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(port);
+  if(connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+static bool bench_send(int fd, const std::string &data) {
+  size_t n = 0;
+  while(n < data.size()) {
+    ssize_t r = send(fd, &data[n], data.size() - n, MSG_NOSIGNAL);
+    if(r <= 0) {
+      return false;
+    }
+    n += r;
+  }
+  return true;
+}
+
+// reads until buf holds at least len bytes
+static bool bench_fill(int fd, std::string &buf, size_t len) {
+  char tmp[4096];
+  while(buf.size() < len) {
+    ssize_t r = recv(fd, tmp, sizeof(tmp), 0);
+    if(r <= 0) {
+      return false;
+    }
+    buf.append(tmp, r);
+  }
+  return true;
+}
+
+static bool bench_line(int fd, std::string &buf, size_t from, size_t *pos, const char *delim) {
+  while((*pos = buf.find(delim, from)) == std::string::npos) {
+    size_t size = buf.size();
+    if(!bench_fill(fd, buf, size + 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*
+ * Reads one response, either with a Content-Length or chunked,
+ * and stores its body in body. Returns the status code, -1 on
+ * errors. Bytes of a next response are left in buf, *close is
+ * set when the server ends the connection after this response.
+ */
+static int bench_response(int fd, std::string &buf, std::string &body, bool *close) {
+  size_t end = 0, pos = 0;
+  int code = -1;
+
+  if(!bench_line(fd, buf, 0, &end, "\r\n\r\n")) {
+    return -1;
+  }
+  std::string header = buf.substr(0, end + 2);
+  buf.erase(0, end + 4);
+  for(char &c : header) {
+    c = tolower(c);
+  }
+  sscanf(header.c_str(), "http/1.1 %d", &code);
+  body.clear();
+  *close = header.find("connection: close") != std::string::npos;
+
+  if((pos = header.find("content-length:")) != std::string::npos) {
+    size_t len = strtoul(&header[pos + 15], NULL, 10);
+    if(!bench_fill(fd, buf, len)) {
+      return -1;
+    }
+    body.append(buf, 0, len);
+    buf.erase(0, len);
+  } else if(header.find("transfer-encoding: chunked") != std::string::npos) {
+    while(true) {
+      if(!bench_line(fd, buf, 0, &end, "\r\n")) {
+        return -1;
+      }
+      size_t len = strtoul(buf.c_str(), NULL, 16);
+      buf.erase(0, end + 2);
+      if(!bench_fill(fd, buf, len + 2)) {
+        return -1;
+      }
+      body.append(buf, 0, len);
+      buf.erase(0, len + 2);
+      if(len == 0) {
+        break;
+      }
+    }
+  }
+  return code;
+}
+
+struct phase_t {
+  const char *name;
+  std::string request;
+  std::string body;
+  int requests;
+  pthread_mutex_t lock;
+  std::vector<double> latency;
+  int errors;
+  uint64_t bytes;
+};
+
+static void *request_thread(void *param) {
+  struct phase_t *phase = (struct phase_t *)param;
+  std::vector<double> latency;
+  std::string buf, body;
+  int errors = 0, fd = -1;
+  bool close_fd = false;
+
+  for(int i = 0; i < phase->requests; i++) {
+    if(fd < 0) {
+      buf.clear();
+      if((fd = bench_connect(10000)) < 0) {
+        errors++;
+        continue;
+      }
+    }
+    double start = now_ms();
+    if(!bench_send(fd, phase->request) || bench_response(fd, buf, body, &close_fd) != 200 || body != phase->body) {
+      errors++;
+      close_fd = true;
+    } else {
+      latency.push_back(now_ms() - start);
+    }
+    if(close_fd) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  if(fd >= 0) {
+    close(fd);
+  }
+
+  pthread_mutex_lock(&phase->lock);
+  phase->latency.insert(phase->latency.end(), latency.begin(), latency.end());
+  phase->errors += errors;
+  pthread_mutex_unlock(&phase->lock);
+  return NULL;
+}
+
+static void report(const char *name, std::vector<double> &latency, int errors, double elapsed, const char *extra) {
+  std::sort(latency.begin(), latency.end());
+  size_t n = latency.size();
+  printf("%-13s %6zu ok %4d err %9.1f req/s   p50 %7.2f ms   p99 %7.2f ms   max %7.2f ms %s\n",
+         name, n, errors, n / (elapsed / 1000.0),
+         n > 0 ? latency[n / 2] : 0, n > 0 ? latency[(n * 99 + 99) / 100 - 1] : 0,
+         n > 0 ? latency[n - 1] : 0, extra);
+}
+
+static void run_phase(const char *name, const std::string &request, int route, int clients, int requests, bool upload) {
+  struct phase_t phase;
+  std::vector<pthread_t> threads(clients);
+
+  phase.name = name;
+  phase.request = request;
+  phase.body = bench_body(route);
+  phase.requests = requests;
+  phase.errors = 0;
+  pthread_mutex_init(&phase.lock, NULL);
+
+  double start = now_ms();
+  for(int i = 0; i < clients; i++) {
+    pthread_create(&threads[i], NULL, request_thread, &phase);
+  }
+  for(int i = 0; i < clients; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  double elapsed = now_ms() - start;
+
+  char str[96] = "";
+  if(upload) {
+    snprintf(str, sizeof(str), "  %.2f MB/s, %llu of %llu bytes received", (uploaded / (1024.0 * 1024.0)) / (elapsed / 1000.0),
+             (unsigned long long)uploaded, (unsigned long long)uploadsize * clients * requests);
+  }
+  report(name, phase.latency, phase.errors, elapsed, str);
+  pthread_mutex_destroy(&phase.lock);
+}
+
+/*
+ * The firmware is filled with pieces of the closing
+ * delimiter, a bare "--" plus boundary and CRLFs at
+ * offsets that don't line up with the read buffers,
+ * so the multipart parser sees them across the edges
+ * of what it gets per read. The server compares what
+ * it receives with this payload.
+ */
+static std::string upload_request(void) {
+  std::string body, request, delim = "\r\n--" + boundary;
+  size_t i = 0, n = 0;
+
+  payload.clear();
+  while(payload.size() < (size_t)uploadsize) {
+    for(i = 0; i < 97 && payload.size() < (size_t)uploadsize; i++) {
+      payload += (char)((payload.size() * 31 + 7) & 0xFF);
+    }
+    switch(n++ % 5) {
+      case 0: payload += "\r\n"; break;
+      case 1: payload += "\r\n--"; break;
+      case 2: payload += delim.substr(0, 5 + n % (delim.size() - 5)); break;
+      case 3: payload += delim.substr(0, delim.size() - 1); break;
+      case 4: payload += delim.substr(2) + "--"; break;
+    }
+  }
+  payload.resize(uploadsize);
+
+  body = "--" + boundary + "\r\nContent-Disposition: form-data; name=\"firmware\"; filename=\"firmware.bin\"\r\n" +
+         "Content-Type: application/octet-stream\r\n\r\n" + payload + "\r\n--" + boundary + "--\r\n";
+
+  request = "POST /firmware HTTP/1.1\r\nHost: heishamon.local\r\nContent-Type: multipart/form-data; boundary=" + boundary +
+            "\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+  return request;
+}
+
+struct websocket_t {
+  int fd;
+  double handshake;
+  double last;
+  int frames;
+};
+
+static void *websocket_thread(void *param) {
+  struct websocket_t *ws = (struct websocket_t *)param;
+  std::string buf;
+  size_t end = 0;
+
+  double start = now_ms();
+  if((ws->fd = bench_connect(2000)) < 0 ||
+     !bench_send(ws->fd, "GET /ws HTTP/1.1\r\nHost: heishamon.local\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                         "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n") ||
+     !bench_line(ws->fd, buf, 0, &end, "\r\n\r\n") || buf.find(" 101 ") == std::string::npos) {
+    ws->handshake = -1;
+    return NULL;
+  }
+  ws->handshake = now_ms() - start;
+  buf.erase(0, end + 4);
+
+  // read frames until the sender is silent for the receive timeout
+  while(bench_fill(ws->fd, buf, 2)) {
+    ws->last = now_ms();
+    size_t len = buf[1] & 0x7f, header = 2;
+    if(len == 126) {
+      if(!bench_fill(ws->fd, buf, 4)) {
+        break;
+      }
+      len = ((uint8_t)buf[2] << 8) | (uint8_t)buf[3];
+      header = 4;
+    }
+    if(!bench_fill(ws->fd, buf, header + len)) {
+      break;
+    }
+    if((buf[0] & 0x0f) == WEBSOCKET_OPCODE_TEXT && buf.compare(header, 11, "{\"values\":[") == 0) {
+      ws->frames++;
+    }
+    buf.erase(0, header + len);
+  }
+  return NULL;
+}
+
+static void run_websockets(void) {
+  std::vector<struct websocket_t> ws(nrwebsockets);
+  std::vector<pthread_t> threads(nrwebsockets);
+  std::vector<double> latency;
+  uint32_t dropped = webserver_dropped();
+  double end = 0;
+  int errors = 0, frames = 0;
+
+  for(int i = 0; i < nrwebsockets; i++) {
+    ws[i].fd = -1;
+    ws[i].handshake = 0;
+    ws[i].frames = 0;
+    ws[i].last = 0;
+    pthread_create(&threads[i], NULL, websocket_thread, &ws[i]);
+  }
+  // give all clients the time to finish their handshake
+  usleep(200 * 1000);
+  double start = now_ms();
+  broadcast = nrframes;
+  while(broadcast > 0) {
+    usleep(1000);
+  }
+  for(int i = 0; i < nrwebsockets; i++) {
+    pthread_join(threads[i], NULL);
+    if(ws[i].handshake < 0) {
+      errors++;
+    } else {
+      end = std::max(end, ws[i].last);
+      latency.push_back(ws[i].handshake);
+      frames += ws[i].frames;
+    }
+    if(ws[i].fd >= 0) {
+      close(ws[i].fd);
+    }
+  }
+  double elapsed = end > start ? end - start : 1;
+
+  std::sort(latency.begin(), latency.end());
+  printf("%-13s %6zu ok %4d err   handshake max %.2f ms   %d of %d frames received, %u dropped, %.0f frames/s\n",
+         "websocket", latency.size(), errors, latency.empty() ? 0 : latency.back(),
+         frames, nrframes * (nrwebsockets - errors), webserver_dropped() - dropped, frames / (elapsed / 1000.0));
+}
+
+/*
+ * Hold all WEBSERVER_MAX_CLIENTS slots with idle connections
+ * and see what happens to the next request.
+ */
+static void run_limit(void) {
+  std::vector<int> idle;
+  std::string buf, body;
+  bool close_fd = false;
+  int fd = -1, code = -1;
+
+  for(int i = 0; i < WEBSERVER_MAX_CLIENTS; i++) {
+    idle.push_back(bench_connect(1000));
+  }
+  usleep(100 * 1000);
+
+  double start = now_ms();
+  if((fd = bench_connect(1000)) >= 0 && bench_send(fd, "GET /json HTTP/1.1\r\nHost: heishamon.local\r\n\r\n")) {
+    code = bench_response(fd, buf, body, &close_fd);
+  }
+  if(code == 200) {
+    printf("limit         request with %d idle clients served in %.2f ms\n", WEBSERVER_MAX_CLIENTS, now_ms() - start);
+  } else {
+    printf("limit         request with %d idle clients not served within %.0f ms\n", WEBSERVER_MAX_CLIENTS, now_ms() - start);
+
+    // free one slot, the waiting connection should now be taken
+    close(idle.back());
+    idle.pop_back();
+    start = now_ms();
+    struct timeval tv = { 5, 0 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    buf.clear();
+    code = bench_response(fd, buf, body, &close_fd);
+    printf("limit         after closing an idle client: %s in %.2f ms\n", code == 200 ? "served" : "not served", now_ms() - start);
+  }
+  if(fd >= 0) {
+    close(fd);
+  }
+  for(int x : idle) {
+    if(x >= 0) {
+      close(x);
+    }
+  }
+}
+
+static void usage(const char *name) {
+  printf("Usage: %s [options]\n", name);
+  printf("  -p port        port to listen on (%d)\n", port);
+  printf("  -c clients     concurrent http clients (%d)\n", nrclients);
+  printf("  -n requests    requests per client (%d)\n", nrrequests);
+  printf("  -u bytes       size of each firmware upload (%d)\n", uploadsize);
+  printf("  -w clients     websocket clients (%d)\n", nrwebsockets);
+  printf("  -f frames      websocket frames to broadcast (%d)\n", nrframes);
+  printf("  -v             show the webserver log\n");
+}
+
+int main(int argc, char **argv) {
+  pthread_t server;
+  int c = 0;
+
+  while((c = getopt(argc, argv, "p:c:n:u:w:f:vh")) != -1) {
+    switch(c) {
+      case 'p': port = atoi(optarg); break;
+      case 'c': nrclients = atoi(optarg); break;
+      case 'n': nrrequests = atoi(optarg); break;
+      case 'u': uploadsize = atoi(optarg); break;
+      case 'w': nrwebsockets = atoi(optarg); break;
+      case 'f': nrframes = atoi(optarg); break;
+      case 'v': verbose = 1; break;
+      default: usage(argv[0]); return c == 'h' ? 0 : 1;
+    }
+  }
+
+  pthread_create(&server, NULL, server_thread, NULL);
+  while(!started) {
+    usleep(1000);
+  }
+
+  printf("%d clients, %d requests each, WEBSERVER_MAX_CLIENTS %d\n\n", nrclients, nrrequests, WEBSERVER_MAX_CLIENTS);
+
+  run_phase("/json", "GET /json HTTP/1.1\r\nHost: heishamon.local\r\n\r\n", 20, nrclients, nrrequests, false);
+  run_phase("/tablerefresh", "GET /tablerefresh HTTP/1.1\r\nHost: heishamon.local\r\n\r\n", 10, nrclients, nrrequests, false);
+  run_phase("/firmware", upload_request(), 150, nrclients, std::max(1, nrrequests / 20), true);
+  run_websockets();
+  run_limit();
+
+  running = false;
+  pthread_join(server, NULL);
+
+  printf("\nsendpool peak %u of %d entries, websocket queue peak %u of %d bytes, %u frames dropped\n",
+         webserver_sendpool_peak(), WEBSERVER_SENDPOOL_SIZE, webserver_queue_peak(), WEBSERVER_QUEUE_SIZE, webserver_dropped());
+  return 0;
+}
@@ -0,0 +1,69 @@
+/*
+  Just enough of the ESP8266 Arduino core to run the
+  sync webserver on a Linux host, see ../README.md
+*/
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <string>
+
+class __FlashStringHelper;
+#define F(x) ((const __FlashStringHelper *)(x))
+#define PROGMEM
+#define PSTR(x) (x)
+#define PGM_P const char *
+
+#define pgm_read_byte(a) (*(const uint8_t *)(a))
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcasecmp_P strcasecmp
+#define strncpy_P strncpy
+#define strcpy_P strcpy
+#define strstr_P strstr
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+
+typedef uint8_t byte;
+
+unsigned long millis(void);
+unsigned long micros(void);
+
+class String {
+  public:
+    String(const char *str) : s(str) {}
+    const char *c_str() const { return s.c_str(); }
+  private:
+    std::string s;
+};
+
+class IPAddress {
+  public:
+    IPAddress(uint32_t addr = 0) : addr(addr) {}
+    String toString() const;
+  private:
+    uint32_t addr;
+};
+
+class HardwareSerial {
+  public:
+    size_t printf(const char *fmt, ...);
+};
+extern HardwareSerial Serial1;
+
+class EspClass {
+  public:
+    void restart(void);
+};
+extern EspClass ESP;
+
+#endif
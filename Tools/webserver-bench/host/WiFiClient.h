@@ -0,0 +1,34 @@
+/*
+  WiFiClient on top of a non-blocking POSIX socket
+*/
+
+#ifndef _HOST_WIFICLIENT_H_
+#define _HOST_WIFICLIENT_H_
+
+#include "Arduino.h"
+
+class WiFiClient {
+  public:
+    WiFiClient(int fd = -1) : fd(fd) {}
+    /*
+     * Like the ESP8266 core, a copy refers to the
+     * same connection, only stop() closes it.
+     */
+    uint8_t connected(void);
+    int available(void);
+    int availableForWrite(void);
+    int read(uint8_t *buf, size_t size);
+    size_t write(const uint8_t *buf, size_t size);
+    size_t write_P(PGM_P buf, size_t size);
+    void stop(void);
+    void setNoDelay(bool nodelay);
+    void setTimeout(unsigned long timeout) { this->timeout = timeout; }
+    IPAddress remoteIP(void);
+    uint16_t remotePort(void);
+    operator bool() { return fd >= 0; }
+  private:
+    int fd;
+    unsigned long timeout = 5000;
+};
+
+#endif
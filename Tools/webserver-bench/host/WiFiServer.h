@@ -0,0 +1,27 @@
+/*
+  WiFiServer on top of a listening POSIX socket
+*/
+
+#ifndef _HOST_WIFISERVER_H_
+#define _HOST_WIFISERVER_H_
+
+#include "WiFiClient.h"
+
+class WiFiServer {
+  public:
+    WiFiServer(uint16_t port) : port(port) {}
+    void begin(uint16_t port);
+    /*
+     * A connection that isn't taken with available()
+     * is kept until the next call, others wait in
+     * the listen backlog like they do on the ESP.
+     */
+    bool hasClient(void);
+    WiFiClient available(void);
+  private:
+    uint16_t port;
+    int fd = -1;
+    int pending = -1;
+};
+
+#endif
@@ -0,0 +1,197 @@
+/*
+  Host implementation of the Arduino shim, see ../README.md
+*/
+
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <linux/sockios.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+#include "WiFiServer.h"
+
+HardwareSerial Serial1;
+EspClass ESP;
+
+static uint64_t host_now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint64_t host_boot_us = host_now_us();
+
+unsigned long millis(void) {
+  return (unsigned long)((host_now_us() - host_boot_us) / 1000);
+}
+
+unsigned long micros(void) {
+  return (unsigned long)(host_now_us() - host_boot_us);
+}
+
+size_t HardwareSerial::printf(const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  int len = vfprintf(stderr, fmt, ap);
+  va_end(ap);
+  return len;
+}
+
+void EspClass::restart(void) {
+  fprintf(stderr, "ESP.restart() called\n");
+  abort();
+}
+
+String IPAddress::toString() const {
+  struct in_addr in;
+  in.s_addr = addr;
+  return String(inet_ntoa(in));
+}
+
+uint8_t WiFiClient::connected(void) {
+  char c = 0;
+
+  if(fd < 0) {
+    return 0;
+  }
+  int r = recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  if(r > 0 || (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))) {
+    return 1;
+  }
+  return 0;
+}
+
+int WiFiClient::available(void) {
+  int n = 0;
+
+  if(fd < 0 || ioctl(fd, FIONREAD, &n) < 0) {
+    return 0;
+  }
+  return n;
+}
+
+int WiFiClient::availableForWrite(void) {
+  int size = 0, queued = 0;
+  socklen_t len = sizeof(size);
+
+  if(fd < 0 || getsockopt(fd, SOL_SOCKET, SO_SNDBUF, &size, &len) < 0 ||
+     ioctl(fd, SIOCOUTQ, &queued) < 0) {
+    return 0;
+  }
+  return size > queued ? size - queued : 0;
+}
+
+int WiFiClient::read(uint8_t *buf, size_t size) {
+  if(fd < 0) {
+    return 0;
+  }
+  ssize_t r = recv(fd, buf, size, MSG_DONTWAIT);
+  return r > 0 ? (int)r : 0;
+}
+
+/*
+ * Like on the ESP, a write blocks until everything
+ * is accepted by the stack or the timeout passed.
+ */
+size_t WiFiClient::write(const uint8_t *buf, size_t size) {
+  size_t n = 0;
+  unsigned long start = millis();
+
+  while(fd >= 0 && n < size) {
+    ssize_t r = send(fd, &buf[n], size - n, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if(r > 0) {
+      n += r;
+    } else if(r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      if(millis() - start > timeout) {
+        break;
+      }
+      struct pollfd pfd = { fd, POLLOUT, 0 };
+      poll(&pfd, 1, 10);
+    } else {
+      break;
+    }
+  }
+  return n;
+}
+
+size_t WiFiClient::write_P(PGM_P buf, size_t size) {
+  return write((const uint8_t *)buf, size);
+}
+
+void WiFiClient::stop(void) {
+  if(fd >= 0) {
+    close(fd);
+    fd = -1;
+  }
+}
+
+void WiFiClient::setNoDelay(bool nodelay) {
+  int on = nodelay ? 1 : 0;
+  if(fd >= 0) {
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+  }
+}
+
+IPAddress WiFiClient::remoteIP(void) {
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+
+  if(fd < 0 || getpeername(fd, (struct sockaddr *)&addr, &len) < 0) {
+    return IPAddress();
+  }
+  return IPAddress(addr.sin_addr.s_addr);
+}
+
+uint16_t WiFiClient::remotePort(void) {
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+
+  if(fd < 0 || getpeername(fd, (struct sockaddr *)&addr, &len) < 0) {
+    return 0;
+  }
+  return ntohs(addr.sin_port);
+}
+
+void WiFiServer::begin(uint16_t port) {
+  struct sockaddr_in addr;
+  int on = 1;
+
+  if(port > 0) {
+    this->port = port;
+  }
+  if((fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0)) < 0) {
+    perror("socket");
+    exit(1);
+  }
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(this->port);
+  if(bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 16) < 0) {
+    perror("bind");
+    exit(1);
+  }
+}
+
+bool WiFiServer::hasClient(void) {
+  if(pending < 0 && fd >= 0) {
+    pending = accept4(fd, NULL, NULL, SOCK_NONBLOCK);
+  }
+  return pending >= 0;
+}
+
+WiFiClient WiFiServer::available(void) {
+  WiFiClient client(pending);
+  pending = -1;
+  return client;
+}
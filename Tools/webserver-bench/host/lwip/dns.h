@@ -0,0 +1 @@
+#include "tcp.h"
@@ -0,0 +1,58 @@
+/*
+  The host build only runs the sync webserver, so the
+  lwIP raw api used in async mode does nothing here.
+*/
+
+#ifndef _HOST_LWIP_TCP_H_
+#define _HOST_LWIP_TCP_H_
+
+#include <stdint.h>
+
+typedef int8_t err_t;
+
+#define ERR_OK 0
+#define ERR_MEM -1
+#define TCP_PRIO_MIN 1
+#define TCP_WRITE_FLAG_COPY 0x01
+#define TCP_WRITE_FLAG_MORE 0x02
+
+typedef struct ip_addr { uint32_t addr; } ip_addr_t;
+#define IPADDR_ANY ((uint32_t)0)
+
+struct pbuf {
+  struct pbuf *next;
+  void *payload;
+  uint16_t tot_len;
+  uint16_t len;
+};
+
+struct tcp_pcb {
+  ip_addr_t remote_ip;
+  uint16_t remote_port;
+};
+
+typedef err_t (*tcp_accept_fn)(void *arg, struct tcp_pcb *pcb, err_t err);
+typedef err_t (*tcp_recv_fn)(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err);
+typedef err_t (*tcp_sent_fn)(void *arg, struct tcp_pcb *pcb, uint16_t len);
+typedef err_t (*tcp_poll_fn)(void *arg, struct tcp_pcb *pcb);
+typedef void (*tcp_err_fn)(void *arg, err_t err);
+
+static inline struct tcp_pcb *tcp_new(void) { return NULL; }
+static inline err_t tcp_bind(struct tcp_pcb *, const ip_addr_t *, uint16_t) { return ERR_MEM; }
+static inline struct tcp_pcb *tcp_listen_with_backlog(struct tcp_pcb *, uint8_t) { return NULL; }
+static inline void tcp_accept(struct tcp_pcb *, tcp_accept_fn) {}
+static inline void tcp_arg(struct tcp_pcb *, void *) {}
+static inline void tcp_recv(struct tcp_pcb *, tcp_recv_fn) {}
+static inline void tcp_sent(struct tcp_pcb *, tcp_sent_fn) {}
+static inline void tcp_poll(struct tcp_pcb *, tcp_poll_fn, uint8_t) {}
+static inline void tcp_err(struct tcp_pcb *, tcp_err_fn) {}
+static inline void tcp_recved(struct tcp_pcb *, uint16_t) {}
+static inline err_t tcp_close(struct tcp_pcb *) { return ERR_OK; }
+static inline err_t tcp_write(struct tcp_pcb *, const void *, uint16_t, uint8_t) { return ERR_MEM; }
+static inline err_t tcp_output(struct tcp_pcb *) { return ERR_OK; }
+static inline void tcp_setprio(struct tcp_pcb *, uint8_t) {}
+static inline void tcp_nagle_disable(struct tcp_pcb *) {}
+static inline uint16_t tcp_sndbuf(struct tcp_pcb *) { return 0; }
+static inline uint8_t pbuf_free(struct pbuf *) { return 0; }
+
+#endif